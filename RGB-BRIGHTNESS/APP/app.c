@@ -15,22 +15,22 @@
 #include "btn_interface.h"
 #include "systick_interface.h"
 #include "systick_linking_config.h"
+#include "sw_timer_interface.h"
+#include "TM4C123.h"
 
 /*
  * Private Typedefs */
 typedef enum{
     ALL_OFF = 0 ,
-    RED_LED      ,
-    GREEN_LED    ,
-    BLUE_LED     ,
-    ALL_LEDS      ,
+    GREEN_30    ,   // green at 30% duty
+    GREEN_60    ,   // green at 60% duty
+    GREEN_90    ,   // green at 90% duty
     SUB_STATES_TOTAL
 }en_app_sub_state_t;
 
 typedef enum{
     IDLE        = 0 ,   // Idle Doing nothing
     SWITCHING       ,   // Switching sub-state
-    TURNING_OFF     ,   // Turn off LEDs
     STATES_TOTAL
 }en_app_state_t;
 
@@ -45,14 +45,27 @@ typedef enum{
 #define BLUE_LED_PORT 	LED_PORT_F // Port F
 #define BLUE_LED_PIN		LED_PIN_2
 
+// all RGB channels share port F, so they can be switched with a single write
+#define RGB_LEDS_PORT       LED_PORT_F
+#define RED_LED_MASK        LED_PIN_MASK(RED_LED_PIN)
+#define GREEN_LED_MASK      LED_PIN_MASK(GREEN_LED_PIN)
+#define BLUE_LED_MASK       LED_PIN_MASK(BLUE_LED_PIN)
+#define RGB_LEDS_MASK       (RED_LED_MASK | GREEN_LED_MASK | BLUE_LED_MASK)
+
 #define USER_BTN_PORT		BTN_PORT_F // Port F
 #define USER_BTN_PIN		BTN_PIN_4
 
-#define LED_BLINK_DURATION  1000
+// green brightness of each sub-state (permille of LED_PWM_PERIOD_US)
+#define GREEN_30_DUTY       300
+#define GREEN_60_DUTY       600
+#define GREEN_90_DUTY       900
+#define BTN_DEBOUNCE_MS     200 // presses closer than this to the previous one are ignored
 /*
  * Private Variables */
-static en_app_state_t gl_en_app_state = IDLE;
+static volatile en_app_state_t gl_en_app_state = IDLE;
 static en_app_sub_state_t gl_en_app_sub_state = ALL_OFF;
+static volatile boolean gl_bool_btn_pressed = FALSE;
+static uint64_t_ gl_u64_btn_last_press_ms = 0;
 
 static st_btn_config_t_ gl_st_user_btn_cfg = {
         .en_btn_port = USER_BTN_PORT,
@@ -62,7 +75,7 @@ static st_btn_config_t_ gl_st_user_btn_cfg = {
 };
 
 static void app_switch_state(void);
-static void app_systick_cb(void);
+static void app_btn_cb(void);
 
 /**
  * @brief                      : Initializes the required modules by the app
@@ -99,8 +112,12 @@ en_app_error_t app_init(void)
     en_systick_error = systick_init(&gl_st_systick_cfg_0);
     if(ST_OK != en_systick_error) en_app_error_retval = APP_FAIL;
 
-    en_systick_error = systick_set_callback(&app_systick_cb);
-    if(ST_OK != en_systick_error) en_app_error_retval = APP_FAIL;
+    // software timers for app level timeouts (the PWM runs on a GPT, no timer needed)
+    if(SW_TIMER_OK != sw_timer_init()) en_app_error_retval = APP_FAIL;
+
+    // button press is notified by interrupt, main loop sleeps in between
+    en_btn_status_code = btn_set_notification(&gl_st_user_btn_cfg, &app_btn_cb);
+    if(BTN_STATUS_OK != en_btn_status_code) en_app_error_retval = APP_FAIL;
 
     return en_app_error_retval;
 }
@@ -109,12 +126,11 @@ void app_start(void)
 {
     while(1)
     {
-        en_btn_state_t_ en_btn_state = BTN_STATE_NOT_PRESSED;
-        btn_read(&gl_st_user_btn_cfg, &en_btn_state);
-
-        if(BTN_STATE_PRESSED == en_btn_state)
+        if(TRUE == gl_bool_btn_pressed)
         {
-            if(ALL_LEDS == gl_en_app_sub_state)
+            gl_bool_btn_pressed = FALSE;
+
+            if(GREEN_90 == gl_en_app_sub_state)
             {
                 gl_en_app_sub_state = ALL_OFF;
             }
@@ -143,14 +159,6 @@ void app_start(void)
                 app_switch_state();
                 break;
             }
-            case TURNING_OFF:
-            {
-                led_off(RED_LED_PORT, RED_LED_PIN);
-                led_off(GREEN_LED_PORT, GREEN_LED_PIN);
-                led_off(BLUE_LED_PORT, BLUE_LED_PIN);
-                gl_en_app_state = IDLE;
-                break;
-            }
             case STATES_TOTAL:
             default:
             {
@@ -160,6 +168,24 @@ void app_start(void)
             }
         }
 
+        // nothing to do: sleep until the next software timer deadline or a button press
+        // (masked so a press right after the check still ends the sleep, it stays pending until then)
+        __disable_irq();
+        if(
+                (IDLE == gl_en_app_state) &&
+                (FALSE == gl_bool_btn_pressed)
+                )
+        {
+            uint64_t_ u64_wake_ms = SW_TIMER_NO_DEADLINE;
+
+            sw_timer_get_next_deadline(&u64_wake_ms);
+            systick_tickless_idle(u64_wake_ms);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        __enable_irq();
     }
 }
 
@@ -169,37 +195,24 @@ static void app_switch_state(void)
 
         case ALL_OFF:
         {
-            led_off(RED_LED_PORT, RED_LED_PIN);
-            led_off(GREEN_LED_PORT, GREEN_LED_PIN);
-            led_off(BLUE_LED_PORT, BLUE_LED_PIN);
-            break;
-        }
-        case RED_LED:
-        {
-            led_on(RED_LED_PORT, RED_LED_PIN);
-            systick_async_ms_delay(LED_BLINK_DURATION);
+            // hands the green pin back to GPIO, then all off in one write
+            led_set_brightness(GREEN_LED_PORT, GREEN_LED_PIN, ZERO);
+            led_group_write(RGB_LEDS_PORT, RGB_LEDS_MASK, ZERO);
             break;
         }
-        case GREEN_LED:
+        case GREEN_30:
         {
-            led_off(RED_LED_PORT, RED_LED_PIN);
-            led_on(GREEN_LED_PORT, GREEN_LED_PIN);
-            systick_async_ms_delay(LED_BLINK_DURATION);
+            led_set_brightness(GREEN_LED_PORT, GREEN_LED_PIN, GREEN_30_DUTY);
             break;
         }
-        case BLUE_LED:
+        case GREEN_60:
         {
-            led_off(GREEN_LED_PORT, GREEN_LED_PIN);
-            led_on(BLUE_LED_PORT, BLUE_LED_PIN);
-            systick_async_ms_delay(LED_BLINK_DURATION);
+            led_set_brightness(GREEN_LED_PORT, GREEN_LED_PIN, GREEN_60_DUTY);
             break;
         }
-        case ALL_LEDS:
+        case GREEN_90:
         {
-            led_on(RED_LED_PORT, RED_LED_PIN);
-            led_on(GREEN_LED_PORT, GREEN_LED_PIN);
-            led_on(BLUE_LED_PORT, BLUE_LED_PIN);
-            systick_async_ms_delay(LED_BLINK_DURATION);
+            led_set_brightness(GREEN_LED_PORT, GREEN_LED_PIN, GREEN_90_DUTY);
             break;
         }
         case SUB_STATES_TOTAL:
@@ -215,7 +228,18 @@ static void app_switch_state(void)
     gl_en_app_state = IDLE;
 }
 
-static void app_systick_cb(void)
+static void app_btn_cb(void)
 {
-    gl_en_app_state = TURNING_OFF;
+    uint64_t_ u64_now_ms = systick_now_ms();
+
+    if((u64_now_ms - gl_u64_btn_last_press_ms) >= BTN_DEBOUNCE_MS)
+    {
+        gl_u64_btn_last_press_ms = u64_now_ms;
+        gl_bool_btn_pressed = TRUE;
+    }
+    else
+    {
+        // contact bounce
+        /* Do Nothing */
+    }
 }
@@ -11,6 +11,32 @@
 #ifndef LED_H_
 #define LED_H_
 
+#include "std.h"
+#include "gpt_interface.h"
+
+/* LED pin mask, used with led_group_write */
+#define LED_PIN_MASK(PIN)   (1 << (PIN))
+
+/* led_set_brightness backends */
+#define LED_PWM_BACKEND_GPT     0   // timer CCP outputs, LED_PWM_PERIOD_US period
+#define LED_PWM_BACKEND_M1PWM   1   // PWM module 1 generators, frequency of gl_st_pwm_cfg_0 (flicker free)
+
+#ifndef LED_PWM_BACKEND
+#define LED_PWM_BACKEND     LED_PWM_BACKEND_GPT
+#endif
+
+/* PWM period used by led_set_brightness (GPT backend) */
+#define LED_PWM_PERIOD_US   500000
+#define LED_PWM_DUTY_MAX    1000    // permille
+
+/* Bit angle modulation (led_bam_*): bit n of the level drives the LED for 2^n LSBs of each period, the LSB is
+ * derived per GPIO_CHECKS build from the interrupt budget (led_program.c) */
+#define LED_BAM_BITS        8
+#define LED_BAM_LEVEL_MAX   ((1 << LED_BAM_BITS) - 1)
+
+// ports with BAM LEDs, every slot writes one bitplane per port (interrupt budget)
+#define LED_BAM_MAX_PORTS   2
+
 /* LED Pins */
 typedef enum{
     LED_PIN_0	=	0	,
@@ -87,4 +113,99 @@ en_led_error_t_ led_off(en_led_port_t_ en_a_led_port, en_led_pin_t_ en_a_led_pin
  */
 en_led_error_t_ led_toggle(en_led_port_t_ en_a_led_port, en_led_pin_t_ en_a_led_pin); // toggle LED
 
+/**
+ * @brief                       :   Writes a group of LEDs on the same port at once
+ *
+ * @param[in]   en_a_led_port    :   LEDs Port
+ * @param[in]   u8_a_leds_mask   :   Mask of the LEDs to update (use LED_PIN_MASK)
+ * @param[in]   u8_a_leds_val    :   On/Off value of each masked LED (bit set -> LED on)
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation
+ */
+en_led_error_t_ led_group_write(en_led_port_t_ en_a_led_port, uint8_t_ u8_a_leds_mask, uint8_t_ u8_a_leds_val);
+
+/**
+ * @brief                       :   Sets the brightness of an LED on a timer PWM capable pin
+ *
+ * @param[in]   en_a_led_port    :   LED Port
+ * @param[in]   en_a_led_pin     :   LED Pin number in en_a_led_port (PF1, PF2 or PF3)
+ * @param[in]   u16_a_duty_permille :   On time in 1/1000 of LED_PWM_PERIOD_US (0 -> off, 1000 -> fully on)
+ *
+ * @note                        :   The pin is driven by a GPT CCP output or an M1PWM generator (LED_PWM_BACKEND),
+ *                                  no CPU work per edge. GPT backend: 0 and 1000 hand the pin back to GPIO.
+ *                                  led_on/led_off/led_toggle have no effect while a pin is dimmed (M1PWM backend:
+ *                                  once dimmed), set 0 or 1000 first
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation (pin has no PWM output or duty above 1000)
+ */
+en_led_error_t_ led_set_brightness(en_led_port_t_ en_a_led_port, en_led_pin_t_ en_a_led_pin,
+                                   uint16_t_ u16_a_duty_permille);
+
+/**
+ * @brief                       :   Sets the bit angle modulation level of an LED (any port/pin)
+ *
+ * @param[in]   en_a_led_port    :   LED Port
+ * @param[in]   en_a_led_pin     :   LED Pin number in en_a_led_port (initialized by led_init)
+ * @param[in]   u8_a_level       :   Brightness level (0 -> off, LED_BAM_LEVEL_MAX -> fully on)
+ *
+ * @note                        :   The pin joins the BAM set on first use. Each period writes LED_BAM_BITS binary
+ *                                  weighted bitplanes, one precomputed store per port whatever the number of LEDs
+ *                                  (gpio_setPinsMasked in the checked build). The low bitplanes share one interrupt,
+ *                                  the others get one each. The new level starts with the next period.
+ *                                  led_on/led_off/led_toggle are overwritten by the next bitplane, led_bam_remove
+ *                                  hands the pin back
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation (or the pin would add a port beyond
+ *                                  LED_BAM_MAX_PORTS)
+ */
+en_led_error_t_ led_bam_set_level(en_led_port_t_ en_a_led_port, en_led_pin_t_ en_a_led_pin, uint8_t_ u8_a_level);
+
+/**
+ * @brief                       :   Drops an LED from the bit angle modulation set
+ *
+ * @param[in]   en_a_led_port    :   LED Port
+ * @param[in]   en_a_led_pin     :   LED Pin number in en_a_led_port
+ *
+ * @note                        :   The slots stop driving the pin from the next period, the pin is left at its
+ *                                  current level (led_off after the period to turn it off). The port costs no
+ *                                  store once its last LED is dropped
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation (pin not in the BAM set)
+ */
+en_led_error_t_ led_bam_remove(en_led_port_t_ en_a_led_port, en_led_pin_t_ en_a_led_pin);
+
+/**
+ * @brief                       :   Starts (or restarts) bit angle modulation of the LEDs given to led_bam_set_level
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation (timer channel could not be initialized)
+ */
+en_led_error_t_ led_bam_start(void);
+
+/**
+ * @brief                       :   Stops bit angle modulation, the LEDs keep their current level
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation (not started)
+ */
+en_led_error_t_ led_bam_stop(void);
+
+/**
+ * @brief                       :   Gets the longest slot interrupt callback run since led_bam_start
+ *
+ * @param[in]   ptr_u32_a_cycles :   Pointer to store the core cycles measured with DWT->CYCCNT, the timed wait
+ *                                  between the low bitplanes left out
+ *
+ * @note                        :   Checks the callback part of the interrupt budget on target, it must stay within
+ *                                  LED_BAM_CB_MAX_CYCLES (led_program.c) of the build's GPIO_CHECKS setting
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation (Invalid Arguments Given)
+ */
+en_led_error_t_ led_bam_get_isr_cycles(uint32_t_ * ptr_u32_a_cycles);
+
 #endif /* LED_H_ */
\ No newline at end of file
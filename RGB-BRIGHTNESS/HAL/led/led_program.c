@@ -12,6 +12,117 @@
 
 // private includes
 #include "gpio_interface.h"
+#include "gpio_fast.h"
+#include "gpt_interface.h"
+#include "TM4C123.h"
+#if LED_PWM_BACKEND == LED_PWM_BACKEND_M1PWM
+#include "pwm_interface.h"
+#include "pwm_linking_cfg.h"
+#endif
+
+// args are validated once by led_init when the GPIO checks are compiled out
+#if GPIO_CHECKS
+#define LED_ARGS_INVALID(PORT, PIN)     ((LED_PORT_TOTAL <= (PORT)) || (LED_PIN_TOTAL <= (PIN)))
+#define LED_PORT_INVALID(PORT)          (LED_PORT_TOTAL <= (PORT))
+#else
+#define LED_ARGS_INVALID(PORT, PIN)     FALSE
+#define LED_PORT_INVALID(PORT)          FALSE
+#endif
+
+// bit angle modulation timer channel (WTIMER1 A runs the software PWM engine)
+#define LED_BAM_GPT_TIMER               GPT_WTIMER_1
+#define LED_BAM_GPT_CHANNEL             GPT_CHANNEL_B
+
+// bitplanes 0 -> LED_BAM_LOW_BITS - 1 are written back to back in the first slot of the period, timed on the cycle
+// counter with the interrupts masked, the others get a slot each (6 interrupts per period)
+#define LED_BAM_LOW_BITS                3
+
+// interrupt budget in core cycles (= timer ticks, the timer runs on the system clock), derived per build from the
+// Cortex-M4 path, GPIO_FAST_WRITE_CYCLES per GPIO_CHECKS:
+//   before the callback: exception entry 12, gpt_irq_dispatch 30 (MIS, ICR and its read-back on the APB, callback
+//   lookup), a SysTick tick taken first 120 (priority 0, tick subscribers not included)
+//   callback: setup and cycle count samples 25, gpt_set_next_period 55 (checks, TnILR store), one bitplane (a store
+//   per port 5 + GPIO_FAST_WRITE_CYCLES), swap and return 20. The timed wait of the low bitplanes is not included,
+//   led_bam_get_isr_cycles measures this part on target
+#define LED_BAM_ISR_ENTRY_CYCLES        (12 + 30 + 120)
+#define LED_BAM_PLANE_CYCLES            (LED_BAM_MAX_PORTS * (5 + GPIO_FAST_WRITE_CYCLES))
+#define LED_BAM_CB_MAX_CYCLES           (25 + 55 + LED_BAM_PLANE_CYCLES + 20)
+#define LED_BAM_ISR_MAX_CYCLES          (LED_BAM_ISR_ENTRY_CYCLES + LED_BAM_CB_MAX_CYCLES)
+
+// the last low bitplane is written 2^(LOW_BITS - 1) - 1 LSBs into the first slot, the interrupt must be done within
+// the 2^(LOW_BITS - 1) LSBs left of it: 11 us at 8 MHz with GPIO_CHECKS=1 (2.8 ms period, ~356 Hz), 9 us with
+// GPIO_CHECKS=0 (2.3 ms, ~436 Hz)
+#define LED_BAM_LSB_DIV                 (GPT_CLOCK_MHZ << (LED_BAM_LOW_BITS - 1))
+#define LED_BAM_LSB_US                  ((LED_BAM_ISR_MAX_CYCLES + (LED_BAM_LSB_DIV - 1)) / LED_BAM_LSB_DIV)
+#define LED_BAM_LSB_TICKS               (LED_BAM_LSB_US * GPT_CLOCK_MHZ)
+
+#if LED_BAM_LSB_TICKS <= LED_BAM_PLANE_CYCLES
+#error "LED_BAM_MAX_PORTS bitplane stores do not fit in one LSB"
+#endif
+
+// core cycles from the first to the last low bitplane store
+#define LED_BAM_LOW_WAIT_TICKS          (((1UL << (LED_BAM_LOW_BITS - 1)) - 1) * LED_BAM_LSB_TICKS)
+
+// slot starting with a bitplane: the low bitplanes together, then 2^n LSBs
+#define LED_BAM_SLOT_TICKS(BIT)         ((ZERO == (BIT)) ? (((1UL << LED_BAM_LOW_BITS) - 1) * LED_BAM_LSB_TICKS) : \
+                                                           ((uint32_t_) LED_BAM_LSB_TICKS << (BIT)))
+
+// one period of bitplanes
+typedef struct{
+    uint8_t_ arr_u8_planes[LED_BAM_BITS][LED_PORT_TOTAL];  // LEDs on during the slot of each bit
+    uint8_t_ arr_u8_masks[LED_PORT_TOTAL];                 // BAM LEDs of each port
+    uint8_t_ arr_u8_ports[LED_PORT_TOTAL];                 // ports with BAM LEDs
+    uint8_t_ u8_ports;
+}st_led_bam_frame_t;
+
+static st_led_bam_frame_t gl_st_led_bam_latest;             // updated by led_bam_set_level
+static st_led_bam_frame_t gl_arr_st_led_bam_frames[2];      // double buffer read by the interrupt
+static volatile uint8_t_ gl_u8_led_bam_active = 0;
+static volatile boolean gl_bool_led_bam_pending = FALSE;
+static volatile uint8_t_ gl_u8_led_bam_bit = 0;             // bitplane starting at the coming time-out
+static volatile uint32_t_ gl_u32_led_bam_isr_max_cycles = 0;    // longest callback run, the timed wait left out
+static boolean gl_bool_led_bam_initialized = FALSE;
+static boolean gl_bool_led_bam_running = FALSE;
+
+static void led_bam_publish(void);
+static void led_bam_write_plane(const st_led_bam_frame_t * ptr_st_a_frame, uint8_t_ u8_a_bit);
+static void led_bam_timeout_cb(void * ptr_v_ctx);
+
+#if LED_PWM_BACKEND == LED_PWM_BACKEND_M1PWM
+// GPIOPCTL function of the M1PWMn outputs
+#define LED_PWM_ALT_FUNC                5
+
+// port F pins 1 -> 3 (RGB LEDs), indexed by pin number
+static const en_pwm_channel_t gl_arr_en_led_pwm_channels[LED_PIN_4] =
+{
+        PWM_CHANNEL_TOTAL,  /* PF0 : M1PWM4 is on the locked NMI pin */
+        PWM_CHANNEL_5,      /* PF1 : M1PWM5 */
+        PWM_CHANNEL_6,      /* PF2 : M1PWM6 */
+        PWM_CHANNEL_7,      /* PF3 : M1PWM7 */
+};
+static boolean gl_arr_bool_led_pwm[LED_PIN_4];      // pin routed to the generator output
+static boolean gl_bool_led_pwm_initialized = FALSE;
+#else
+// GPIOPCTL function of the timer CCP outputs
+#define LED_PWM_ALT_FUNC                7
+
+// timer CCP output of a PWM capable LED pin
+typedef struct{
+    en_gpt_timer_t en_timer;
+    en_gpt_channel_t en_channel;
+    boolean bool_initialized;       // GPT channel configured
+    boolean bool_pwm;               // pin routed to the CCP output
+}st_led_pwm_t;
+
+// port F pins 1 -> 3 (RGB LEDs), indexed by pin number
+static st_led_pwm_t gl_arr_st_led_pwm[LED_PIN_4] =
+{
+        {GPT_TIMER_TOTAL,   GPT_CHANNEL_A, FALSE, FALSE},   /* PF0 : no CCP */
+        {GPT_TIMER_0,       GPT_CHANNEL_B, FALSE, FALSE},   /* PF1 : T0CCP1 */
+        {GPT_TIMER_1,       GPT_CHANNEL_A, FALSE, FALSE},   /* PF2 : T1CCP0 */
+        {GPT_TIMER_1,       GPT_CHANNEL_B, FALSE, FALSE},   /* PF3 : T1CCP1 */
+};
+#endif
 
 /**
  * @brief                       :   Initializes LED on given port & pin
@@ -58,15 +169,15 @@ en_led_error_t_ led_init(en_led_port_t_ en_a_led_port, en_led_pin_t_ en_a_led_pi
 en_led_error_t_ led_on(en_led_port_t_ en_a_led_port, en_led_pin_t_ en_a_led_pin)
 {
     en_led_error_t_ en_led_error_retval = LED_OK;
-    if((LED_PORT_TOTAL <= en_a_led_port) || (LED_PIN_TOTAL <= en_a_led_pin))
+    if(LED_ARGS_INVALID(en_a_led_port, en_a_led_pin))
     {
         en_led_error_retval = LED_ERROR;
     }
     else
     {
-        en_gpio_error_t en_dio_error = gpio_setPinVal((en_gpio_port_t) en_a_led_port,
-                                                       (en_gpio_pin_t) en_a_led_pin,
-                                                       HIGH);
+        en_gpio_error_t en_dio_error = gpio_fast_writePins((en_gpio_port_t) en_a_led_port,
+                                                           LED_PIN_MASK(en_a_led_pin),
+                                                           PORT_SET);
 
         en_led_error_retval = (en_dio_error != GPIO_OK ? LED_ERROR : LED_OK);
     }
@@ -87,15 +198,15 @@ en_led_error_t_ led_off(en_led_port_t_ en_a_led_port, en_led_pin_t_ en_a_led_pin
 {
     en_led_error_t_ en_led_error_retval = LED_OK;
 
-    if((LED_PORT_TOTAL <= en_a_led_port) || (LED_PIN_TOTAL <= en_a_led_pin))
+    if(LED_ARGS_INVALID(en_a_led_port, en_a_led_pin))
     {
         en_led_error_retval = LED_ERROR;
     }
     else
     {
-        en_gpio_error_t en_dio_error = gpio_setPinVal((en_gpio_port_t) en_a_led_port,
-                                                       (en_gpio_pin_t) en_a_led_pin,
-                                                       LOW);
+        en_gpio_error_t en_dio_error = gpio_fast_writePins((en_gpio_port_t) en_a_led_port,
+                                                           LED_PIN_MASK(en_a_led_pin),
+                                                           PORT_CLR);
         en_led_error_retval = (en_dio_error != GPIO_OK ? LED_ERROR : LED_OK);
     }
 
@@ -115,16 +226,599 @@ en_led_error_t_ led_toggle(en_led_port_t_ en_a_led_port, en_led_pin_t_ en_a_led_
 {
     en_led_error_t_ en_led_error_retval = LED_OK;
 
-    if((LED_PORT_TOTAL <= en_a_led_port) || (LED_PIN_TOTAL <= en_a_led_pin))
+    if(LED_ARGS_INVALID(en_a_led_port, en_a_led_pin))
     {
         en_led_error_retval = LED_ERROR;
     }
     else
     {
-        en_gpio_error_t en_dio_error = gpio_togPinVal((en_gpio_port_t) en_a_led_port,
-                                                    (en_gpio_pin_t) en_a_led_pin);
+        en_gpio_error_t en_dio_error = gpio_fast_togglePins((en_gpio_port_t) en_a_led_port,
+                                                            LED_PIN_MASK(en_a_led_pin));
         en_led_error_retval = (en_dio_error != GPIO_OK ? LED_ERROR : LED_OK);
     }
 
     return en_led_error_retval;
 }
+
+/**
+ * @brief                       :   Writes a group of LEDs on the same port at once
+ *
+ * @param[in]   en_a_led_port    :   LEDs Port
+ * @param[in]   u8_a_leds_mask   :   Mask of the LEDs to update (use LED_PIN_MASK)
+ * @param[in]   u8_a_leds_val    :   On/Off value of each masked LED (bit set -> LED on)
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation
+ */
+en_led_error_t_ led_group_write(en_led_port_t_ en_a_led_port, uint8_t_ u8_a_leds_mask, uint8_t_ u8_a_leds_val)
+{
+    en_led_error_t_ en_led_error_retval = LED_OK;
+
+    if(LED_PORT_INVALID(en_a_led_port))
+    {
+        en_led_error_retval = LED_ERROR;
+    }
+    else
+    {
+        // all masked LEDs change together in one store
+        en_gpio_error_t en_dio_error = gpio_fast_writePins((en_gpio_port_t) en_a_led_port,
+                                                           u8_a_leds_mask,
+                                                           u8_a_leds_val);
+        en_led_error_retval = (en_dio_error != GPIO_OK ? LED_ERROR : LED_OK);
+    }
+
+    return en_led_error_retval;
+}
+
+#if LED_PWM_BACKEND == LED_PWM_BACKEND_M1PWM
+/**
+ * @brief                       :   Sets the brightness of an LED on a timer PWM capable pin
+ *
+ * @param[in]   en_a_led_port    :   LED Port
+ * @param[in]   en_a_led_pin     :   LED Pin number in en_a_led_port (PF1, PF2 or PF3)
+ * @param[in]   u16_a_duty_permille :   On time in 1/1000 of the M1PWM period (0 -> off, 1000 -> fully on)
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation (pin has no PWM output or duty above 1000)
+ */
+en_led_error_t_ led_set_brightness(en_led_port_t_ en_a_led_port, en_led_pin_t_ en_a_led_pin,
+                                   uint16_t_ u16_a_duty_permille)
+{
+    en_led_error_t_ en_led_error_retval = LED_OK;
+
+    if(
+            (LED_PORT_F != en_a_led_port) ||
+            (LED_PIN_4 <= en_a_led_pin) ||
+            (PWM_CHANNEL_TOTAL == gl_arr_en_led_pwm_channels[en_a_led_pin]) ||
+            (LED_PWM_DUTY_MAX < u16_a_duty_permille)
+            )
+    {
+        en_led_error_retval = LED_ERROR;
+    }
+    else
+    {
+        en_pwm_channel_t en_channel = gl_arr_en_led_pwm_channels[en_a_led_pin];
+        en_gpio_error_t en_dio_error = GPIO_OK;
+        en_pwm_error_t en_pwm_error = PWM_OK;
+
+        if(FALSE == gl_bool_led_pwm_initialized)
+        {
+            // all LED generators start together at 0% duty
+            en_pwm_error = pwm_init(&gl_st_pwm_cfg_0);
+            gl_bool_led_pwm_initialized = (PWM_OK == en_pwm_error);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        if(PWM_OK == en_pwm_error)
+        {
+            // 0 and 1000 are exact on the generator, the pin stays routed to it
+            en_pwm_error = pwm_set_duty(en_channel, (uint16_t_) ((((uint32_t_) u16_a_duty_permille * PWM_DUTY_FULL) +
+                                                                  (LED_PWM_DUTY_MAX / 2)) / LED_PWM_DUTY_MAX));
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        if(PWM_OK == en_pwm_error)
+        {
+            // latched on the next period boundary of all channels
+            en_pwm_error = pwm_update();
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        if(
+                (PWM_OK == en_pwm_error) &&
+                (FALSE == gl_arr_bool_led_pwm[en_a_led_pin])
+                )
+        {
+            st_gpio_cfg_t st_gpio_cfg_led = {
+                .port = (en_gpio_port_t) en_a_led_port,
+                .pin = (en_gpio_pin_t) en_a_led_pin,
+                .current = PIN_CURRENT_2MA,
+                .pin_cfg = ALT_FUNCTION,
+                .alt_func = LED_PWM_ALT_FUNC
+            };
+
+            en_dio_error = gpio_pin_init(&st_gpio_cfg_led);
+            gl_arr_bool_led_pwm[en_a_led_pin] = (GPIO_OK == en_dio_error);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        en_led_error_retval = ((PWM_OK == en_pwm_error) && (GPIO_OK == en_dio_error)) ? LED_OK : LED_ERROR;
+    }
+
+    return en_led_error_retval;
+}
+#else
+/**
+ * @brief                       :   Sets the brightness of an LED on a timer PWM capable pin
+ *
+ * @param[in]   en_a_led_port    :   LED Port
+ * @param[in]   en_a_led_pin     :   LED Pin number in en_a_led_port (PF1, PF2 or PF3)
+ * @param[in]   u16_a_duty_permille :   On time in 1/1000 of LED_PWM_PERIOD_US (0 -> off, 1000 -> fully on)
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation (pin has no PWM output or duty above 1000)
+ */
+en_led_error_t_ led_set_brightness(en_led_port_t_ en_a_led_port, en_led_pin_t_ en_a_led_pin,
+                                   uint16_t_ u16_a_duty_permille)
+{
+    en_led_error_t_ en_led_error_retval = LED_OK;
+
+    if(
+            (LED_PORT_F != en_a_led_port) ||
+            (LED_PIN_4 <= en_a_led_pin) ||
+            (GPT_TIMER_TOTAL == gl_arr_st_led_pwm[en_a_led_pin].en_timer) ||
+            (LED_PWM_DUTY_MAX < u16_a_duty_permille)
+            )
+    {
+        en_led_error_retval = LED_ERROR;
+    }
+    else
+    {
+        st_led_pwm_t * ptr_st_pwm = &gl_arr_st_led_pwm[en_a_led_pin];
+        st_gpio_cfg_t st_gpio_cfg_led = {
+            .port = (en_gpio_port_t) en_a_led_port,
+            .pin = (en_gpio_pin_t) en_a_led_pin,
+            .current = PIN_CURRENT_2MA,
+            .pin_cfg = OUTPUT
+        };
+        en_gpio_error_t en_dio_error = GPIO_OK;
+        en_gpt_error_t en_gpt_error = GPT_OK;
+
+        if((ZERO == u16_a_duty_permille) || (LED_PWM_DUTY_MAX == u16_a_duty_permille))
+        {
+            // constant level, the timer output can't reach a full 0 / 100 %
+            if(TRUE == ptr_st_pwm->bool_pwm)
+            {
+                en_gpt_error = gpt_stop(ptr_st_pwm->en_timer, ptr_st_pwm->en_channel);
+                en_dio_error = gpio_pin_init(&st_gpio_cfg_led);
+                ptr_st_pwm->bool_pwm = FALSE;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            if(GPIO_OK == en_dio_error)
+            {
+                en_dio_error = gpio_fast_writePins((en_gpio_port_t) en_a_led_port,
+                                                   LED_PIN_MASK(en_a_led_pin),
+                                                   (ZERO == u16_a_duty_permille) ? PORT_CLR : PORT_SET);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else if(TRUE == ptr_st_pwm->bool_pwm)
+        {
+            // running, the new duty is latched on the next period boundary
+            en_gpt_error = gpt_set_pwm_duty(ptr_st_pwm->en_timer, ptr_st_pwm->en_channel, u16_a_duty_permille);
+        }
+        else
+        {
+            if(FALSE == ptr_st_pwm->bool_initialized)
+            {
+                st_gpt_cfg_t st_gpt_cfg_led = {
+                    .en_gpt_timer = ptr_st_pwm->en_timer,
+                    .en_gpt_channel = ptr_st_pwm->en_channel,
+                    .en_gpt_width = GPT_WIDTH_INDIVIDUAL,
+                    .en_gpt_mode = GPT_MODE_PWM
+                };
+
+                en_gpt_error = gpt_init(&st_gpt_cfg_led);
+                ptr_st_pwm->bool_initialized = (GPT_OK == en_gpt_error);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            if(GPT_OK == en_gpt_error)
+            {
+                // duty first, the first period already runs at the requested brightness
+                en_gpt_error = gpt_set_pwm_duty(ptr_st_pwm->en_timer, ptr_st_pwm->en_channel, u16_a_duty_permille);
+
+                st_gpio_cfg_led.pin_cfg = ALT_FUNCTION;
+                st_gpio_cfg_led.alt_func = LED_PWM_ALT_FUNC;
+                en_dio_error = gpio_pin_init(&st_gpio_cfg_led);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            if(
+                    (GPT_OK == en_gpt_error) &&
+                    (GPIO_OK == en_dio_error)
+                    )
+            {
+                en_gpt_error = gpt_start(ptr_st_pwm->en_timer, ptr_st_pwm->en_channel,
+                                         LED_PWM_PERIOD_US, GPT_TIME_US);
+                ptr_st_pwm->bool_pwm = (GPT_OK == en_gpt_error);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+
+        en_led_error_retval = ((GPT_OK == en_gpt_error) && (GPIO_OK == en_dio_error)) ? LED_OK : LED_ERROR;
+    }
+
+    return en_led_error_retval;
+}
+#endif
+
+/**
+ * @brief                       :   Sets the bit angle modulation level of an LED (any port/pin)
+ *
+ * @param[in]   en_a_led_port    :   LED Port
+ * @param[in]   en_a_led_pin     :   LED Pin number in en_a_led_port (initialized by led_init)
+ * @param[in]   u8_a_level       :   Brightness level (0 -> off, LED_BAM_LEVEL_MAX -> fully on)
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation
+ */
+en_led_error_t_ led_bam_set_level(en_led_port_t_ en_a_led_port, en_led_pin_t_ en_a_led_pin, uint8_t_ u8_a_level)
+{
+    en_led_error_t_ en_led_error_retval = LED_OK;
+
+    if(
+            (LED_PORT_TOTAL <= en_a_led_port) ||
+            (LED_PIN_TOTAL <= en_a_led_pin) ||
+            (
+                    (ZERO == gl_st_led_bam_latest.arr_u8_masks[en_a_led_port]) &&
+                    (LED_BAM_MAX_PORTS <= gl_st_led_bam_latest.u8_ports)
+                    )
+            )
+    {
+        en_led_error_retval = LED_ERROR;
+    }
+    else
+    {
+        st_led_bam_frame_t * ptr_st_latest = &gl_st_led_bam_latest;
+        uint8_t_ u8_pin_mask = LED_PIN_MASK(en_a_led_pin);
+        uint8_t_ u8_bit;
+
+        if(ZERO == ptr_st_latest->arr_u8_masks[en_a_led_port])
+        {
+            // first LED of the port, one more store per bitplane
+            ptr_st_latest->arr_u8_ports[ptr_st_latest->u8_ports] = en_a_led_port;
+            ptr_st_latest->u8_ports++;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        ptr_st_latest->arr_u8_masks[en_a_led_port] |= u8_pin_mask;
+
+        // level bit n -> LED bit of plane n
+        for(u8_bit = ZERO; u8_bit < LED_BAM_BITS; u8_bit++)
+        {
+            if(GET_BIT(u8_a_level, u8_bit))
+            {
+                ptr_st_latest->arr_u8_planes[u8_bit][en_a_led_port] |= u8_pin_mask;
+            }
+            else
+            {
+                ptr_st_latest->arr_u8_planes[u8_bit][en_a_led_port] &= ~u8_pin_mask;
+            }
+        }
+
+        led_bam_publish();
+    }
+
+    return en_led_error_retval;
+}
+
+/**
+ * @brief                       :   Drops an LED from the bit angle modulation set
+ *
+ * @param[in]   en_a_led_port    :   LED Port
+ * @param[in]   en_a_led_pin     :   LED Pin number in en_a_led_port
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation (pin not in the BAM set)
+ */
+en_led_error_t_ led_bam_remove(en_led_port_t_ en_a_led_port, en_led_pin_t_ en_a_led_pin)
+{
+    en_led_error_t_ en_led_error_retval = LED_OK;
+
+    if(
+            (LED_PORT_TOTAL <= en_a_led_port) ||
+            (LED_PIN_TOTAL <= en_a_led_pin) ||
+            (ZERO == (gl_st_led_bam_latest.arr_u8_masks[en_a_led_port] & LED_PIN_MASK(en_a_led_pin)))
+            )
+    {
+        en_led_error_retval = LED_ERROR;
+    }
+    else
+    {
+        st_led_bam_frame_t * ptr_st_latest = &gl_st_led_bam_latest;
+        uint8_t_ u8_pin_mask = LED_PIN_MASK(en_a_led_pin);
+        uint8_t_ u8_bit;
+        uint8_t_ u8_idx;
+
+        ptr_st_latest->arr_u8_masks[en_a_led_port] &= ~u8_pin_mask;
+        for(u8_bit = ZERO; u8_bit < LED_BAM_BITS; u8_bit++)
+        {
+            ptr_st_latest->arr_u8_planes[u8_bit][en_a_led_port] &= ~u8_pin_mask;
+        }
+
+        if(ZERO == ptr_st_latest->arr_u8_masks[en_a_led_port])
+        {
+            // last LED of the port, move the last listed port into its place
+            for(u8_idx = ZERO; ptr_st_latest->arr_u8_ports[u8_idx] != en_a_led_port; u8_idx++)
+            {
+                /* Do Nothing */
+            }
+            ptr_st_latest->u8_ports--;
+            ptr_st_latest->arr_u8_ports[u8_idx] = ptr_st_latest->arr_u8_ports[ptr_st_latest->u8_ports];
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        led_bam_publish();
+    }
+
+    return en_led_error_retval;
+}
+
+/**
+ * @brief                       :   Publishes the latest levels through the spare frame, the interrupt swaps to it at
+ *                                  the next period start (at once when stopped)
+ */
+static void led_bam_publish(void)
+{
+    uint8_t_ u8_spare;
+
+    // withdraw a swap not taken yet, then publish through the spare buffer
+    gl_bool_led_bam_pending = FALSE;
+    u8_spare = gl_u8_led_bam_active ^ 1;
+    gl_arr_st_led_bam_frames[u8_spare] = gl_st_led_bam_latest;
+
+    if(TRUE == gl_bool_led_bam_running)
+    {
+        // the frames are not volatile, the spare must be complete before the interrupt can see the flag
+        __DMB();
+        gl_bool_led_bam_pending = TRUE;
+    }
+    else
+    {
+        gl_u8_led_bam_active = u8_spare;
+    }
+}
+
+/**
+ * @brief                       :   Starts (or restarts) bit angle modulation of the LEDs given to led_bam_set_level
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation (timer channel could not be initialized)
+ */
+en_led_error_t_ led_bam_start(void)
+{
+    en_led_error_t_ en_led_error_retval = LED_OK;
+
+    if(FALSE == gl_bool_led_bam_initialized)
+    {
+        st_gpt_cfg_t st_gpt_cfg_bam = {
+            .en_gpt_timer = LED_BAM_GPT_TIMER,
+            .en_gpt_channel = LED_BAM_GPT_CHANNEL,
+            .en_gpt_width = GPT_WIDTH_INDIVIDUAL,
+            .en_gpt_mode = GPT_MODE_PERIODIC
+        };
+
+        gl_bool_led_bam_initialized = (
+                (GPT_OK == gpt_init(&st_gpt_cfg_bam)) &&
+                (GPT_OK == gpt_set_callback(LED_BAM_GPT_TIMER, LED_BAM_GPT_CHANNEL, &led_bam_timeout_cb, NULL_PTR))
+                );
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    if(FALSE == gl_bool_led_bam_initialized)
+    {
+        en_led_error_retval = LED_ERROR;
+    }
+    else
+    {
+        gpt_stop(LED_BAM_GPT_TIMER, LED_BAM_GPT_CHANNEL);
+
+        // take the latest levels at once
+        gl_arr_st_led_bam_frames[gl_u8_led_bam_active] = gl_st_led_bam_latest;
+        gl_bool_led_bam_pending = FALSE;
+        gl_u8_led_bam_bit = ZERO;
+
+        // the low bitplanes are timed on the cycle counter
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        gl_u32_led_bam_isr_max_cycles = ZERO;
+
+        // first slot after one LSB, then the hardware loads each slot length on the time-out
+        gpt_start(LED_BAM_GPT_TIMER, LED_BAM_GPT_CHANNEL, LED_BAM_LSB_US, GPT_TIME_US);
+        gpt_set_next_period(LED_BAM_GPT_TIMER, LED_BAM_GPT_CHANNEL, LED_BAM_SLOT_TICKS(ZERO));
+
+        gl_bool_led_bam_running = TRUE;
+        gpt_enable_interrupt(LED_BAM_GPT_TIMER, LED_BAM_GPT_CHANNEL);
+    }
+
+    return en_led_error_retval;
+}
+
+/**
+ * @brief                       :   Stops bit angle modulation, the LEDs keep their current level
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation (not started)
+ */
+en_led_error_t_ led_bam_stop(void)
+{
+    en_led_error_t_ en_led_error_retval = LED_OK;
+
+    if(FALSE == gl_bool_led_bam_running)
+    {
+        en_led_error_retval = LED_ERROR;
+    }
+    else
+    {
+        gpt_disable_interrupt(LED_BAM_GPT_TIMER, LED_BAM_GPT_CHANNEL);
+        gpt_stop(LED_BAM_GPT_TIMER, LED_BAM_GPT_CHANNEL);
+        gl_bool_led_bam_running = FALSE;
+    }
+
+    return en_led_error_retval;
+}
+
+/**
+ * @brief                       :   Gets the longest slot interrupt callback run since led_bam_start
+ *
+ * @param[in]   ptr_u32_a_cycles :   Pointer to store the core cycles, the timed wait between the low bitplanes
+ *                                  left out
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation (Invalid Arguments Given)
+ */
+en_led_error_t_ led_bam_get_isr_cycles(uint32_t_ * ptr_u32_a_cycles)
+{
+    en_led_error_t_ en_led_error_retval = LED_OK;
+
+    if(NULL_PTR == ptr_u32_a_cycles)
+    {
+        en_led_error_retval = LED_ERROR;
+    }
+    else
+    {
+        *ptr_u32_a_cycles = gl_u32_led_bam_isr_max_cycles;
+    }
+
+    return en_led_error_retval;
+}
+
+/**
+ * @brief                       :   Writes one bitplane, a masked store per BAM port
+ *
+ * @param[in]   ptr_st_a_frame   :   Frame to write from
+ * @param[in]   u8_a_bit         :   Bitplane
+ */
+static void led_bam_write_plane(const st_led_bam_frame_t * ptr_st_a_frame, uint8_t_ u8_a_bit)
+{
+    uint8_t_ u8_idx;
+
+    for(u8_idx = ZERO; u8_idx < ptr_st_a_frame->u8_ports; u8_idx++)
+    {
+        uint8_t_ u8_port = ptr_st_a_frame->arr_u8_ports[u8_idx];
+
+        gpio_fast_writePins((en_gpio_port_t) u8_port, ptr_st_a_frame->arr_u8_masks[u8_port],
+                            ptr_st_a_frame->arr_u8_planes[u8_a_bit][u8_port]);
+    }
+}
+
+/**
+ * @brief                       :   Slot time-out, writes the bitplanes of the starting slot and queues the length of
+ *                                  the slot after it
+ *
+ * @param[in]   ptr_v_ctx        :   Unused
+ *
+ * @note                        :   The hardware already loaded this slot length on the time-out, slot timing does
+ *                                  not depend on the interrupt latency. The length of the slot after it is queued
+ *                                  before the bitplane stores, its deadline does not grow with the number of ports.
+ *                                  The first slot of the period writes the low bitplanes 2^n - 1 LSBs apart on the
+ *                                  cycle counter (timer ticks), with the interrupts masked for up to
+ *                                  LED_BAM_LOW_WAIT_TICKS so no handler stretches a bitplane
+ */
+static void led_bam_timeout_cb(void * ptr_v_ctx)
+{
+    uint32_t_ u32_entry_cycles = DWT->CYCCNT;
+    const st_led_bam_frame_t * ptr_st_frame = &gl_arr_st_led_bam_frames[gl_u8_led_bam_active];
+    uint8_t_ u8_bit = gl_u8_led_bam_bit;
+    uint8_t_ u8_next_bit = ((LED_BAM_BITS - 1) == u8_bit) ? ZERO :
+                           ((ZERO == u8_bit) ? LED_BAM_LOW_BITS : (u8_bit + 1));
+    uint32_t_ u32_cycles;
+
+    gpt_set_next_period(LED_BAM_GPT_TIMER, LED_BAM_GPT_CHANNEL, LED_BAM_SLOT_TICKS(u8_next_bit));
+
+    if(ZERO == u8_bit)
+    {
+        uint32_t_ u32_primask = __get_PRIMASK();
+        uint32_t_ u32_start_cycles;
+
+        __disable_irq();
+        u32_start_cycles = DWT->CYCCNT;
+
+        for(u8_bit = ZERO; u8_bit < LED_BAM_LOW_BITS; u8_bit++)
+        {
+            // bitplane n starts 2^n - 1 LSBs after bitplane 0
+            while((DWT->CYCCNT - u32_start_cycles) < (((1UL << u8_bit) - 1) * LED_BAM_LSB_TICKS));
+            led_bam_write_plane(ptr_st_frame, u8_bit);
+        }
+
+        __set_PRIMASK(u32_primask);
+
+        // the wait is not part of the budget
+        u32_entry_cycles += LED_BAM_LOW_WAIT_TICKS;
+    }
+    else
+    {
+        led_bam_write_plane(ptr_st_frame, u8_bit);
+    }
+
+    // the next slot starts a period, new levels take over from there
+    if((ZERO == u8_next_bit) && (TRUE == gl_bool_led_bam_pending))
+    {
+        gl_u8_led_bam_active ^= 1;
+        gl_bool_led_bam_pending = FALSE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    gl_u8_led_bam_bit = u8_next_bit;
+
+    // callback part of the interrupt budget
+    u32_cycles = DWT->CYCCNT - u32_entry_cycles;
+    if(u32_cycles > gl_u32_led_bam_isr_max_cycles)
+    {
+        gl_u32_led_bam_isr_max_cycles = u32_cycles;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
@@ -0,0 +1,126 @@
+/**
+ * @file    :   sw_pwm_interface.h
+ * @brief   :   Header File contains all software PWM functions' prototypes, typedefs and pre-configurations
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef SW_PWM_INTERFACE_H
+#define SW_PWM_INTERFACE_H
+
+#include "std.h"
+#include "gpio_interface.h"
+#include "gpt_interface.h"
+
+// max number of channels (static pool, no dynamic allocation)
+#define SW_PWM_MAX_CHANNELS     16
+
+// timer channel running the engine, periodic without prescaler (wide: 32-bit, up to ~8 min period)
+#define SW_PWM_GPT_TIMER        GPT_WTIMER_1
+#define SW_PWM_GPT_CHANNEL      GPT_CHANNEL_A
+
+// ports carrying channels, bounds the stores of one edge and so the interrupt budget (sw_pwm_program.c)
+#define SW_PWM_MAX_PORTS        2
+
+#define SW_PWM_DUTY_MAX         1000    // permille
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum{
+    SW_PWM_OK               =   0   ,
+    SW_PWM_INVALID_CONFIG           ,
+    SW_PWM_INVALID_ARGS             ,
+    SW_PWM_NO_FREE_CHANNEL          ,
+}en_sw_pwm_error_t;
+
+/**
+ * @brief                       : Initializes the software PWM engine on its timer channel
+ *
+ * @param u32_a_period_us       : PWM period of all channels
+ * @note                        : Every channel turns on at the period start and off at its duty, edges at the same
+ *                                time (within the interrupt budget, SW_PWM_MIN_EDGE_TICKS) share one interrupt
+ *                                with one store per port.
+ *                                Interrupts per period = distinct edge times, not channels
+ *
+ * @return  SW_PWM_OK               :   In case of Successful Operation
+ *          SW_PWM_INVALID_ARGS     :   In case of Failed Operation (Period shorter than 2 edges or above the timer)
+ *          SW_PWM_INVALID_CONFIG   :   In case the timer channel could not be initialized
+ */
+en_sw_pwm_error_t sw_pwm_init(uint32_t_ u32_a_period_us);
+
+
+/**
+ * @brief                       : Reserves a channel on a pin, the channel starts at 0% duty
+ *
+ * @param en_a_port             : Pin port
+ * @param en_a_pin              : Pin number
+ * @param ptr_u8_a_channel_id   : Pointer to store the created channel id
+ * @note                        : The pin must already be a GPIO output (e.g. led_init)
+ *
+ * @return  SW_PWM_OK               :   In case of Successful Operation
+ *          SW_PWM_INVALID_ARGS     :   In case of Failed Operation (Invalid Arguments Given or pin already used)
+ *          SW_PWM_NO_FREE_CHANNEL  :   In case all SW_PWM_MAX_CHANNELS channels are in use, or the pin would
+ *                                          add a port beyond SW_PWM_MAX_PORTS
+ */
+en_sw_pwm_error_t sw_pwm_create(en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin, uint8_t_ * ptr_u8_a_channel_id);
+
+
+/**
+ * @brief                       : Sets the duty cycle of a channel
+ *
+ * @param u8_a_channel_id       : Channel id returned by sw_pwm_create
+ * @param u16_a_duty_permille   : On time in 1/1000 of the period (0 -> off, 1000 -> fully on)
+ * @note                        : Rebuilds the edge schedule in the spare buffer, the engine swaps to it on the next
+ *                                period start (no torn period). On times within SW_PWM_MIN_EDGE_TICKS of
+ *                                either period end snap to 0 / 100 %
+ *
+ * @return  SW_PWM_OK               :   In case of Successful Operation
+ *          SW_PWM_INVALID_ARGS     :   In case of Failed Operation (Invalid Arguments Given)
+ */
+en_sw_pwm_error_t sw_pwm_set_duty(uint8_t_ u8_a_channel_id, uint16_t_ u16_a_duty_permille);
+
+
+/**
+ * @brief                       : Starts the engine, the first period starts one period later
+ *
+ * @return  SW_PWM_OK               :   In case of Successful Operation
+ *          SW_PWM_INVALID_CONFIG   :   In case of Failed Operation (Engine not initialized)
+ */
+en_sw_pwm_error_t sw_pwm_start(void);
+
+
+/**
+ * @brief                       : Stops the engine, the pins keep their current level
+ *
+ * @return  SW_PWM_OK               :   In case of Successful Operation
+ *          SW_PWM_INVALID_CONFIG   :   In case of Failed Operation (Engine not initialized)
+ */
+en_sw_pwm_error_t sw_pwm_stop(void);
+
+
+/**
+ * @brief                       : Gets the interrupts per period of the latest schedule
+ *
+ * @param ptr_u8_a_edges        : Pointer to store the number of distinct edge times
+ *
+ * @return  SW_PWM_OK               :   In case of Successful Operation
+ *          SW_PWM_INVALID_ARGS     :   In case of Failed Operation (Invalid Arguments Given)
+ */
+en_sw_pwm_error_t sw_pwm_get_edges(uint8_t_ * ptr_u8_a_edges);
+
+
+/**
+ * @brief                       : Gets the longest interrupt callback run since sw_pwm_start, up to its reload store
+ *
+ * @param ptr_u32_a_cycles      : Pointer to store the core cycles measured with DWT->CYCCNT
+ * @note                        : Checks the callback part of the interrupt budget on target, it must stay within
+ *                                SW_PWM_CB_MAX_CYCLES (sw_pwm_program.c) of the build's GPIO_CHECKS setting
+ *
+ * @return  SW_PWM_OK               :   In case of Successful Operation
+ *          SW_PWM_INVALID_ARGS     :   In case of Failed Operation (Invalid Arguments Given)
+ */
+en_sw_pwm_error_t sw_pwm_get_isr_cycles(uint32_t_ * ptr_u32_a_cycles);
+
+#endif //SW_PWM_INTERFACE_H
@@ -0,0 +1,573 @@
+/**
+ * @file    :   sw_pwm_program.c
+ * @brief   :   Program File contains all software PWM functions' implementation
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+/*----------------------------------------------------------/
+/- INCLUDES
+/----------------------------------------------------------*/
+#include "sw_pwm_interface.h"
+#include "gpio_fast.h"
+#include "TM4C123.h"
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+// the period start plus one off edge per channel
+#define SW_PWM_MAX_EDGES        (SW_PWM_MAX_CHANNELS + 1)
+
+// one store per port at the period start, one per channel at most for the off edges
+#define SW_PWM_MAX_STORES       (SW_PWM_MAX_CHANNELS * 2)
+
+// interrupt budget: core cycles (= timer ticks, the timer runs on the system clock) from a time-out to the reload
+// store of sw_pwm_timeout_cb. The next interval must be queued before the running one ends, else the hardware
+// latches the stale reload. Derived per build from the Cortex-M4 path, GPIO_FAST_WRITE_CYCLES per GPIO_CHECKS:
+//   before the callback: exception entry 12, gpt_irq_dispatch 30 (MIS, ICR and its read-back on the APB, callback
+//   lookup), a SysTick tick taken first 120 (priority 0, tick subscribers not included)
+//   callback: setup and cycle count samples 28, a store per port 5 + GPIO_FAST_WRITE_CYCLES, next edge / swap 15,
+//   gpt_set_next_period 55 (checks, TnILR store). sw_pwm_get_isr_cycles measures this part on target
+#define SW_PWM_ISR_ENTRY_CYCLES (12 + 30 + 120)
+#define SW_PWM_CB_MAX_CYCLES    (28 + (SW_PWM_MAX_PORTS * (5 + GPIO_FAST_WRITE_CYCLES)) + 15 + 55)
+#define SW_PWM_ISR_MAX_CYCLES   (SW_PWM_ISR_ENTRY_CYCLES + SW_PWM_CB_MAX_CYCLES)
+
+// edges closer than the interrupt budget share one interrupt (2 ports at 8 MHz: 41.25 us checked, 35.25 us bare)
+#define SW_PWM_MIN_EDGE_TICKS   SW_PWM_ISR_MAX_CYCLES
+
+// 32-bit counter of the wide timer channel, no prescaler
+#define SW_PWM_MAX_PERIOD_US    (0xFFFFFFFFUL / GPT_CLOCK_MHZ)
+
+/*---------------------------------------------------------/
+/- LOCAL TYPEDEFS
+/---------------------------------------------------------*/
+typedef struct{
+    uint8_t_    u8_port;
+    uint8_t_    u8_pin;
+    uint16_t_   u16_duty_permille;
+    boolean     bool_allocated;
+}st_sw_pwm_channel_t;
+
+// masked write of the pins of one port
+typedef struct{
+    uint8_t_    u8_port;
+    uint8_t_    u8_mask;
+    uint8_t_    u8_value;
+}st_sw_pwm_store_t;
+
+// stores due at the same time
+typedef struct{
+    uint32_t_   u32_ticks_after;    // time to the next edge (the last edge: to the period end)
+    uint8_t_    u8_first_store;
+    uint8_t_    u8_stores;
+}st_sw_pwm_edge_t;
+
+typedef struct{
+    st_sw_pwm_edge_t    arr_st_edges[SW_PWM_MAX_EDGES];
+    st_sw_pwm_store_t   arr_st_stores[SW_PWM_MAX_STORES];
+    uint8_t_            u8_edges;
+}st_sw_pwm_schedule_t;
+
+/*---------------------------------------------------------/
+/- LOCAL VARIABLES
+/---------------------------------------------------------*/
+static boolean gl_bool_sw_pwm_initialized = FALSE;
+static boolean gl_bool_sw_pwm_running = FALSE;
+static uint32_t_ gl_u32_sw_pwm_period_ticks = 0;
+static uint8_t_ gl_u8_sw_pwm_edges = 0;             // edges of the latest schedule
+
+static st_sw_pwm_channel_t gl_arr_st_sw_pwm_channels[SW_PWM_MAX_CHANNELS];
+
+// double buffered schedule, the interrupt only reads the active one and swaps on the period start
+static st_sw_pwm_schedule_t gl_arr_st_sw_pwm_schedules[2];
+static volatile uint8_t_ gl_u8_sw_pwm_active = 0;
+static volatile boolean gl_bool_sw_pwm_pending = FALSE;
+static volatile uint8_t_ gl_u8_sw_pwm_edge = 0;     // edge due at the coming time-out
+static volatile uint32_t_ gl_u32_sw_pwm_isr_max_cycles = 0;     // longest callback run up to the reload store
+
+/*---------------------------------------------------------/
+/- LOCAL FUNCTIONS PROTOTYPES
+/---------------------------------------------------------*/
+static void sw_pwm_build(st_sw_pwm_schedule_t * ptr_st_a_schedule);
+static void sw_pwm_timeout_cb(void * ptr_v_ctx);
+
+/*---------------------------------------------------------/
+/- APIs IMPLEMENTATION
+/---------------------------------------------------------*/
+en_sw_pwm_error_t sw_pwm_init(uint32_t_ u32_a_period_us)
+{
+    en_sw_pwm_error_t en_sw_pwm_error_retval = SW_PWM_OK;
+
+    if(
+            (u32_a_period_us > SW_PWM_MAX_PERIOD_US) ||
+            ((u32_a_period_us * GPT_CLOCK_MHZ) < (2 * SW_PWM_MIN_EDGE_TICKS))
+            )
+    {
+        en_sw_pwm_error_retval = SW_PWM_INVALID_ARGS;
+    }
+    else
+    {
+        st_gpt_cfg_t st_gpt_cfg_sw_pwm = {
+                .en_gpt_timer   = SW_PWM_GPT_TIMER,
+                .en_gpt_channel = SW_PWM_GPT_CHANNEL,
+                .en_gpt_width   = GPT_WIDTH_INDIVIDUAL,
+                .en_gpt_mode    = GPT_MODE_PERIODIC
+        };
+
+        if(
+                (GPT_OK != gpt_init(&st_gpt_cfg_sw_pwm)) ||
+                (GPT_OK != gpt_set_callback(SW_PWM_GPT_TIMER, SW_PWM_GPT_CHANNEL, &sw_pwm_timeout_cb, NULL_PTR))
+                )
+        {
+            en_sw_pwm_error_retval = SW_PWM_INVALID_CONFIG;
+        }
+        else
+        {
+            gl_u32_sw_pwm_period_ticks = u32_a_period_us * GPT_CLOCK_MHZ;
+            gl_bool_sw_pwm_running = FALSE;
+            gl_bool_sw_pwm_initialized = TRUE;
+        }
+    }
+
+    return en_sw_pwm_error_retval;
+}
+
+en_sw_pwm_error_t sw_pwm_create(en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin, uint8_t_ * ptr_u8_a_channel_id)
+{
+    en_sw_pwm_error_t en_sw_pwm_error_retval = SW_PWM_NO_FREE_CHANNEL;
+    uint8_t_ u8_free = SW_PWM_MAX_CHANNELS;
+    uint8_t_ u8_ports_mask = 0;     // ports carrying channels
+    uint8_t_ u8_ports = 0;
+    uint8_t_ u8_id;
+
+    if(
+            (en_a_port >= GPIO_PORT_TOTAL) ||
+            (en_a_pin >= GPIO_PIN_TOTAL) ||
+            (NULL_PTR == ptr_u8_a_channel_id)
+            )
+    {
+        en_sw_pwm_error_retval = SW_PWM_INVALID_ARGS;
+    }
+    else
+    {
+        for(u8_id = 0; u8_id < SW_PWM_MAX_CHANNELS; u8_id++)
+        {
+            if(FALSE == gl_arr_st_sw_pwm_channels[u8_id].bool_allocated)
+            {
+                u8_free = (SW_PWM_MAX_CHANNELS == u8_free) ? u8_id : u8_free;
+            }
+            else if(
+                    (en_a_port == gl_arr_st_sw_pwm_channels[u8_id].u8_port) &&
+                    (en_a_pin == gl_arr_st_sw_pwm_channels[u8_id].u8_pin)
+                    )
+            {
+                // one channel per pin, the edge stores of a port assume it
+                en_sw_pwm_error_retval = SW_PWM_INVALID_ARGS;
+            }
+            else if(!GET_BIT(u8_ports_mask, gl_arr_st_sw_pwm_channels[u8_id].u8_port))
+            {
+                SET_BIT(u8_ports_mask, gl_arr_st_sw_pwm_channels[u8_id].u8_port);
+                u8_ports++;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+
+        // a new port adds a store to the edges, the interrupt budget holds SW_PWM_MAX_PORTS
+        if(
+                (SW_PWM_INVALID_ARGS != en_sw_pwm_error_retval) &&
+                (!GET_BIT(u8_ports_mask, en_a_port)) &&
+                (SW_PWM_MAX_PORTS <= u8_ports)
+                )
+        {
+            u8_free = SW_PWM_MAX_CHANNELS;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        if(
+                (SW_PWM_INVALID_ARGS != en_sw_pwm_error_retval) &&
+                (SW_PWM_MAX_CHANNELS != u8_free)
+                )
+        {
+            gl_arr_st_sw_pwm_channels[u8_free].u8_port = (uint8_t_) en_a_port;
+            gl_arr_st_sw_pwm_channels[u8_free].u8_pin = (uint8_t_) en_a_pin;
+            gl_arr_st_sw_pwm_channels[u8_free].u16_duty_permille = 0;
+            gl_arr_st_sw_pwm_channels[u8_free].bool_allocated = TRUE;
+
+            *ptr_u8_a_channel_id = u8_free;
+            en_sw_pwm_error_retval = SW_PWM_OK;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    return en_sw_pwm_error_retval;
+}
+
+en_sw_pwm_error_t sw_pwm_set_duty(uint8_t_ u8_a_channel_id, uint16_t_ u16_a_duty_permille)
+{
+    en_sw_pwm_error_t en_sw_pwm_error_retval = SW_PWM_OK;
+
+    if(
+            (u8_a_channel_id >= SW_PWM_MAX_CHANNELS) ||
+            (u16_a_duty_permille > SW_PWM_DUTY_MAX) ||
+            (FALSE == gl_arr_st_sw_pwm_channels[u8_a_channel_id].bool_allocated)
+            )
+    {
+        en_sw_pwm_error_retval = SW_PWM_INVALID_ARGS;
+    }
+    else
+    {
+        uint8_t_ u8_spare;
+
+        gl_arr_st_sw_pwm_channels[u8_a_channel_id].u16_duty_permille = u16_a_duty_permille;
+
+        // withdraw a swap not taken yet, the spare buffer is then free to rebuild
+        gl_bool_sw_pwm_pending = FALSE;
+        u8_spare = gl_u8_sw_pwm_active ^ 1;
+
+        sw_pwm_build(&gl_arr_st_sw_pwm_schedules[u8_spare]);
+
+        if(TRUE == gl_bool_sw_pwm_running)
+        {
+            // the schedule is not volatile, it must be complete before the interrupt can see the flag
+            __DMB();
+            gl_bool_sw_pwm_pending = TRUE;
+        }
+        else
+        {
+            gl_u8_sw_pwm_active = u8_spare;
+        }
+    }
+
+    return en_sw_pwm_error_retval;
+}
+
+en_sw_pwm_error_t sw_pwm_start(void)
+{
+    en_sw_pwm_error_t en_sw_pwm_error_retval = SW_PWM_OK;
+
+    if(FALSE == gl_bool_sw_pwm_initialized)
+    {
+        en_sw_pwm_error_retval = SW_PWM_INVALID_CONFIG;
+    }
+    else
+    {
+        st_sw_pwm_schedule_t * ptr_st_schedule = &gl_arr_st_sw_pwm_schedules[gl_u8_sw_pwm_active];
+
+        gpt_stop(SW_PWM_GPT_TIMER, SW_PWM_GPT_CHANNEL);
+
+        sw_pwm_build(ptr_st_schedule);
+        gl_bool_sw_pwm_pending = FALSE;
+        gl_u8_sw_pwm_edge = 0;
+
+        // the callback times itself on the cycle counter
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        gl_u32_sw_pwm_isr_max_cycles = 0;
+
+        // first time-out after one period, then the hardware loads each next interval on the time-out
+        gpt_start(SW_PWM_GPT_TIMER, SW_PWM_GPT_CHANNEL, gl_u32_sw_pwm_period_ticks / GPT_CLOCK_MHZ, GPT_TIME_US);
+        gpt_set_next_period(SW_PWM_GPT_TIMER, SW_PWM_GPT_CHANNEL, ptr_st_schedule->arr_st_edges[0].u32_ticks_after);
+
+        gl_bool_sw_pwm_running = TRUE;
+        gpt_enable_interrupt(SW_PWM_GPT_TIMER, SW_PWM_GPT_CHANNEL);
+    }
+
+    return en_sw_pwm_error_retval;
+}
+
+en_sw_pwm_error_t sw_pwm_stop(void)
+{
+    en_sw_pwm_error_t en_sw_pwm_error_retval = SW_PWM_OK;
+
+    if(FALSE == gl_bool_sw_pwm_initialized)
+    {
+        en_sw_pwm_error_retval = SW_PWM_INVALID_CONFIG;
+    }
+    else
+    {
+        gpt_disable_interrupt(SW_PWM_GPT_TIMER, SW_PWM_GPT_CHANNEL);
+        gpt_stop(SW_PWM_GPT_TIMER, SW_PWM_GPT_CHANNEL);
+
+        // a swap still pending is taken now
+        if(TRUE == gl_bool_sw_pwm_pending)
+        {
+            gl_u8_sw_pwm_active ^= 1;
+            gl_bool_sw_pwm_pending = FALSE;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        gl_bool_sw_pwm_running = FALSE;
+    }
+
+    return en_sw_pwm_error_retval;
+}
+
+en_sw_pwm_error_t sw_pwm_get_edges(uint8_t_ * ptr_u8_a_edges)
+{
+    en_sw_pwm_error_t en_sw_pwm_error_retval = SW_PWM_OK;
+
+    if(NULL_PTR == ptr_u8_a_edges)
+    {
+        en_sw_pwm_error_retval = SW_PWM_INVALID_ARGS;
+    }
+    else
+    {
+        *ptr_u8_a_edges = gl_u8_sw_pwm_edges;
+    }
+
+    return en_sw_pwm_error_retval;
+}
+
+en_sw_pwm_error_t sw_pwm_get_isr_cycles(uint32_t_ * ptr_u32_a_cycles)
+{
+    en_sw_pwm_error_t en_sw_pwm_error_retval = SW_PWM_OK;
+
+    if(NULL_PTR == ptr_u32_a_cycles)
+    {
+        en_sw_pwm_error_retval = SW_PWM_INVALID_ARGS;
+    }
+    else
+    {
+        *ptr_u32_a_cycles = gl_u32_sw_pwm_isr_max_cycles;
+    }
+
+    return en_sw_pwm_error_retval;
+}
+
+/*---------------------------------------------------------/
+/- LOCAL FUNCTIONS IMPLEMENTATION
+/---------------------------------------------------------*/
+/**
+ * @brief                       : Builds the edge schedule of the current duties
+ *
+ * @param ptr_st_a_schedule     : Schedule to fill (not in use by the interrupt)
+ *
+ * @note                        : Edge 0 (period start) drives every channel pin of each port at once: on, or off for
+ *                                0% channels. Off edges follow sorted by time, channels closer than
+ *                                SW_PWM_MIN_EDGE_TICKS to the previous edge join it, one store per port and edge
+ */
+static void sw_pwm_build(st_sw_pwm_schedule_t * ptr_st_a_schedule)
+{
+    uint32_t_ arr_u32_off_ticks[SW_PWM_MAX_CHANNELS];
+    uint8_t_ arr_u8_order[SW_PWM_MAX_CHANNELS];     // channels with an off edge, sorted by time
+    uint32_t_ arr_u32_edge_ticks[SW_PWM_MAX_EDGES];
+    uint8_t_ u8_offs = 0;
+    uint8_t_ u8_stores = 0;
+    uint8_t_ u8_edge = 0;
+    uint8_t_ u8_id;
+    uint8_t_ u8_idx;
+
+    // 1. Period start, one store per used port
+    ptr_st_a_schedule->arr_st_edges[0].u8_first_store = 0;
+    arr_u32_edge_ticks[0] = 0;
+
+    for(u8_id = 0; u8_id < SW_PWM_MAX_CHANNELS; u8_id++)
+    {
+        const st_sw_pwm_channel_t * ptr_st_channel = &gl_arr_st_sw_pwm_channels[u8_id];
+
+        if(TRUE == ptr_st_channel->bool_allocated)
+        {
+            uint32_t_ u32_on_ticks = (uint32_t_) (((uint64_t_) gl_u32_sw_pwm_period_ticks *
+                                                   ptr_st_channel->u16_duty_permille) / SW_PWM_DUTY_MAX);
+            st_sw_pwm_store_t * ptr_st_store = NULL_PTR;
+            boolean bool_on = (u32_on_ticks >= SW_PWM_MIN_EDGE_TICKS);
+
+            for(u8_idx = 0; u8_idx < u8_stores; u8_idx++)
+            {
+                if(ptr_st_a_schedule->arr_st_stores[u8_idx].u8_port == ptr_st_channel->u8_port)
+                {
+                    ptr_st_store = &ptr_st_a_schedule->arr_st_stores[u8_idx];
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+            }
+
+            if(NULL_PTR == ptr_st_store)
+            {
+                ptr_st_store = &ptr_st_a_schedule->arr_st_stores[u8_stores++];
+                ptr_st_store->u8_port = ptr_st_channel->u8_port;
+                ptr_st_store->u8_mask = 0;
+                ptr_st_store->u8_value = 0;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            ptr_st_store->u8_mask |= (1 << ptr_st_channel->u8_pin);
+
+            if(TRUE == bool_on)
+            {
+                ptr_st_store->u8_value |= (1 << ptr_st_channel->u8_pin);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            // 2. Insert the off edge sorted by time (none for 0%, or on up to the period end)
+            if(
+                    (TRUE == bool_on) &&
+                    (u32_on_ticks <= (gl_u32_sw_pwm_period_ticks - SW_PWM_MIN_EDGE_TICKS))
+                    )
+            {
+                arr_u32_off_ticks[u8_id] = u32_on_ticks;
+
+                for(u8_idx = u8_offs; (u8_idx > 0) && (arr_u32_off_ticks[arr_u8_order[u8_idx - 1]] > u32_on_ticks); u8_idx--)
+                {
+                    arr_u8_order[u8_idx] = arr_u8_order[u8_idx - 1];
+                }
+                arr_u8_order[u8_idx] = u8_id;
+                u8_offs++;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    ptr_st_a_schedule->arr_st_edges[0].u8_stores = u8_stores;
+
+    // 3. Off edges, merged with the previous edge when closer than the interrupt budget
+    for(u8_idx = 0; u8_idx < u8_offs; u8_idx++)
+    {
+        const st_sw_pwm_channel_t * ptr_st_channel = &gl_arr_st_sw_pwm_channels[arr_u8_order[u8_idx]];
+        st_sw_pwm_edge_t * ptr_st_edge = &ptr_st_a_schedule->arr_st_edges[u8_edge];
+        uint32_t_ u32_off_ticks = arr_u32_off_ticks[arr_u8_order[u8_idx]];
+        st_sw_pwm_store_t * ptr_st_store = NULL_PTR;
+        uint8_t_ u8_store;
+
+        if((u32_off_ticks - arr_u32_edge_ticks[u8_edge]) >= SW_PWM_MIN_EDGE_TICKS)
+        {
+            u8_edge++;
+            ptr_st_edge = &ptr_st_a_schedule->arr_st_edges[u8_edge];
+            ptr_st_edge->u8_first_store = u8_stores;
+            ptr_st_edge->u8_stores = 0;
+            arr_u32_edge_ticks[u8_edge] = u32_off_ticks;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        for(u8_store = ptr_st_edge->u8_first_store; u8_store < u8_stores; u8_store++)
+        {
+            if(ptr_st_a_schedule->arr_st_stores[u8_store].u8_port == ptr_st_channel->u8_port)
+            {
+                ptr_st_store = &ptr_st_a_schedule->arr_st_stores[u8_store];
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+
+        if(NULL_PTR == ptr_st_store)
+        {
+            ptr_st_store = &ptr_st_a_schedule->arr_st_stores[u8_stores++];
+            ptr_st_store->u8_port = ptr_st_channel->u8_port;
+            ptr_st_store->u8_mask = 0;
+            ptr_st_store->u8_value = 0;
+            ptr_st_edge->u8_stores++;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        // off: masked in with a 0 value
+        ptr_st_store->u8_mask |= (1 << ptr_st_channel->u8_pin);
+        ptr_st_store->u8_value &= ~(1 << ptr_st_channel->u8_pin);
+    }
+
+    // 4. Intervals between edges, the last one runs to the period end
+    ptr_st_a_schedule->u8_edges = u8_edge + 1;
+    for(u8_idx = 0; u8_idx < u8_edge; u8_idx++)
+    {
+        ptr_st_a_schedule->arr_st_edges[u8_idx].u32_ticks_after = arr_u32_edge_ticks[u8_idx + 1] - arr_u32_edge_ticks[u8_idx];
+    }
+    ptr_st_a_schedule->arr_st_edges[u8_edge].u32_ticks_after = gl_u32_sw_pwm_period_ticks - arr_u32_edge_ticks[u8_edge];
+
+    gl_u8_sw_pwm_edges = ptr_st_a_schedule->u8_edges;
+}
+
+/**
+ * @brief                       : Timer time-out, runs the due edge and queues the interval after the next one
+ *
+ * @param ptr_v_ctx             : Unused
+ *
+ * @note                        : The hardware already loaded the interval to the next edge on this time-out, so
+ *                                edge timing does not depend on the interrupt latency
+ */
+static void sw_pwm_timeout_cb(void * ptr_v_ctx)
+{
+    uint32_t_ u32_entry_cycles = DWT->CYCCNT;
+    const st_sw_pwm_schedule_t * ptr_st_schedule = &gl_arr_st_sw_pwm_schedules[gl_u8_sw_pwm_active];
+    const st_sw_pwm_edge_t * ptr_st_edge = &ptr_st_schedule->arr_st_edges[gl_u8_sw_pwm_edge];
+    const st_sw_pwm_store_t * ptr_st_store = &ptr_st_schedule->arr_st_stores[ptr_st_edge->u8_first_store];
+    uint8_t_ u8_store;
+    uint8_t_ u8_next;
+    uint32_t_ u32_cycles;
+
+    // one masked store per port
+    for(u8_store = 0; u8_store < ptr_st_edge->u8_stores; u8_store++)
+    {
+        gpio_fast_writePins((en_gpio_port_t) ptr_st_store[u8_store].u8_port,
+                            ptr_st_store[u8_store].u8_mask, ptr_st_store[u8_store].u8_value);
+    }
+
+    u8_next = gl_u8_sw_pwm_edge + 1;
+    if(u8_next >= ptr_st_schedule->u8_edges)
+    {
+        // the next time-out starts a period, a rebuilt schedule takes over from there
+        u8_next = 0;
+        if(TRUE == gl_bool_sw_pwm_pending)
+        {
+            gl_u8_sw_pwm_active ^= 1;
+            gl_bool_sw_pwm_pending = FALSE;
+            ptr_st_schedule = &gl_arr_st_sw_pwm_schedules[gl_u8_sw_pwm_active];
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    gl_u8_sw_pwm_edge = u8_next;
+    gpt_set_next_period(SW_PWM_GPT_TIMER, SW_PWM_GPT_CHANNEL, ptr_st_schedule->arr_st_edges[u8_next].u32_ticks_after);
+
+    // callback part of the interrupt budget
+    u32_cycles = DWT->CYCCNT - u32_entry_cycles;
+    if(u32_cycles > gl_u32_sw_pwm_isr_max_cycles)
+    {
+        gl_u32_sw_pwm_isr_max_cycles = u32_cycles;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
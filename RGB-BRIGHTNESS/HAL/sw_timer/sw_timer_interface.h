@@ -0,0 +1,129 @@
+/**
+ * @file    :   sw_timer_interface.h
+ * @brief   :   Header File contains all software timer functions' prototypes, typedefs and pre-configurations
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef SW_TIMER_INTERFACE_H
+#define SW_TIMER_INTERFACE_H
+
+#include "std.h"
+
+// max number of timers that can be created (static pool, no dynamic allocation), ids are 16-bit
+#ifndef SW_TIMER_MAX_TIMERS
+    #define SW_TIMER_MAX_TIMERS     32
+#endif
+
+#if SW_TIMER_MAX_TIMERS >= 0xFFFF
+    #error SW_TIMER_MAX_TIMERS must leave 0xFFFF free (stopped timer marker)
+#endif
+
+// timer queue implementation
+#define SW_TIMER_QUEUE_HEAP     0   // binary min-heap, O(log n) start/stop
+#define SW_TIMER_QUEUE_WHEEL    1   // hierarchical timing wheel, O(1) start/stop/expiry (1 ms resolution)
+
+#ifndef SW_TIMER_QUEUE
+    #define SW_TIMER_QUEUE      SW_TIMER_QUEUE_WHEEL
+#endif
+
+// next deadline reported when no timer is running
+#define SW_TIMER_NO_DEADLINE    0xFFFFFFFFFFFFFFFFULL
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum{
+    /* expires once, then stays stopped until started again */
+    SW_TIMER_ONE_SHOT   =   0   ,
+
+    /* re-armed automatically with the same period on every expiry */
+    SW_TIMER_PERIODIC           ,
+
+    SW_TIMER_MODE_TOTAL
+}en_sw_timer_mode_t;
+
+typedef enum{
+    SW_TIMER_OK             =   0   ,
+    SW_TIMER_INVALID_CONFIG         ,
+    SW_TIMER_INVALID_ARGS           ,
+    SW_TIMER_NO_FREE_TIMER          ,
+}en_sw_timer_error_t;
+
+typedef void (*fun_sw_timer_cb_t)(void * ptr_v_ctx);
+
+/**
+ * @brief                       : Initializes the software timer service on top of the systick free running tick
+ *
+ * @note                        : Systick must be initialized in free running mode before calling
+ *
+ * @return  SW_TIMER_OK             :   In case of Successful Operation
+ *          SW_TIMER_INVALID_CONFIG :   In case systick is not running in free running mode
+ */
+en_sw_timer_error_t sw_timer_init(void);
+
+
+/**
+ * @brief                       : Reserves a timer from the pool
+ *
+ * @param en_a_mode             : One shot or periodic
+ * @param fun_ptr_a_cb          : Expiry callback (called from the systick interrupt)
+ * @param ptr_v_a_ctx           : Context pointer passed back to the callback
+ * @param ptr_u16_a_timer_id    : Pointer to store the created timer id
+ *
+ * @return  SW_TIMER_OK             :   In case of Successful Operation
+ *          SW_TIMER_INVALID_ARGS   :   In case of Failed Operation (Invalid Arguments Given)
+ *          SW_TIMER_NO_FREE_TIMER  :   In case all SW_TIMER_MAX_TIMERS timers are in use
+ */
+en_sw_timer_error_t sw_timer_create(en_sw_timer_mode_t en_a_mode, fun_sw_timer_cb_t fun_ptr_a_cb,
+                                    void * ptr_v_a_ctx, uint16_t_ * ptr_u16_a_timer_id);
+
+
+/**
+ * @brief                       : Starts (or restarts) a timer
+ *
+ * @param u16_a_timer_id        : Timer id returned by sw_timer_create
+ * @param u32_a_period_ms       : Time to expiry in ms (and re-arm period for periodic timers)
+ *
+ * @return  SW_TIMER_OK             :   In case of Successful Operation
+ *          SW_TIMER_INVALID_ARGS   :   In case of Failed Operation (Invalid Arguments Given)
+ */
+en_sw_timer_error_t sw_timer_start(uint16_t_ u16_a_timer_id, uint32_t_ u32_a_period_ms);
+
+
+/**
+ * @brief                       : Stops a running timer, no-op if already stopped
+ *
+ * @param u16_a_timer_id        : Timer id returned by sw_timer_create
+ *
+ * @return  SW_TIMER_OK             :   In case of Successful Operation
+ *          SW_TIMER_INVALID_ARGS   :   In case of Failed Operation (Invalid Arguments Given)
+ */
+en_sw_timer_error_t sw_timer_stop(uint16_t_ u16_a_timer_id);
+
+
+/**
+ * @brief                       : Stops a timer and returns it to the pool
+ *
+ * @param u16_a_timer_id        : Timer id returned by sw_timer_create
+ *
+ * @return  SW_TIMER_OK             :   In case of Successful Operation
+ *          SW_TIMER_INVALID_ARGS   :   In case of Failed Operation (Invalid Arguments Given)
+ */
+en_sw_timer_error_t sw_timer_delete(uint16_t_ u16_a_timer_id);
+
+
+/**
+ * @brief                       : Gets the uptime (ms) by which the service needs to run next, for tickless idle
+ *
+ * @param ptr_u64_a_deadline_ms : Pointer to store the deadline, SW_TIMER_NO_DEADLINE if no timer is running
+ * @note                        : Heap: exact next expiry. Wheel: next expiry or the next cascade that may
+ *                                produce one (earlier, never later than the actual expiry)
+ *
+ * @return  SW_TIMER_OK             :   In case of Successful Operation
+ *          SW_TIMER_INVALID_ARGS   :   In case of Failed Operation (Invalid Arguments Given)
+ */
+en_sw_timer_error_t sw_timer_get_next_deadline(uint64_t_ * ptr_u64_a_deadline_ms);
+
+#endif //SW_TIMER_INTERFACE_H
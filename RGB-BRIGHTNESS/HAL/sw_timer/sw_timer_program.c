@@ -0,0 +1,705 @@
+/**
+ * @file    :   sw_timer_program.c
+ * @brief   :   Program File contains all software timer functions' implementation
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+/*----------------------------------------------------------/
+/- INCLUDES
+/----------------------------------------------------------*/
+#include "sw_timer_interface.h"
+#include "systick_interface.h"
+#include "TM4C123.h"
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define SW_TIMER_NOT_QUEUED     0xFFFF  // queue position of a stopped timer
+
+#if SW_TIMER_QUEUE == SW_TIMER_QUEUE_HEAP
+
+#define SW_TIMER_HEAP_PARENT(I) (((I) - 1) / 2)
+#define SW_TIMER_HEAP_LEFT(I)   ((2 * (I)) + 1)
+
+#elif SW_TIMER_QUEUE == SW_TIMER_QUEUE_WHEEL
+
+// 4 levels of 64 slots, level L slot covers 64^L ms, total range 2^24 ms (~4.6 hours)
+#define SW_TIMER_WHEEL_BITS     6
+#define SW_TIMER_WHEEL_SIZE     (1 << SW_TIMER_WHEEL_BITS)
+#define SW_TIMER_WHEEL_MASK     (SW_TIMER_WHEEL_SIZE - 1)
+#define SW_TIMER_WHEEL_LEVELS   4
+#define SW_TIMER_WHEEL_RANGE    (1ULL << (SW_TIMER_WHEEL_BITS * SW_TIMER_WHEEL_LEVELS))
+
+// extra list after the wheel slots holding the timers being expired in the current tick
+#define SW_TIMER_WHEEL_EXPIRING (SW_TIMER_WHEEL_LEVELS * SW_TIMER_WHEEL_SIZE)
+
+#define SW_TIMER_WHEEL_SLOT(LEVEL, DEADLINE) \
+    (((LEVEL) * SW_TIMER_WHEEL_SIZE) + (((DEADLINE) >> (SW_TIMER_WHEEL_BITS * (LEVEL))) & SW_TIMER_WHEEL_MASK))
+
+#else
+    #error SW_TIMER_QUEUE must be SW_TIMER_QUEUE_HEAP or SW_TIMER_QUEUE_WHEEL
+#endif
+
+/*---------------------------------------------------------/
+/- LOCAL TYPEDEFS
+/---------------------------------------------------------*/
+typedef struct{
+    uint64_t_           u64_deadline_ms;    // absolute expiry time (systick uptime)
+    uint32_t_           u32_period_ms;
+    fun_sw_timer_cb_t   fun_ptr_cb;
+    void *              ptr_v_ctx;
+    en_sw_timer_mode_t  en_mode;
+    boolean             bool_allocated;
+    uint16_t_           u16_queue_pos;      // heap position / wheel slot, SW_TIMER_NOT_QUEUED when stopped
+#if SW_TIMER_QUEUE == SW_TIMER_QUEUE_WHEEL
+    uint16_t_           u16_next;           // doubly linked slot list (timer ids)
+    uint16_t_           u16_prev;
+#endif
+}st_sw_timer_node_t;
+
+/*---------------------------------------------------------/
+/- LOCAL VARIABLES
+/---------------------------------------------------------*/
+static boolean gl_bool_sw_timer_initialized = FALSE;
+
+static st_sw_timer_node_t gl_arr_st_sw_timer_pool[SW_TIMER_MAX_TIMERS];
+
+#if SW_TIMER_QUEUE == SW_TIMER_QUEUE_HEAP
+// binary min-heap of running timer ids ordered by deadline, root is the next timer to expire
+static uint16_t_ gl_arr_u16_sw_timer_heap[SW_TIMER_MAX_TIMERS];
+static uint16_t_ gl_u16_sw_timer_heap_size = 0;
+#else
+// slot list heads (first timer id) for every wheel level, plus the expiring list
+static uint16_t_ gl_arr_u16_sw_timer_wheel[SW_TIMER_WHEEL_EXPIRING + 1];
+static uint64_t_ gl_u64_sw_timer_wheel_now_ms = 0;  // next ms to be processed by the wheel
+#endif
+
+/*---------------------------------------------------------/
+/- LOCAL FUNCTIONS PROTOTYPES
+/---------------------------------------------------------*/
+#if SW_TIMER_QUEUE == SW_TIMER_QUEUE_HEAP
+static void sw_timer_heap_place(uint16_t_ u16_a_pos, uint16_t_ u16_a_timer_id);
+static void sw_timer_heap_sift_up(uint16_t_ u16_a_pos);
+static void sw_timer_heap_sift_down(uint16_t_ u16_a_pos);
+#else
+static void sw_timer_wheel_link(uint16_t_ u16_a_slot, uint16_t_ u16_a_timer_id);
+static void sw_timer_wheel_unlink(uint16_t_ u16_a_timer_id);
+static void sw_timer_wheel_cascade(uint16_t_ u16_a_slot);
+static void sw_timer_wheel_process(void);
+#endif
+static void sw_timer_queue_insert(uint16_t_ u16_a_timer_id);
+static void sw_timer_queue_remove(uint16_t_ u16_a_timer_id);
+static uint64_t_ sw_timer_queue_next_deadline(void);
+static void sw_timer_tick(void * ptr_v_ctx);
+
+/*---------------------------------------------------------/
+/- FUNCTION IMPLEMENTATION
+/---------------------------------------------------------*/
+en_sw_timer_error_t sw_timer_init(void)
+{
+    en_sw_timer_error_t en_sw_timer_error_retval = SW_TIMER_OK;
+
+    if(TRUE == gl_bool_sw_timer_initialized)
+    {
+        // already initialized before
+        /* Skip */
+    }
+    else if(ST_OK != systick_subscribe(SYSTICK_EVENT_TICK, &sw_timer_tick, NULL_PTR))
+    {
+        // systick not initialized in free running mode
+        en_sw_timer_error_retval = SW_TIMER_INVALID_CONFIG;
+    }
+    else
+    {
+        for(uint16_t_ u16_timer_id = 0; u16_timer_id < SW_TIMER_MAX_TIMERS; u16_timer_id++)
+        {
+            gl_arr_st_sw_timer_pool[u16_timer_id].bool_allocated = FALSE;
+            gl_arr_st_sw_timer_pool[u16_timer_id].u16_queue_pos = SW_TIMER_NOT_QUEUED;
+        }
+
+#if SW_TIMER_QUEUE == SW_TIMER_QUEUE_HEAP
+        gl_u16_sw_timer_heap_size = 0;
+#else
+        for(uint16_t_ u16_slot = 0; u16_slot <= SW_TIMER_WHEEL_EXPIRING; u16_slot++)
+        {
+            gl_arr_u16_sw_timer_wheel[u16_slot] = SW_TIMER_NOT_QUEUED;
+        }
+
+        gl_u64_sw_timer_wheel_now_ms = systick_now_ms();
+#endif
+        gl_bool_sw_timer_initialized = TRUE;
+    }
+
+    return en_sw_timer_error_retval;
+}
+
+en_sw_timer_error_t sw_timer_create(en_sw_timer_mode_t en_a_mode, fun_sw_timer_cb_t fun_ptr_a_cb,
+                                    void * ptr_v_a_ctx, uint16_t_ * ptr_u16_a_timer_id)
+{
+    en_sw_timer_error_t en_sw_timer_error_retval = SW_TIMER_NO_FREE_TIMER;
+
+    if(FALSE == gl_bool_sw_timer_initialized)
+    {
+        en_sw_timer_error_retval = SW_TIMER_INVALID_CONFIG;
+    }
+    else if(
+            (en_a_mode >= SW_TIMER_MODE_TOTAL) ||
+            (NULL_PTR == fun_ptr_a_cb) ||
+            (NULL_PTR == ptr_u16_a_timer_id)
+            )
+    {
+        en_sw_timer_error_retval = SW_TIMER_INVALID_ARGS;
+    }
+    else
+    {
+        uint32_t_ u32_primask = __get_PRIMASK();
+        __disable_irq();
+
+        for(uint16_t_ u16_timer_id = 0; u16_timer_id < SW_TIMER_MAX_TIMERS; u16_timer_id++)
+        {
+            st_sw_timer_node_t * ptr_st_node = &gl_arr_st_sw_timer_pool[u16_timer_id];
+
+            if(FALSE == ptr_st_node->bool_allocated)
+            {
+                ptr_st_node->bool_allocated = TRUE;
+                ptr_st_node->en_mode = en_a_mode;
+                ptr_st_node->fun_ptr_cb = fun_ptr_a_cb;
+                ptr_st_node->ptr_v_ctx = ptr_v_a_ctx;
+                ptr_st_node->u32_period_ms = 0;
+                ptr_st_node->u16_queue_pos = SW_TIMER_NOT_QUEUED;
+
+                *ptr_u16_a_timer_id = u16_timer_id;
+                en_sw_timer_error_retval = SW_TIMER_OK;
+                break;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+
+        __set_PRIMASK(u32_primask);
+    }
+
+    return en_sw_timer_error_retval;
+}
+
+en_sw_timer_error_t sw_timer_start(uint16_t_ u16_a_timer_id, uint32_t_ u32_a_period_ms)
+{
+    en_sw_timer_error_t en_sw_timer_error_retval = SW_TIMER_OK;
+
+    if(
+            (u16_a_timer_id >= SW_TIMER_MAX_TIMERS) ||
+            (FALSE == gl_arr_st_sw_timer_pool[u16_a_timer_id].bool_allocated) ||
+            (ZERO == u32_a_period_ms)
+            )
+    {
+        en_sw_timer_error_retval = SW_TIMER_INVALID_ARGS;
+    }
+    else
+    {
+        st_sw_timer_node_t * ptr_st_node = &gl_arr_st_sw_timer_pool[u16_a_timer_id];
+        uint32_t_ u32_primask = __get_PRIMASK();
+        __disable_irq();
+
+        // restart: drop the old deadline first
+        if(SW_TIMER_NOT_QUEUED != ptr_st_node->u16_queue_pos)
+        {
+            sw_timer_queue_remove(u16_a_timer_id);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        ptr_st_node->u32_period_ms = u32_a_period_ms;
+        ptr_st_node->u64_deadline_ms = systick_now_ms() + u32_a_period_ms;
+        sw_timer_queue_insert(u16_a_timer_id);
+
+        __set_PRIMASK(u32_primask);
+    }
+
+    return en_sw_timer_error_retval;
+}
+
+en_sw_timer_error_t sw_timer_stop(uint16_t_ u16_a_timer_id)
+{
+    en_sw_timer_error_t en_sw_timer_error_retval = SW_TIMER_OK;
+
+    if(
+            (u16_a_timer_id >= SW_TIMER_MAX_TIMERS) ||
+            (FALSE == gl_arr_st_sw_timer_pool[u16_a_timer_id].bool_allocated)
+            )
+    {
+        en_sw_timer_error_retval = SW_TIMER_INVALID_ARGS;
+    }
+    else
+    {
+        uint32_t_ u32_primask = __get_PRIMASK();
+        __disable_irq();
+
+        if(SW_TIMER_NOT_QUEUED != gl_arr_st_sw_timer_pool[u16_a_timer_id].u16_queue_pos)
+        {
+            sw_timer_queue_remove(u16_a_timer_id);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        __set_PRIMASK(u32_primask);
+    }
+
+    return en_sw_timer_error_retval;
+}
+
+en_sw_timer_error_t sw_timer_delete(uint16_t_ u16_a_timer_id)
+{
+    en_sw_timer_error_t en_sw_timer_error_retval = sw_timer_stop(u16_a_timer_id);
+
+    if(SW_TIMER_OK == en_sw_timer_error_retval)
+    {
+        gl_arr_st_sw_timer_pool[u16_a_timer_id].bool_allocated = FALSE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return en_sw_timer_error_retval;
+}
+
+en_sw_timer_error_t sw_timer_get_next_deadline(uint64_t_ * ptr_u64_a_deadline_ms)
+{
+    en_sw_timer_error_t en_sw_timer_error_retval = SW_TIMER_OK;
+
+    if(NULL_PTR == ptr_u64_a_deadline_ms)
+    {
+        en_sw_timer_error_retval = SW_TIMER_INVALID_ARGS;
+    }
+    else if(FALSE == gl_bool_sw_timer_initialized)
+    {
+        *ptr_u64_a_deadline_ms = SW_TIMER_NO_DEADLINE;
+    }
+    else
+    {
+        uint32_t_ u32_primask = __get_PRIMASK();
+        __disable_irq();
+
+        *ptr_u64_a_deadline_ms = sw_timer_queue_next_deadline();
+
+        __set_PRIMASK(u32_primask);
+    }
+
+    return en_sw_timer_error_retval;
+}
+
+#if SW_TIMER_QUEUE == SW_TIMER_QUEUE_HEAP
+
+/**
+ * @brief                      : Stores a timer id at a heap position and updates its back index
+ */
+static void sw_timer_heap_place(uint16_t_ u16_a_pos, uint16_t_ u16_a_timer_id)
+{
+    gl_arr_u16_sw_timer_heap[u16_a_pos] = u16_a_timer_id;
+    gl_arr_st_sw_timer_pool[u16_a_timer_id].u16_queue_pos = u16_a_pos;
+}
+
+/**
+ * @brief                      : Moves the entry at u16_a_pos towards the root until its parent expires first
+ */
+static void sw_timer_heap_sift_up(uint16_t_ u16_a_pos)
+{
+    uint16_t_ u16_timer_id = gl_arr_u16_sw_timer_heap[u16_a_pos];
+    uint64_t_ u64_deadline_ms = gl_arr_st_sw_timer_pool[u16_timer_id].u64_deadline_ms;
+
+    while(u16_a_pos > 0)
+    {
+        uint16_t_ u16_parent_pos = SW_TIMER_HEAP_PARENT(u16_a_pos);
+        uint16_t_ u16_parent_id = gl_arr_u16_sw_timer_heap[u16_parent_pos];
+
+        if(gl_arr_st_sw_timer_pool[u16_parent_id].u64_deadline_ms <= u64_deadline_ms)
+        {
+            break;
+        }
+        else
+        {
+            sw_timer_heap_place(u16_a_pos, u16_parent_id);
+            u16_a_pos = u16_parent_pos;
+        }
+    }
+
+    sw_timer_heap_place(u16_a_pos, u16_timer_id);
+}
+
+/**
+ * @brief                      : Moves the entry at u16_a_pos towards the leaves until both children expire later
+ */
+static void sw_timer_heap_sift_down(uint16_t_ u16_a_pos)
+{
+    uint16_t_ u16_timer_id = gl_arr_u16_sw_timer_heap[u16_a_pos];
+    uint64_t_ u64_deadline_ms = gl_arr_st_sw_timer_pool[u16_timer_id].u64_deadline_ms;
+
+    while(SW_TIMER_HEAP_LEFT(u16_a_pos) < gl_u16_sw_timer_heap_size)
+    {
+        uint16_t_ u16_child_pos = SW_TIMER_HEAP_LEFT(u16_a_pos);
+        uint16_t_ u16_child_id = gl_arr_u16_sw_timer_heap[u16_child_pos];
+
+        // pick the earlier of the two children
+        if(
+                ((u16_child_pos + 1) < gl_u16_sw_timer_heap_size) &&
+                (gl_arr_st_sw_timer_pool[gl_arr_u16_sw_timer_heap[u16_child_pos + 1]].u64_deadline_ms <
+                 gl_arr_st_sw_timer_pool[u16_child_id].u64_deadline_ms)
+                )
+        {
+            u16_child_pos++;
+            u16_child_id = gl_arr_u16_sw_timer_heap[u16_child_pos];
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        if(u64_deadline_ms <= gl_arr_st_sw_timer_pool[u16_child_id].u64_deadline_ms)
+        {
+            break;
+        }
+        else
+        {
+            sw_timer_heap_place(u16_a_pos, u16_child_id);
+            u16_a_pos = u16_child_pos;
+        }
+    }
+
+    sw_timer_heap_place(u16_a_pos, u16_timer_id);
+}
+
+/**
+ * @brief                      : Queues a timer by its deadline, O(log n)
+ */
+static void sw_timer_queue_insert(uint16_t_ u16_a_timer_id)
+{
+    uint16_t_ u16_pos = gl_u16_sw_timer_heap_size++;
+
+    sw_timer_heap_place(u16_pos, u16_a_timer_id);
+    sw_timer_heap_sift_up(u16_pos);
+}
+
+/**
+ * @brief                      : Removes a queued timer from any heap position, O(log n)
+ */
+static void sw_timer_queue_remove(uint16_t_ u16_a_timer_id)
+{
+    uint16_t_ u16_pos = gl_arr_st_sw_timer_pool[u16_a_timer_id].u16_queue_pos;
+    uint16_t_ u16_last_pos = --gl_u16_sw_timer_heap_size;
+
+    gl_arr_st_sw_timer_pool[u16_a_timer_id].u16_queue_pos = SW_TIMER_NOT_QUEUED;
+
+    if(u16_pos != u16_last_pos)
+    {
+        // fill the hole with the last entry, it may need to move either way
+        uint16_t_ u16_moved_id = gl_arr_u16_sw_timer_heap[u16_last_pos];
+
+        sw_timer_heap_place(u16_pos, u16_moved_id);
+        sw_timer_heap_sift_up(u16_pos);
+        sw_timer_heap_sift_down(gl_arr_st_sw_timer_pool[u16_moved_id].u16_queue_pos);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ * @brief                      : Next expiry, the heap root, O(1)
+ */
+static uint64_t_ sw_timer_queue_next_deadline(void)
+{
+    return (gl_u16_sw_timer_heap_size > 0) ?
+           gl_arr_st_sw_timer_pool[gl_arr_u16_sw_timer_heap[0]].u64_deadline_ms :
+           SW_TIMER_NO_DEADLINE;
+}
+
+/**
+ * @brief                      : Systick tick hook, runs every expired timer
+ *
+ * @note                       : Constant cost per tick when nothing expires (only the heap root is checked)
+ */
+static void sw_timer_tick(void * ptr_v_ctx)
+{
+    uint64_t_ u64_now_ms = systick_now_ms();
+
+    while(
+            (gl_u16_sw_timer_heap_size > 0) &&
+            (gl_arr_st_sw_timer_pool[gl_arr_u16_sw_timer_heap[0]].u64_deadline_ms <= u64_now_ms)
+            )
+    {
+        uint16_t_ u16_timer_id = gl_arr_u16_sw_timer_heap[0];
+        st_sw_timer_node_t * ptr_st_node = &gl_arr_st_sw_timer_pool[u16_timer_id];
+
+        if(SW_TIMER_PERIODIC == ptr_st_node->en_mode)
+        {
+            // re-arm from the old deadline so the period does not drift
+            ptr_st_node->u64_deadline_ms += ptr_st_node->u32_period_ms;
+            sw_timer_heap_sift_down(0);
+        }
+        else
+        {
+            sw_timer_queue_remove(u16_timer_id);
+        }
+
+        // callback may start/stop timers, the root is re-read on the next iteration
+        ptr_st_node->fun_ptr_cb(ptr_st_node->ptr_v_ctx);
+    }
+}
+
+#else /* SW_TIMER_QUEUE_WHEEL */
+
+/**
+ * @brief                      : Pushes a timer to the front of a wheel slot list, O(1)
+ */
+static void sw_timer_wheel_link(uint16_t_ u16_a_slot, uint16_t_ u16_a_timer_id)
+{
+    st_sw_timer_node_t * ptr_st_node = &gl_arr_st_sw_timer_pool[u16_a_timer_id];
+    uint16_t_ u16_head_id = gl_arr_u16_sw_timer_wheel[u16_a_slot];
+
+    ptr_st_node->u16_queue_pos = u16_a_slot;
+    ptr_st_node->u16_prev = SW_TIMER_NOT_QUEUED;
+    ptr_st_node->u16_next = u16_head_id;
+
+    if(SW_TIMER_NOT_QUEUED != u16_head_id)
+    {
+        gl_arr_st_sw_timer_pool[u16_head_id].u16_prev = u16_a_timer_id;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    gl_arr_u16_sw_timer_wheel[u16_a_slot] = u16_a_timer_id;
+}
+
+/**
+ * @brief                      : Removes a timer from whichever slot list it is in, O(1)
+ */
+static void sw_timer_wheel_unlink(uint16_t_ u16_a_timer_id)
+{
+    st_sw_timer_node_t * ptr_st_node = &gl_arr_st_sw_timer_pool[u16_a_timer_id];
+
+    if(SW_TIMER_NOT_QUEUED != ptr_st_node->u16_prev)
+    {
+        gl_arr_st_sw_timer_pool[ptr_st_node->u16_prev].u16_next = ptr_st_node->u16_next;
+    }
+    else
+    {
+        // first in list
+        gl_arr_u16_sw_timer_wheel[ptr_st_node->u16_queue_pos] = ptr_st_node->u16_next;
+    }
+
+    if(SW_TIMER_NOT_QUEUED != ptr_st_node->u16_next)
+    {
+        gl_arr_st_sw_timer_pool[ptr_st_node->u16_next].u16_prev = ptr_st_node->u16_prev;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    ptr_st_node->u16_queue_pos = SW_TIMER_NOT_QUEUED;
+}
+
+/**
+ * @brief                      : Queues a timer in the wheel level that covers its remaining time, O(1)
+ *
+ * @note                       : Overdue timers go to the next slot to be processed, timers beyond the
+ *                               wheel range are parked in the top level and re-placed when cascaded
+ */
+static void sw_timer_queue_insert(uint16_t_ u16_a_timer_id)
+{
+    uint64_t_ u64_deadline_ms = gl_arr_st_sw_timer_pool[u16_a_timer_id].u64_deadline_ms;
+    uint64_t_ u64_delta_ms;
+    uint8_t_ u8_level = 0;
+
+    if(u64_deadline_ms < gl_u64_sw_timer_wheel_now_ms)
+    {
+        u64_deadline_ms = gl_u64_sw_timer_wheel_now_ms;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    u64_delta_ms = u64_deadline_ms - gl_u64_sw_timer_wheel_now_ms;
+
+    if(u64_delta_ms >= SW_TIMER_WHEEL_RANGE)
+    {
+        u64_deadline_ms = gl_u64_sw_timer_wheel_now_ms + SW_TIMER_WHEEL_RANGE - 1;
+        u64_delta_ms = SW_TIMER_WHEEL_RANGE - 1;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    // bounded by SW_TIMER_WHEEL_LEVELS
+    while(u64_delta_ms >= (1ULL << (SW_TIMER_WHEEL_BITS * (u8_level + 1))))
+    {
+        u8_level++;
+    }
+
+    sw_timer_wheel_link(SW_TIMER_WHEEL_SLOT(u8_level, u64_deadline_ms), u16_a_timer_id);
+}
+
+/**
+ * @brief                      : Removes a queued timer, O(1)
+ */
+static void sw_timer_queue_remove(uint16_t_ u16_a_timer_id)
+{
+    sw_timer_wheel_unlink(u16_a_timer_id);
+}
+
+/**
+ * @brief                      : Earliest time the wheel may need to run, scans at most every slot once
+ *
+ * @note                       : Level 0 slots hold exact ms, for higher levels the slot cascade time is used
+ */
+static uint64_t_ sw_timer_queue_next_deadline(void)
+{
+    uint64_t_ u64_next_ms = SW_TIMER_NO_DEADLINE;
+
+    // level 0, the slot of the next processed ms included
+    for(uint8_t_ u8_offset = 0; u8_offset < SW_TIMER_WHEEL_SIZE; u8_offset++)
+    {
+        if(SW_TIMER_NOT_QUEUED != gl_arr_u16_sw_timer_wheel[SW_TIMER_WHEEL_SLOT(0, gl_u64_sw_timer_wheel_now_ms + u8_offset)])
+        {
+            u64_next_ms = gl_u64_sw_timer_wheel_now_ms + u8_offset;
+            break;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    // higher levels, their current slot was already cascaded unless the wheel sits right on its boundary
+    for(uint8_t_ u8_level = 1; u8_level < SW_TIMER_WHEEL_LEVELS; u8_level++)
+    {
+        uint64_t_ u64_level_index = gl_u64_sw_timer_wheel_now_ms >> (SW_TIMER_WHEEL_BITS * u8_level);
+        uint64_t_ u64_lower_bits = gl_u64_sw_timer_wheel_now_ms & ((1ULL << (SW_TIMER_WHEEL_BITS * u8_level)) - 1);
+
+        for(uint8_t_ u8_offset = (ZERO == u64_lower_bits) ? 0 : 1; u8_offset < SW_TIMER_WHEEL_SIZE; u8_offset++)
+        {
+            uint64_t_ u64_cascade_ms = (u64_level_index + u8_offset) << (SW_TIMER_WHEEL_BITS * u8_level);
+
+            if(u64_cascade_ms >= u64_next_ms)
+            {
+                // later slots of this level cascade even later
+                break;
+            }
+            else if(SW_TIMER_NOT_QUEUED != gl_arr_u16_sw_timer_wheel[SW_TIMER_WHEEL_SLOT(u8_level, u64_cascade_ms)])
+            {
+                u64_next_ms = u64_cascade_ms;
+                break;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+    }
+
+    return u64_next_ms;
+}
+
+/**
+ * @brief                      : Re-places every timer of a higher level slot into the lower levels
+ */
+static void sw_timer_wheel_cascade(uint16_t_ u16_a_slot)
+{
+    uint16_t_ u16_timer_id = gl_arr_u16_sw_timer_wheel[u16_a_slot];
+
+    gl_arr_u16_sw_timer_wheel[u16_a_slot] = SW_TIMER_NOT_QUEUED;
+
+    while(SW_TIMER_NOT_QUEUED != u16_timer_id)
+    {
+        uint16_t_ u16_next_id = gl_arr_st_sw_timer_pool[u16_timer_id].u16_next;
+
+        sw_timer_queue_insert(u16_timer_id);
+        u16_timer_id = u16_next_id;
+    }
+}
+
+/**
+ * @brief                      : Advances the wheel by one ms and runs the timers expiring in it
+ */
+static void sw_timer_wheel_process(void)
+{
+    uint64_t_ u64_now_ms = gl_u64_sw_timer_wheel_now_ms;
+    uint16_t_ u16_slot = SW_TIMER_WHEEL_SLOT(0, u64_now_ms);
+    uint16_t_ u16_timer_id;
+
+    // lower level wrapped, pull the current slot of the next level down (stops at the first non-wrapping level)
+    for(uint8_t_ u8_level = 1;
+        (u8_level < SW_TIMER_WHEEL_LEVELS) &&
+        (ZERO == ((u64_now_ms >> (SW_TIMER_WHEEL_BITS * (u8_level - 1))) & SW_TIMER_WHEEL_MASK));
+        u8_level++)
+    {
+        sw_timer_wheel_cascade(SW_TIMER_WHEEL_SLOT(u8_level, u64_now_ms));
+    }
+
+    gl_u64_sw_timer_wheel_now_ms = u64_now_ms + 1;
+
+    // move the due slot to the expiring list, so re-armed timers landing in the same slot wait a full turn
+    u16_timer_id = gl_arr_u16_sw_timer_wheel[u16_slot];
+    gl_arr_u16_sw_timer_wheel[u16_slot] = SW_TIMER_NOT_QUEUED;
+    gl_arr_u16_sw_timer_wheel[SW_TIMER_WHEEL_EXPIRING] = u16_timer_id;
+
+    while(SW_TIMER_NOT_QUEUED != u16_timer_id)
+    {
+        gl_arr_st_sw_timer_pool[u16_timer_id].u16_queue_pos = SW_TIMER_WHEEL_EXPIRING;
+        u16_timer_id = gl_arr_st_sw_timer_pool[u16_timer_id].u16_next;
+    }
+
+    // callbacks may stop other expiring timers, always take the current list head
+    while(SW_TIMER_NOT_QUEUED != gl_arr_u16_sw_timer_wheel[SW_TIMER_WHEEL_EXPIRING])
+    {
+        st_sw_timer_node_t * ptr_st_node;
+
+        u16_timer_id = gl_arr_u16_sw_timer_wheel[SW_TIMER_WHEEL_EXPIRING];
+        ptr_st_node = &gl_arr_st_sw_timer_pool[u16_timer_id];
+
+        sw_timer_wheel_unlink(u16_timer_id);
+
+        if(SW_TIMER_PERIODIC == ptr_st_node->en_mode)
+        {
+            // re-arm from the old deadline so the period does not drift
+            ptr_st_node->u64_deadline_ms += ptr_st_node->u32_period_ms;
+            sw_timer_queue_insert(u16_timer_id);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        ptr_st_node->fun_ptr_cb(ptr_st_node->ptr_v_ctx);
+    }
+}
+
+/**
+ * @brief                      : Systick tick hook, catches the wheel up to the current ms
+ *
+ * @note                       : O(1) per ms plus the expired timers' callbacks
+ */
+static void sw_timer_tick(void * ptr_v_ctx)
+{
+    uint64_t_ u64_now_ms = systick_now_ms();
+
+    while(gl_u64_sw_timer_wheel_now_ms <= u64_now_ms)
+    {
+        sw_timer_wheel_process();
+    }
+}
+
+#endif
@@ -0,0 +1,94 @@
+/**
+ ** @file      gpio_fast.h
+ ** @brief     Header-only fast path for GPIO outputs
+ **
+ ** With GPIO_CHECKS = 1 (default) every call is forwarded to the checked 
+ ** driver API. With GPIO_CHECKS = 0 the port/pins are assumed to be validated
+ ** once at init (gpio_pin_init/gpio_port_init) and every call is a bare
+ ** store to the masked GPIODATA alias of the pins.
+ **
+ ** @note      Select the port bus (APB/AHB) before using the fast path
+ ** @version   0.1
+ */
+
+#ifndef GPIO_FAST_H_
+#define GPIO_FAST_H_
+
+/*----------------------------------------------------------/
+/- INCLUDES
+/----------------------------------------------------------*/
+#include "std.h"
+#include "bit_math.h"
+
+#include "gpio_interface.h"
+#include "gpio_private.h"
+
+/*----------------------------------------------------------/
+/- MACROS
+/----------------------------------------------------------*/
+/* 1: full port/pin/direction checks (debug), 0: bare masked stores (release) */
+#ifndef GPIO_CHECKS
+#define GPIO_CHECKS		1
+#endif
+
+/* Core cycles of one gpio_fast_writePins on the Cortex-M4, APB store included (interrupt budgets of the callers):
+ * checked: call, port/pin/direction checks against the shadows, port block load and store
+ * bare   : port block load, alias address and store */
+#if GPIO_CHECKS
+#define GPIO_FAST_WRITE_CYCLES	30
+#else
+#define GPIO_FAST_WRITE_CYCLES	6
+#endif
+
+/*---------------------------------------------------------/
+/ INLINE FUNCTIONS 
+/---------------------------------------------------------*/
+
+/** 
+ ** @breif Function to set the value of a group of output pins in the same port
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	 : The port of the desired pins
+ *				[in]  u8_a_pinsMask: Mask of the pins to update (bit n -> pin n)
+ *				[in] 	u8_a_pinsVal : The values to set the masked pins to (bit n -> pin n)
+ *
+ ** @return	GPIO_OK           : Always when GPIO_CHECKS = 0, else as gpio_setPinsMasked
+ */
+static inline en_gpio_error_t gpio_fast_writePins(en_gpio_port_t en_a_port, uint8_t_ u8_a_pinsMask, uint8_t_ u8_a_pinsVal)
+{
+#if GPIO_CHECKS
+	return gpio_setPinsMasked(en_a_port, u8_a_pinsMask, u8_a_pinsVal);
+#else
+	GPIODATA_MASKED(en_a_port, u8_a_pinsMask) = u8_a_pinsVal;
+	return GPIO_OK;
+#endif
+}
+
+/** 
+ ** @breif Function to toggle a group of output pins in the same port
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	 : The port of the desired pins
+ *				[in]  u8_a_pinsMask: Mask of the pins to toggle (bit n -> pin n)
+ *
+ ** @return	GPIO_OK           : Always when GPIO_CHECKS = 0, else as gpio_togPinVal
+ */
+static inline en_gpio_error_t gpio_fast_togglePins(en_gpio_port_t en_a_port, uint8_t_ u8_a_pinsMask)
+{
+#if GPIO_CHECKS
+	en_gpio_error_t gpio_error_state = GPIO_OK;
+	en_gpio_pin_t pin;
+	
+	for(pin = GPIO_PIN_0; (pin < GPIO_PIN_TOTAL) && (GPIO_OK == gpio_error_state); pin++)
+	{
+		if(GET_BIT(u8_a_pinsMask, pin)) gpio_error_state = gpio_togPinVal(en_a_port, pin);
+	}
+	
+	return gpio_error_state;
+#else
+	GPIODATA_MASKED(en_a_port, u8_a_pinsMask) ^= PORT_SET;
+	return GPIO_OK;
+#endif
+}
+
+#endif /* GPIO_FAST_H_ */
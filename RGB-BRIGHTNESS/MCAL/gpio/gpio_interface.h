@@ -12,6 +12,21 @@
 #define PORT_CLR  	0x00
 #define PORT_SET		0xff
 
+/* NVIC priority of every GPIO port interrupt (0 = highest). All ports share it so no port ISR
+ * preempts another one, which keeps the edge event queue single producer */
+#define GPIO_IRQ_PRIORITY				2
+
+/* Capacity of the edge event queue (power of 2), one slot is kept free */
+#define GPIO_EVENT_QUEUE_SIZE		32
+
+/* Number of entries of a port configuration table (see gpio_port_init) */
+#define GPIO_PORT_CFG_COUNT(TABLE)		(sizeof(TABLE) / sizeof((TABLE)[0]))
+
+/* Compile time check of a port configuration table, place it at file scope after the table */
+#define GPIO_PORT_CFG_ASSERT(TABLE)		_Static_assert((GPIO_PORT_CFG_COUNT(TABLE) > 0) &&												\
+																							 (GPIO_PORT_CFG_COUNT(TABLE) <= GPIO_PIN_TOTAL),						\
+																							 #TABLE " must hold 1 to GPIO_PIN_TOTAL pin configurations")
+
 /*----------------------------------------------------------/
 /- PRIMITIVE TYPES 
 /----------------------------------------------------------*/
@@ -89,6 +104,13 @@ typedef enum
 	INT_EVENT_TOTAL
 }en_gpio_int_event_t;
 
+typedef enum
+{
+	GPIO_BUS_APB = 0	,	/* Advanced Peripheral Bus (legacy aperture) */
+	GPIO_BUS_AHB			,	/* Advanced High-Performance Bus (single-cycle access) */
+	GPIO_BUS_TOTAL
+}en_gpio_bus_t;
+
 typedef enum
 {
 	GPIO_OK							= 0 ,
@@ -96,6 +118,7 @@ typedef enum
 	GPIO_INVALID_PIN				,
 	GPIO_INVALID_PIN_CFG		,
 	GPIO_INVALID_INT_EVENT	,
+	GPIO_INVALID_BUS				,
 	GPIO_ERROR
 }en_gpio_error_t;
 
@@ -109,12 +132,59 @@ typedef struct
 	en_gpio_pin_cfg_t			pin_cfg		 ;
 	//en_gpio_pin_level_t 	init_val	 ; /* The initial pin value (LOW/HIGH) */
 	en_gpio_pin_current_t current		 ; /* The output current on the pin(s)(ignored if input) */
+	en_gpio_bus_t					bus				 ; /* The bus used to access the whole port (APB/AHB) */
+	uint8_t_							alt_func	 ; /* GPIOPCTL peripheral function number 1 -> 15 (ALT_FUNCTION only) */
 }st_gpio_cfg_t;
 
+/* RAM shadow of the port registers maintained by the driver (bit n -> pin n) */
+typedef struct
+{
+	uint8_t_ u8_configured ; /* Pins initialized through gpio_pin_init/gpio_port_init */
+	uint8_t_ u8_dir				 ; /* GPIODIR  : output pins */
+	uint8_t_ u8_pur				 ; /* GPIOPUR  : pull-up pins set by the driver */
+	uint8_t_ u8_pdr				 ; /* GPIOPDR  : pull-down pins */
+	uint8_t_ u8_odr				 ; /* GPIOODR  : open drain pins */
+	uint8_t_ u8_dr2r			 ; /* GPIODR2R : 2-mA drive pins */
+	uint8_t_ u8_dr4r			 ; /* GPIODR4R : 4-mA drive pins */
+	uint8_t_ u8_dr8r			 ; /* GPIODR8R : 8-mA drive pins */
+	uint8_t_ u8_is				 ; /* GPIOIS   : level sensitive interrupt pins */
+	uint8_t_ u8_ibe				 ; /* GPIOIBE  : both edges interrupt pins */
+	uint8_t_ u8_iev				 ; /* GPIOIEV  : rising edge/high level interrupt pins */
+	uint8_t_ u8_im				 ; /* GPIOIM   : interrupt enabled pins */
+}st_gpio_shadow_t;
+
+/* Edge event recorded by the GPIO ISR for pins in event mode */
+typedef struct
+{
+	uint32_t_ 					u32_timestamp	; /* Core cycle counter (DWT CYCCNT) at ISR entry */
+	en_gpio_port_t 			port					; /* The port of the pin that triggered the interrupt */
+	en_gpio_pin_t  			pin						; /* The pin that triggered the interrupt */
+	en_gpio_pin_level_t	level					; /* The pin level sampled at ISR entry */
+}st_gpio_event_t;
+
 /*---------------------------------------------------------/
 / FUNCTIONS PROTOTYPES 
 /---------------------------------------------------------*/
-en_gpio_error_t gpio_port_init 		 (st_gpio_cfg_t* port_cfg);
+/** 
+ **@breif Function initialize several pins of the same port at once
+ *
+ * This function validates the whole configuration table first, then 
+ * computes the final value of each configuration register and writes
+ * every register once, regardless of the number of pins
+ *
+ ** @Parameters
+ *				[in] ptr_st_port_cfg : pointer to a table of pin configurations (same port and bus)
+ *				[in] u8_a_pins_count : number of entries in the table (GPIO_PORT_CFG_COUNT)
+ *
+ ** @return	GPIO_OK          		 : If the operation is done successfully
+ *					GPIO_INVALID_PORT		 : If the entries are not on the same valid port
+ *					GPIO_INVALID_PIN 		 : If a pin is not valid or is configured twice
+ *					GPIO_INVALID_PIN_CFG : If a pin configuration is not supported
+ *					GPIO_INVALID_BUS 		 : If the entries do not share the same valid bus
+ *					GPIO_ERROR	     		 : If the passed pointer is a null pointer, the table is empty
+ *																 or an output drive strength is invalid
+ */
+en_gpio_error_t gpio_port_init 		 (const st_gpio_cfg_t* ptr_st_port_cfg, uint8_t_ u8_a_pins_count);
 
 /** 
  **@breif Function initialize a gpio pin 
@@ -124,10 +194,14 @@ en_gpio_error_t gpio_port_init 		 (st_gpio_cfg_t* port_cfg);
  *
  ** @Parameters
 *				[in] ptr_st_pin_cfg : pointer to the pin configuration structure
+ *
+ * @note  The bus selection applies to the whole port, all pins of
+ *				the port are accessed through the last selected bus
  *
  ** @return	GPIO_OK          : If the operation is done successfully
  *					GPIO_INALID_PORT : If the passed port is not a valid port
  *					GPIO_INALID_PIN  : If the passed pin is not a valid pin
+ *					GPIO_INVALID_BUS : If the passed bus is not APB/AHB
  *					GPIO_ERROR	     : If the passed pointer is a null pointer
  */
 en_gpio_error_t gpio_pin_init  		 (st_gpio_cfg_t* pin_cfg);
@@ -146,6 +220,24 @@ en_gpio_error_t gpio_pin_init  		 (st_gpio_cfg_t* pin_cfg);
  */
 en_gpio_error_t gpio_setPortVal		 (en_gpio_port_t en_a_port,  uint8_t_ u8_a_portVal);
 
+/** 
+ ** @breif Function to set the value of a group of pins in the same port
+ *
+ * This function updates only the pins selected by the given mask
+ * with a single store, other pins of the port are untouched
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	 : The port of the desired pins
+ *				[in]  u8_a_pinsMask: Mask of the pins to update (bit n -> pin n)
+ *				[in] 	u8_a_pinsVal : The values to set the masked pins to (bit n -> pin n)
+ *
+ ** @return	GPIO_OK           : If the operation is done successfully
+ *					GPIO_INVALID_PORT : If the passed port is not a valid port
+ *					GPIO_INVALID_PIN  : If the mask contains a pin that is not valid for the port
+ *					GPIO_ERROR				: If any of the masked pins is not configured as an output pin
+ */
+en_gpio_error_t gpio_setPinsMasked (en_gpio_port_t en_a_port, uint8_t_ u8_a_pinsMask, uint8_t_ u8_a_pinsVal);
+
 /** 
  ** @breif Function to set the value of a given pin 
  *
@@ -259,4 +351,65 @@ en_gpio_error_t gpio_setIntSense(en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pi
  */
 en_gpio_error_t gpio_setIntCallback(en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin, gpio_cb pv_a_cbf);
 
+/** 
+ ** @breif Function to get the driver shadow of a port configuration
+ *
+ * This function copies the RAM shadow of the port registers that 
+ * the driver uses instead of reading them back from the bus
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	   : The desired port
+ *				[out] ptr_st_shadow  : pointer to the structure to copy the shadow to
+ *
+ ** @return	GPIO_OK          : If the operation is done successfully
+ *					GPIO_INVALID_PORT: If the passed port is not a valid port
+ *					GPIO_ERROR	     : If the passed pointer is a null pointer
+ */
+en_gpio_error_t gpio_getShadow(en_gpio_port_t en_a_port, st_gpio_shadow_t* ptr_st_shadow);
+
+/** 
+ ** @breif Function to switch a pin interrupt to event mode
+ *
+ * In event mode the GPIO ISR does not call the pin callback, it pushes
+ * a timestamped event to a lock-free queue that the main loop drains 
+ * with gpio_readEvents, keeping the ISR time constant
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	 : The port of the desired pin
+ *				[in]  en_a_pin   	 : The desired pin 
+ *				[in]  bool_a_enable: TRUE to queue events, FALSE to call the pin callback
+ *
+ ** @return	GPIO_OK          : If the operation is done successfully
+ *					GPIO_INVALID_PORT: If the passed port is not a valid port
+ *					GPIO_INVALID_PIN : If the passed pin is not a valid pin
+ */
+en_gpio_error_t gpio_setEventMode(en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin, boolean bool_a_enable);
+
+/** 
+ ** @breif Function to drain the queued edge events
+ *
+ * This function copies up to u8_a_max_events of the oldest queued events
+ * to the given array, it must only be called from one context (main loop)
+ *
+ ** @Parameters
+ *				[out] ptr_st_events   : pointer to the array to copy the events to
+ *				[in]  u8_a_max_events : capacity of the given array
+ *				[out] pu8_a_count     : pointer to variable to store the number of copied events
+ *
+ ** @return	GPIO_OK          : If the operation is done successfully
+ *					GPIO_ERROR	     : If a passed pointer is a null pointer
+ */
+en_gpio_error_t gpio_readEvents(st_gpio_event_t* ptr_st_events, uint8_t_ u8_a_max_events, uint8_t_* pu8_a_count);
+
+/** 
+ ** @breif Function to get the number of events dropped because the queue was full
+ *
+ ** @Parameters
+ *				[out] pu32_a_dropped : pointer to variable to store the dropped events count
+ *
+ ** @return	GPIO_OK          : If the operation is done successfully
+ *					GPIO_ERROR	     : If the passed pointer is a null pointer
+ */
+en_gpio_error_t gpio_getDroppedEvents(uint32_t_* pu32_a_dropped);
+
 #endif
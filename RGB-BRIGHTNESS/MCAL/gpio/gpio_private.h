@@ -1,56 +1,115 @@
 #ifndef GPIO_PRIVATE_H_
 #define GPIO_PRIVATE_H_
 
-#define GPIO_APB
+#define GPIO_APB_OFFSET(X)		(X<4?(0x40004000 + (X*0x1000)):(0x40024000 + ((X-4)*0x1000)))	/* Advanced Peripheral Bus aperture */
+#define GPIO_AHB_OFFSET(X)		(0x40058000 + (X*0x1000))																			/* Advanced High-Performance Bus aperture */
 
-#ifdef GPIO_APB
-#define GPIO_OFFSET(X)			(X<4?(0x40004000 + (X*0x1000)):(0x40024000 + ((X-4)*0x1000)))
-#elif  GPIO_AHB
-#define GPIO_OFFSET(X)			(0x40058000 + (X*0x1000))
+/* GPIO register block of a port */
+typedef struct
+{
+	volatile uint32_t_ DATA[256]			;	/* 0x000 - 0x3FC : GPIO Data, address bits [9:2] mask the accessed pins (DATA[0xFF] -> all pins) */
+	volatile uint32_t_ DIR						;	/* 0x400 : GPIO Direction */
+	volatile uint32_t_ IS							;	/* 0x404 : GPIO Interrupt Sense */
+	volatile uint32_t_ IBE						;	/* 0x408 : GPIO Interrupt Both Edges */
+	volatile uint32_t_ IEV						;	/* 0x40C : GPIO Interrupt Event */
+	volatile uint32_t_ IM							;	/* 0x410 : GPIO Interrupt Mask */
+	volatile uint32_t_ RIS						;	/* 0x414 : GPIO Raw Interrupt Status */
+	volatile uint32_t_ MIS						;	/* 0x418 : GPIO Masked Interrupt Status */
+	volatile uint32_t_ ICR						;	/* 0x41C : GPIO Interrupt Clear */
+	volatile uint32_t_ AFSEL					;	/* 0x420 : GPIO Alternate Function Select */
+	volatile uint32_t_ RESERVED0[55]	;	/* 0x424 - 0x4FC */
+	volatile uint32_t_ DR2R						;	/* 0x500 : GPIO 2-mA Drive Select */
+	volatile uint32_t_ DR4R						;	/* 0x504 : GPIO 4-mA Drive Select */
+	volatile uint32_t_ DR8R						;	/* 0x508 : GPIO 8-mA Drive Select */
+	volatile uint32_t_ ODR						;	/* 0x50C : GPIO Open Drain Select */
+	volatile uint32_t_ PUR						;	/* 0x510 : GPIO Pull-Up Select */
+	volatile uint32_t_ PDR						;	/* 0x514 : GPIO Pull-Down Select */
+	volatile uint32_t_ SLR						;	/* 0x518 : GPIO Slew Rate Control Select */
+	volatile uint32_t_ DEN						;	/* 0x51C : GPIO Digital Enable */
+	volatile uint32_t_ LOCK						;	/* 0x520 : GPIO Lock */
+	volatile uint32_t_ CR							;	/* 0x524 : GPIO Commit */
+	volatile uint32_t_ AMSEL					;	/* 0x528 : GPIO Analog Mode Select */
+	volatile uint32_t_ PCTL						;	/* 0x52C : GPIO Port Control */
+}st_gpio_regs_t;
+
+/* Register block of each port on its currently selected bus */
+extern st_gpio_regs_t* gl_arr_ptr_st_gpio_regs[];
+
+#define GPIO_REGS(X)					(gl_arr_ptr_st_gpio_regs[X])
+
+#ifdef GPIO_HOST_REGS
+/* Host build: the register blocks, RCGCGPIO and GPIOHBCTL are RAM and the DATA address mask is emulated (tests/host) */
+extern st_gpio_regs_t gl_arr_st_gpio_host_regs[GPIO_BUS_TOTAL][GPIO_PORT_TOTAL];
+extern volatile uint32_t_ gl_u32_gpio_host_rcgcgpio;
+extern volatile uint32_t_ gl_u32_gpio_host_gpiohbctl;
+volatile uint32_t_* gpio_host_data(uint8_t_ u8_a_port, uint8_t_ u8_a_mask);
+
+#define GPIO_BUS_REGS(BUS, PORT)	(&gl_arr_st_gpio_host_regs[BUS][PORT])
+#define RCGCGPIO					gl_u32_gpio_host_rcgcgpio
+#define GPIOHBCTL					gl_u32_gpio_host_gpiohbctl
+
+#define GPIODATA_MASKED(X, MASK)	(*gpio_host_data((X), (MASK)))	/* GPIO Data (address masked) */
 #else
-#error "Please define a valid bus"
+/* Register block of a port on a bus */
+#define GPIO_BUS_REGS(BUS, PORT)	((st_gpio_regs_t*) ((GPIO_BUS_APB == BUS) ? GPIO_APB_OFFSET(PORT) : GPIO_AHB_OFFSET(PORT)))
+#define RCGCGPIO					*((volatile uint32_t_*) 0x400FE608) /* GPIO Run Mode Clock Gating Control */
+#define GPIOHBCTL					*((volatile uint32_t_*) 0x400FE06C) /* GPIO High-Performance Bus Control */
+
+#define GPIODATA_MASKED(X, MASK)	(GPIO_REGS(X)->DATA[MASK])	/* GPIO Data (address masked) */
 #endif
 
-#define RCGCGPIO					*((volatile uint32_t_*) 0x400FE608) /* GPIO Run Mode Clock Gating Control */
+#define GPIODATA(X)				GPIODATA_MASKED(X, PORT_SET)		/* GPIO Data */
+#define GPIODIR(X)				(GPIO_REGS(X)->DIR)		/* GPIO Direction */
+#define GPIOIS(X)					(GPIO_REGS(X)->IS)		/* GPIO Interrupt Sense */
+#define GPIOIBE(X)				(GPIO_REGS(X)->IBE)		/* GPIO Interrupt Both Edges */
+#define GPIOIEV(X)				(GPIO_REGS(X)->IEV)		/* GPIO Interrupt Event */
+#define GPIOIM(X)					(GPIO_REGS(X)->IM)		/* GPIO Interrupt Mask */
+#define GPIORIS(X)				(GPIO_REGS(X)->RIS)		/* GPIO Raw Interrupt Status */
+#define GPIOMIS(X)				(GPIO_REGS(X)->MIS)		/* GPIO Masked Interrupt Status */
+#define GPIOICR(X)				(GPIO_REGS(X)->ICR)		/* GPIO Interrupt Clear */
+#define GPIOAFSEL(X)			(GPIO_REGS(X)->AFSEL)	/* GPIO Alternate Function Select */
+#define GPIODR2R(X)				(GPIO_REGS(X)->DR2R)	/* GPIO 2-mA Drive Select */
+#define GPIODR4R(X)				(GPIO_REGS(X)->DR4R)	/* GPIO 4-mA Drive Select */
+#define GPIODR8R(X)				(GPIO_REGS(X)->DR8R)	/* GPIO 8-mA Drive Select */
+#define GPIOODR(X)				(GPIO_REGS(X)->ODR)		/* GPIO Open Drain Select */
+#define GPIOPUR(X)				(GPIO_REGS(X)->PUR)		/* GPIO Pull-Up Select */
+#define GPIOPDR(X)				(GPIO_REGS(X)->PDR)		/* GPIO Pull-Down Select */
+#define GPIOSLR(X)				(GPIO_REGS(X)->SLR)		/* GPIO Slew Rate Control Select */
+#define GPIODEN(X)				(GPIO_REGS(X)->DEN)		/* GPIO Digital Enable */
+#define GPIOLOCK(X)				(GPIO_REGS(X)->LOCK)	/* GPIO Lock */
+#define GPIOCR(X)					(GPIO_REGS(X)->CR)		/* GPIO Commit */
+#define GPIOAMSEL(X)			(GPIO_REGS(X)->AMSEL)	/* GPIO Analog Mode Select */
+#define GPIOPCTL(X)				(GPIO_REGS(X)->PCTL)	/* GPIO Port Control */
 
-#define GPIODATA(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x3FC))		/* GPIO Data */
-#define GPIODIR(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x400))		/* GPIO Direction */
-#define GPIOIS(X)					*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x404))		/* GPIO Interrupt Sense */
-#define GPIOIBE(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x408))		/* GPIO Interrupt Both Edges */
-#define GPIOIEV(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x40C))		/* GPIO Interrupt Event */
-#define GPIOIM(X)					*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x410))		/* GPIO Interrupt Mask */
-#define GPIORIS(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x414))		/* GPIO Raw Interrupt Status */
-#define GPIOMIS(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x418))		/* GPIO Masked Interrupt Status */
-#define GPIOICR(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x41C))		/* GPIO Interrupt Clear */
-#define GPIOAFSEL(X)			*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x420))		/* GPIO Alternate Function Select */
-#define GPIODR2R(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x500))		/* GPIO 2-mA Drive Select */
-#define GPIODR4R(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x504))		/* GPIO 4-mA Drive Select */
-#define GPIODR8R(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x508))		/* GPIO 8-mA Drive Select */
-#define GPIOODR(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x50C))		/* GPIO Open Drain Select */
-#define GPIOPUR(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x510))		/*  */
-#define GPIOPDR(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x514))		/*  */
-#define GPIOSLR(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x518))		/* GPIO Slew Rate Control Select */
-#define GPIODEN(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x51C))		/* GPIO Digital Enable */
-#define GPIOLOCK(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x520))		/* GPIO Lock */
-#define GPIOCR(X)					*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x524))		/* GPIO Commit */
-#define GPIOAMSEL(X)			*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x528))		/* GPIO Analog Mode Select */
-#define GPIOPCTL(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x52C))		/* GPIO Port Control */
+/* GPIOPCTL holds one 4-bit function number per pin */
+#define GPIO_PCTL_SHIFT(PIN)			((PIN) * 4)
+#define GPIO_PCTL_MASK(PIN)				(0xFUL << GPIO_PCTL_SHIFT(PIN))
+#define GPIO_PCTL_FUNC_MAX				15
 
+/* Port F only has pins 0 -> 4 */
+#define GPIO_PORT_F_VALID_PINS		0x1F
+
+/* Shadow of the driver owned registers at reset (all pins 2-mA drive) */
+#define GPIO_SHADOW_RESET					{ .u8_dr2r = PORT_SET }
+
+/* Clears the pull and open drain shadow bits of a pin before it is reconfigured */
+#define GPIO_SHADOW_PAD_CLR(SHADOW, PIN)	do { CLR_BIT((SHADOW)->u8_pur, PIN); CLR_BIT((SHADOW)->u8_pdr, PIN); \
+																					 CLR_BIT((SHADOW)->u8_odr, PIN); } while(0)
+
+/* Clears then sets the given bits of a register with a single read-modify-write */
+#define GPIO_REG_UPDATE(REGISTER, CLR_MASK, SET_MASK)		REGISTER = ( ( REGISTER & ~(CLR_MASK) ) | (SET_MASK) )
+
+/* Wraps a queue index, GPIO_EVENT_QUEUE_SIZE is a power of 2 */
+#define GPIO_EVENT_IDX_MASK		(GPIO_EVENT_QUEUE_SIZE - 1)
+
+#if (GPIO_EVENT_QUEUE_SIZE & GPIO_EVENT_IDX_MASK) || (GPIO_EVENT_QUEUE_SIZE > 256)
+#error "GPIO_EVENT_QUEUE_SIZE must be a power of 2 up to 256"
+#endif
+
+/* Bit index of GPIOMIS MSB, pin = GPIO_MIS_MSB - CLZ(GPIOMIS) */
+#define GPIO_MIS_MSB					31
 
 #define GPIO_INT_SENSE_MASK		0
 #define GPIO_INT_LEVEL_MASK		1
 
-/** 
- ** @breif Function to validate the values of the given port and pin
- *
- ** @Parameters
- *				[in]  en_a_port  	 : The port value to validate
- *				[in]  en_a_pin   	 : The pin value to validate
- *
- ** @return	GPIO_OK          : If the port and pin have valid values
- *					GPIO_INVALID_PORT: If the passed port is not a valid port
- *					GPIO_INVALID_PIN : If the passed pin is not a valid pin
- */
-static en_gpio_error_t port_pin_check(en_gpio_port_t port, en_gpio_pin_t pin);
-
 #endif
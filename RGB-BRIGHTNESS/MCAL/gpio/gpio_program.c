@@ -16,8 +16,59 @@
 #include "gpio_private.h"
 
 
+/*- PRIVATE FUNCTIONS PROTOTYPES
+----------------------------------------------*/
+static en_gpio_error_t port_pin_check(en_gpio_port_t port, en_gpio_pin_t pin);
+static en_gpio_error_t gpio_set_bus(en_gpio_port_t en_a_port, en_gpio_bus_t en_a_bus);
+static void gpio_irq_dispatch(en_gpio_port_t en_a_port);
+static void gpio_push_event(en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin, uint8_t_ u8_a_levels, uint32_t_ u32_a_timestamp);
+
 gpio_cb arr_gpio_cbf[GPIO_PORT_TOTAL][GPIO_PIN_TOTAL] = {{NULL}};
 
+/* Register block of each port on each bus */
+static st_gpio_regs_t* const gl_arr_ptr_st_gpio_bus_regs[GPIO_BUS_TOTAL][GPIO_PORT_TOTAL] =
+{
+	{
+		GPIO_BUS_REGS(GPIO_BUS_APB, GPIO_PORT_A), GPIO_BUS_REGS(GPIO_BUS_APB, GPIO_PORT_B), GPIO_BUS_REGS(GPIO_BUS_APB, GPIO_PORT_C),
+		GPIO_BUS_REGS(GPIO_BUS_APB, GPIO_PORT_D), GPIO_BUS_REGS(GPIO_BUS_APB, GPIO_PORT_E), GPIO_BUS_REGS(GPIO_BUS_APB, GPIO_PORT_F)
+	},
+	{
+		GPIO_BUS_REGS(GPIO_BUS_AHB, GPIO_PORT_A), GPIO_BUS_REGS(GPIO_BUS_AHB, GPIO_PORT_B), GPIO_BUS_REGS(GPIO_BUS_AHB, GPIO_PORT_C),
+		GPIO_BUS_REGS(GPIO_BUS_AHB, GPIO_PORT_D), GPIO_BUS_REGS(GPIO_BUS_AHB, GPIO_PORT_E), GPIO_BUS_REGS(GPIO_BUS_AHB, GPIO_PORT_F)
+	}
+};
+
+/* Register block of each port on its currently selected bus (APB after reset) */
+st_gpio_regs_t* gl_arr_ptr_st_gpio_regs[GPIO_PORT_TOTAL] =
+{
+	GPIO_BUS_REGS(GPIO_BUS_APB, GPIO_PORT_A), GPIO_BUS_REGS(GPIO_BUS_APB, GPIO_PORT_B), GPIO_BUS_REGS(GPIO_BUS_APB, GPIO_PORT_C),
+	GPIO_BUS_REGS(GPIO_BUS_APB, GPIO_PORT_D), GPIO_BUS_REGS(GPIO_BUS_APB, GPIO_PORT_E), GPIO_BUS_REGS(GPIO_BUS_APB, GPIO_PORT_F)
+};
+
+/* Valid pins of each port */
+static const uint8_t_ gl_arr_u8_gpio_valid_pins[GPIO_PORT_TOTAL] =
+{
+	PORT_SET, PORT_SET, PORT_SET, PORT_SET, PORT_SET, GPIO_PORT_F_VALID_PINS
+};
+
+/* RAM shadow of the direction, pull, drive and interrupt registers.
+ * Registers with a non-zero JTAG/NMI reset value (DEN, AFSEL, AMSEL, PUR)
+ * are still updated on the bus, the shadow only mirrors the pull-ups */
+static st_gpio_shadow_t gl_arr_st_gpio_shadow[GPIO_PORT_TOTAL] =
+{
+	GPIO_SHADOW_RESET, GPIO_SHADOW_RESET, GPIO_SHADOW_RESET,
+	GPIO_SHADOW_RESET, GPIO_SHADOW_RESET, GPIO_SHADOW_RESET
+};
+
+/* Pins of each port whose interrupts are queued as events instead of calling back */
+static uint8_t_ gl_arr_u8_gpio_event_pins[GPIO_PORT_TOTAL] = {0};
+
+/* Single producer (GPIO ISRs, equal priority so they never preempt each other) / single consumer (main loop) event queue */
+static st_gpio_event_t gl_arr_st_gpio_events[GPIO_EVENT_QUEUE_SIZE];
+static volatile uint8_t_ gl_u8_gpio_event_head = 0;	/* Written by the ISR only */
+static volatile uint8_t_ gl_u8_gpio_event_tail = 0;	/* Written by the consumer only */
+static volatile uint32_t_ gl_u32_gpio_events_dropped = 0;
+
 /*---------------------------------------------------------/
 / FUNCTION IMPLEMENTATION 
 /---------------------------------------------------------*/
@@ -37,11 +88,39 @@ static en_gpio_error_t port_pin_check(en_gpio_port_t port, en_gpio_pin_t pin)
 {
 	if		 (port >= GPIO_PORT_TOTAL) return GPIO_INVALID_PORT;
 	else if((pin  >= GPIO_PIN_TOTAL) 
-			|| (port == GPIO_PORT_F && pin > GPIO_PIN_4))
+			|| !GET_BIT(gl_arr_u8_gpio_valid_pins[port], pin))
 					return GPIO_INVALID_PIN;
 	else return GPIO_OK;
 }
 
+/** 
+ ** @breif Function to select the bus used to access a given port
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	 : The port to select the bus for
+ *				[in]  en_a_bus   	 : The bus to access the port through
+ *
+ ** @return	GPIO_OK          : If the operation is done successfully
+ *					GPIO_INVALID_BUS : If the passed bus is not APB/AHB
+ */
+static en_gpio_error_t gpio_set_bus(en_gpio_port_t en_a_port, en_gpio_bus_t en_a_bus)
+{
+	en_gpio_error_t gpio_error_state = GPIO_OK;
+	
+	if(en_a_bus < GPIO_BUS_TOTAL)
+	{
+		/* Route the port to the selected aperture then access it through that block */
+		WRITE_BIT(GPIOHBCTL, en_a_port, en_a_bus);
+		gl_arr_ptr_st_gpio_regs[en_a_port] = gl_arr_ptr_st_gpio_bus_regs[en_a_bus][en_a_port];
+	}
+	else
+	{
+		gpio_error_state = GPIO_INVALID_BUS;
+	}
+	
+	return gpio_error_state;
+}
+
 /** 
  **@breif Function initialize a gpio pin 
  *
@@ -50,10 +129,14 @@ static en_gpio_error_t port_pin_check(en_gpio_port_t port, en_gpio_pin_t pin)
  *
  ** @Parameters
 *				[in] ptr_st_pin_cfg : pointer to the pin configuration structure
+ *
+ * @note  The bus selection applies to the whole port, all pins of
+ *				the port are accessed through the last selected bus
  *
  ** @return	GPIO_OK          : If the operation is done successfully
  *					GPIO_INALID_PORT : If the passed port is not a valid port
  *					GPIO_INALID_PIN  : If the passed pin is not a valid pin
+ *					GPIO_INVALID_BUS : If the passed bus is not APB/AHB
  *					GPIO_ERROR	     : If the passed pointer is a null pointer
  */
 en_gpio_error_t gpio_pin_init  (st_gpio_cfg_t* ptr_st_pin_cfg)
@@ -65,93 +148,150 @@ en_gpio_error_t gpio_pin_init  (st_gpio_cfg_t* ptr_st_pin_cfg)
 		/* Validate the port and pin values */
 		gpio_error_state = port_pin_check(ptr_st_pin_cfg->port, ptr_st_pin_cfg->pin);
 		
+		if(GPIO_OK == gpio_error_state)
+		{
+			/* Enable the port clock */
+			SET_BIT(RCGCGPIO, ptr_st_pin_cfg->port);
+			
+			/* Select the port bus */
+			gpio_error_state = gpio_set_bus(ptr_st_pin_cfg->port, ptr_st_pin_cfg->bus);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+		
 		if(GPIO_OK == gpio_error_state)
 		{
 			en_gpio_port_t port = ptr_st_pin_cfg->port;
 			en_gpio_pin_t  pin  = ptr_st_pin_cfg->pin;
 			
-			/* Enable the port clock */
-			SET_BIT(RCGCGPIO, port);
-						
+			st_gpio_shadow_t* ptr_st_shadow = &gl_arr_st_gpio_shadow[port];
+			
 			/* Set the pin direction */
 			switch(ptr_st_pin_cfg->pin_cfg)
 			{
 				case INPUT: //floating
 				{
+					GPIO_SHADOW_PAD_CLR(ptr_st_shadow, pin);
 					SET_BIT(GPIODEN(port), pin);
 					CLR_BIT(GPIOAMSEL(port), pin);
 					CLR_BIT(GPIOAFSEL(port), pin);
 					
-					CLR_BIT(GPIODIR(port), pin);
+					CLR_BIT(ptr_st_shadow->u8_dir, pin);
 					break;
 				}
 				case OUTPUT:
 				{
+					GPIO_SHADOW_PAD_CLR(ptr_st_shadow, pin);
 					SET_BIT(GPIODEN(port), pin);
 					CLR_BIT(GPIOAMSEL(port), pin);
 					CLR_BIT(GPIOAFSEL(port), pin);
 					
-					SET_BIT(GPIODIR(port), pin);
+					SET_BIT(ptr_st_shadow->u8_dir, pin);
 					break;
 				}
 				case INPUT_ANALOG:
 				{
-					CLR_BIT(GPIODIR(port), pin);
+					GPIO_SHADOW_PAD_CLR(ptr_st_shadow, pin);
+					CLR_BIT(ptr_st_shadow->u8_dir, pin);
 					CLR_BIT(GPIODEN(port), pin);
 					SET_BIT(GPIOAMSEL(port), pin);
+					break;
 				}
 				case INPUT_PULL_UP:
 				{
+					GPIO_SHADOW_PAD_CLR(ptr_st_shadow, pin);
 					SET_BIT(GPIODEN(port), pin);
 					CLR_BIT(GPIOAMSEL(port), pin);
 					CLR_BIT(GPIOAFSEL(port), pin);
 					
-					CLR_BIT(GPIODIR(port), pin);
-					SET_BIT(GPIOPUR(port), pin);
+					CLR_BIT(ptr_st_shadow->u8_dir, pin);
+					SET_BIT(ptr_st_shadow->u8_pur, pin);
 					break;
 				}
 				case INPUT_PULL_DOWN:
 				{
+					GPIO_SHADOW_PAD_CLR(ptr_st_shadow, pin);
 					SET_BIT(GPIODEN(port), pin);
 					CLR_BIT(GPIOAMSEL(port), pin);
 					CLR_BIT(GPIOAFSEL(port), pin);
 					
-					CLR_BIT(GPIODIR(port), pin);
-					SET_BIT(GPIOPDR(port), pin);
+					CLR_BIT(ptr_st_shadow->u8_dir, pin);
+					SET_BIT(ptr_st_shadow->u8_pdr, pin);
 					break;
 				}
 				case OUTPUT_OPEN_DRAIN:
 				{
+					GPIO_SHADOW_PAD_CLR(ptr_st_shadow, pin);
 					SET_BIT(GPIODEN(port), pin);
 					CLR_BIT(GPIOAMSEL(port), pin);
 					CLR_BIT(GPIOAFSEL(port), pin);
 					
-					SET_BIT(GPIODIR(port), pin);
-					SET_BIT(GPIOODR(port), pin);
+					SET_BIT(ptr_st_shadow->u8_dir, pin);
+					SET_BIT(ptr_st_shadow->u8_odr, pin);
+					break;
+				}
+				case ALT_FUNCTION:
+				{
+					if((ZERO == ptr_st_pin_cfg->alt_func) || (GPIO_PCTL_FUNC_MAX < ptr_st_pin_cfg->alt_func))
+					{
+						gpio_error_state = GPIO_INVALID_PIN_CFG;
+					}
+					else
+					{
+						GPIO_SHADOW_PAD_CLR(ptr_st_shadow, pin);
+						
+						/* The peripheral drives the pin, GPIO writes leave it untouched */
+						GPIO_REG_UPDATE(GPIOPCTL(port), GPIO_PCTL_MASK(pin),
+														(uint32_t_) ptr_st_pin_cfg->alt_func << GPIO_PCTL_SHIFT(pin));
+						SET_BIT(GPIODEN(port), pin);
+						CLR_BIT(GPIOAMSEL(port), pin);
+						SET_BIT(GPIOAFSEL(port), pin);
+						
+						CLR_BIT(ptr_st_shadow->u8_dir, pin);
+					}
 					break;
 				}
 				default: gpio_error_state = GPIO_INVALID_PIN_CFG;
 			}			
-			/* Set the pin drive strength */
+			/* Set the pin drive strength (outputs and peripheral driven pins) */
 			if	((GPIO_OK == gpio_error_state) 
-				&& (GET_BIT(GPIODIR(port), pin)))
+				&& ((GET_BIT(ptr_st_shadow->u8_dir, pin)) || (ALT_FUNCTION == ptr_st_pin_cfg->pin_cfg)))
 			{
+				/* Setting a drive select bit clears it in the other two registers */
+				if(ptr_st_pin_cfg->current <= PIN_CURRENT_8MA)
+				{
+					CLR_BIT(ptr_st_shadow->u8_dr2r, pin);
+					CLR_BIT(ptr_st_shadow->u8_dr4r, pin);
+					CLR_BIT(ptr_st_shadow->u8_dr8r, pin);
+				}
+				
 				switch(ptr_st_pin_cfg->current)
 				{
-					case PIN_CURRENT_2MA: SET_BIT(GPIODR2R(port), pin); break;
-					case PIN_CURRENT_4MA: SET_BIT(GPIODR4R(port), pin); break;
-					case PIN_CURRENT_8MA: SET_BIT(GPIODR8R(port), pin); break;
+					case PIN_CURRENT_2MA: SET_BIT(ptr_st_shadow->u8_dr2r, pin); GPIODR2R(port) = ptr_st_shadow->u8_dr2r; break;
+					case PIN_CURRENT_4MA: SET_BIT(ptr_st_shadow->u8_dr4r, pin); GPIODR4R(port) = ptr_st_shadow->u8_dr4r; break;
+					case PIN_CURRENT_8MA: SET_BIT(ptr_st_shadow->u8_dr8r, pin); GPIODR8R(port) = ptr_st_shadow->u8_dr8r; break;
 					default : gpio_error_state = GPIO_ERROR;
 				}
 			}
 			else
 			{
 				/* Do Nothing */
-			}			
+			}
+			
+			/* Write the driver owned registers from the shadow */
+			GPIODIR(port) = ptr_st_shadow->u8_dir;
+			GPIOODR(port) = ptr_st_shadow->u8_odr;
+			/* Setting a PDR bit clears the PUR bit of the pin (and vice versa), the pull-up is written last */
+			GPIOPDR(port) = ptr_st_shadow->u8_pdr;
+			if(GPIO_INVALID_PIN_CFG != gpio_error_state) WRITE_BIT(GPIOPUR(port), pin, GET_BIT(ptr_st_shadow->u8_pur, pin));
+			
+			if(GPIO_OK == gpio_error_state) SET_BIT(ptr_st_shadow->u8_configured, pin);
 		}
 		else
 		{
-			gpio_error_state = GPIO_INVALID_PORT;
+			/* Do Nothing */
 		}
 	}
 	else
@@ -162,6 +302,180 @@ en_gpio_error_t gpio_pin_init  (st_gpio_cfg_t* ptr_st_pin_cfg)
 	return gpio_error_state;
 }
 
+/** 
+ **@breif Function initialize several pins of the same port at once
+ *
+ * This function validates the whole configuration table first, then 
+ * computes the final value of each configuration register and writes
+ * every register once, regardless of the number of pins
+ *
+ ** @Parameters
+ *				[in] ptr_st_port_cfg : pointer to a table of pin configurations (same port and bus)
+ *				[in] u8_a_pins_count : number of entries in the table (GPIO_PORT_CFG_COUNT)
+ *
+ ** @return	GPIO_OK          		 : If the operation is done successfully
+ *					GPIO_INVALID_PORT		 : If the entries are not on the same valid port
+ *					GPIO_INVALID_PIN 		 : If a pin is not valid or is configured twice
+ *					GPIO_INVALID_PIN_CFG : If a pin configuration is not supported
+ *					GPIO_INVALID_BUS 		 : If the entries do not share the same valid bus
+ *					GPIO_ERROR	     		 : If the passed pointer is a null pointer, the table is empty
+ *																 or an output drive strength is invalid
+ */
+en_gpio_error_t gpio_port_init 		 (const st_gpio_cfg_t* ptr_st_port_cfg, uint8_t_ u8_a_pins_count)
+{
+	en_gpio_error_t gpio_error_state = GPIO_OK;
+	
+	/* Pins handled by the table */
+	uint8_t_ u8_pins_mask = ZERO;
+	
+	/* Final bits of each register for the handled pins */
+	uint8_t_ u8_den_mask   = ZERO;
+	uint8_t_ u8_amsel_mask = ZERO;
+	uint8_t_ u8_afsel_clr  = ZERO;
+	uint8_t_ u8_afsel_set  = ZERO;
+	uint32_t_ u32_pctl_clr = ZERO;
+	uint32_t_ u32_pctl_set = ZERO;
+	uint8_t_ u8_dir_mask   = ZERO;
+	uint8_t_ u8_pur_mask   = ZERO;
+	uint8_t_ u8_pdr_mask   = ZERO;
+	uint8_t_ u8_odr_mask   = ZERO;
+	uint8_t_ u8_dr2r_mask  = ZERO;
+	uint8_t_ u8_dr4r_mask  = ZERO;
+	uint8_t_ u8_dr8r_mask  = ZERO;
+	
+	uint8_t_ u8_cfg_idx;
+	
+	if((NULL_PTR == ptr_st_port_cfg) || (ZERO == u8_a_pins_count))
+	{
+		gpio_error_state = GPIO_ERROR;
+	}
+	else
+	{
+		en_gpio_port_t port = ptr_st_port_cfg[0].port;
+		
+		/* Validate the whole table and compute the register masks */
+		for(u8_cfg_idx = 0; (u8_cfg_idx < u8_a_pins_count) && (GPIO_OK == gpio_error_state); u8_cfg_idx++)
+		{
+			const st_gpio_cfg_t* ptr_st_pin_cfg = &ptr_st_port_cfg[u8_cfg_idx];
+			uint8_t_ u8_pin_mask = ZERO;
+			
+			gpio_error_state = port_pin_check(ptr_st_pin_cfg->port, ptr_st_pin_cfg->pin);
+			
+			if(GPIO_OK != gpio_error_state)
+			{
+				/* Do Nothing */
+			}
+			else if(port != ptr_st_pin_cfg->port)
+			{
+				gpio_error_state = GPIO_INVALID_PORT;
+			}
+			else if((ptr_st_port_cfg[0].bus != ptr_st_pin_cfg->bus) || (ptr_st_pin_cfg->bus >= GPIO_BUS_TOTAL))
+			{
+				gpio_error_state = GPIO_INVALID_BUS;
+			}
+			else if(GET_BIT(u8_pins_mask, ptr_st_pin_cfg->pin))
+			{
+				gpio_error_state = GPIO_INVALID_PIN;
+			}
+			else
+			{
+				SET_BIT(u8_pin_mask, ptr_st_pin_cfg->pin);
+				u8_pins_mask |= u8_pin_mask;
+				
+				switch(ptr_st_pin_cfg->pin_cfg)
+				{
+					case INPUT							: u8_den_mask |= u8_pin_mask; break;
+					case OUTPUT							: u8_den_mask |= u8_pin_mask; u8_dir_mask |= u8_pin_mask; break;
+					case INPUT_ANALOG				: u8_amsel_mask |= u8_pin_mask; break;
+					case INPUT_PULL_UP			: u8_den_mask |= u8_pin_mask; u8_pur_mask |= u8_pin_mask; break;
+					case INPUT_PULL_DOWN		: u8_den_mask |= u8_pin_mask; u8_pdr_mask |= u8_pin_mask; break;
+					case OUTPUT_OPEN_DRAIN	: u8_den_mask |= u8_pin_mask; u8_dir_mask |= u8_pin_mask; 
+																		u8_odr_mask |= u8_pin_mask; break;
+					case ALT_FUNCTION				:
+					{
+						if((ZERO == ptr_st_pin_cfg->alt_func) || (GPIO_PCTL_FUNC_MAX < ptr_st_pin_cfg->alt_func))
+						{
+							gpio_error_state = GPIO_INVALID_PIN_CFG;
+						}
+						else
+						{
+							u8_den_mask |= u8_pin_mask;
+							u8_afsel_set |= u8_pin_mask;
+							u32_pctl_clr |= GPIO_PCTL_MASK(ptr_st_pin_cfg->pin);
+							u32_pctl_set |= (uint32_t_) ptr_st_pin_cfg->alt_func << GPIO_PCTL_SHIFT(ptr_st_pin_cfg->pin);
+						}
+						break;
+					}
+					default: gpio_error_state = GPIO_INVALID_PIN_CFG;
+				}
+				
+				/* Analog pins keep their alternate function selection */
+				if((INPUT_ANALOG != ptr_st_pin_cfg->pin_cfg) && (ALT_FUNCTION != ptr_st_pin_cfg->pin_cfg)) u8_afsel_clr |= u8_pin_mask;
+				
+				/* Drive strength of output and peripheral driven pins */
+				if((GPIO_OK == gpio_error_state) && ((u8_dir_mask | u8_afsel_set) & u8_pin_mask))
+				{
+					switch(ptr_st_pin_cfg->current)
+					{
+						case PIN_CURRENT_2MA: u8_dr2r_mask |= u8_pin_mask; break;
+						case PIN_CURRENT_4MA: u8_dr4r_mask |= u8_pin_mask; break;
+						case PIN_CURRENT_8MA: u8_dr8r_mask |= u8_pin_mask; break;
+						default : gpio_error_state = GPIO_ERROR;
+					}
+				}
+				else
+				{
+					/* Do Nothing */
+				}
+			}
+		}
+		
+		if(GPIO_OK == gpio_error_state)
+		{
+			/* Enable the port clock */
+			SET_BIT(RCGCGPIO, port);
+			
+			/* Select the port bus */
+			gpio_set_bus(port, ptr_st_port_cfg[0].bus);
+			
+			st_gpio_shadow_t* ptr_st_shadow = &gl_arr_st_gpio_shadow[port];
+			uint8_t_ u8_drive_mask = u8_dr2r_mask | u8_dr4r_mask | u8_dr8r_mask;
+			
+			/* Update the shadow of the driver owned registers */
+			GPIO_REG_UPDATE(ptr_st_shadow->u8_dir , u8_pins_mask , u8_dir_mask);
+			GPIO_REG_UPDATE(ptr_st_shadow->u8_pur , u8_pins_mask , u8_pur_mask);
+			GPIO_REG_UPDATE(ptr_st_shadow->u8_pdr , u8_pins_mask , u8_pdr_mask);
+			GPIO_REG_UPDATE(ptr_st_shadow->u8_odr , u8_pins_mask , u8_odr_mask);
+			GPIO_REG_UPDATE(ptr_st_shadow->u8_dr2r, u8_drive_mask, u8_dr2r_mask);
+			GPIO_REG_UPDATE(ptr_st_shadow->u8_dr4r, u8_drive_mask, u8_dr4r_mask);
+			GPIO_REG_UPDATE(ptr_st_shadow->u8_dr8r, u8_drive_mask, u8_dr8r_mask);
+			ptr_st_shadow->u8_configured |= u8_pins_mask;
+			
+			/* Write each register once for all the handled pins */
+			GPIO_REG_UPDATE(GPIODEN(port)  , u8_pins_mask, u8_den_mask);
+			GPIO_REG_UPDATE(GPIOAMSEL(port), u8_pins_mask, u8_amsel_mask);
+			GPIO_REG_UPDATE(GPIOPCTL(port) , u32_pctl_clr, u32_pctl_set);
+			GPIO_REG_UPDATE(GPIOAFSEL(port), u8_afsel_clr, u8_afsel_set);
+			GPIODIR(port) = ptr_st_shadow->u8_dir;
+			GPIOODR(port) = ptr_st_shadow->u8_odr;
+			/* Setting a PDR bit clears the PUR bit of the pin (and vice versa), pull-ups are written last */
+			GPIOPDR(port) = ptr_st_shadow->u8_pdr;
+			GPIO_REG_UPDATE(GPIOPUR(port)  , u8_pins_mask, u8_pur_mask);
+			
+			/* Setting a drive select bit clears it in the other two registers */
+			if(u8_dr2r_mask) GPIODR2R(port) = ptr_st_shadow->u8_dr2r;
+			if(u8_dr4r_mask) GPIODR4R(port) = ptr_st_shadow->u8_dr4r;
+			if(u8_dr8r_mask) GPIODR8R(port) = ptr_st_shadow->u8_dr8r;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	
+	return gpio_error_state;
+}
+
 /** 
  ** @breif Function to set the value of an entire port
  *
@@ -176,13 +490,13 @@ en_gpio_error_t gpio_pin_init  (st_gpio_cfg_t* ptr_st_pin_cfg)
  */
 en_gpio_error_t gpio_setPortVal		 (en_gpio_port_t en_a_port,  uint8_t_ u8_a_portVal)
 {
-	en_gpio_error_t gpio_error_state;
+	en_gpio_error_t gpio_error_state = GPIO_OK;
 	
 	/* Check whether the port is valid */
 	if(en_a_port < GPIO_PORT_TOTAL)
 	{
-		/* Check that the port is an output port */
-		if(PORT_SET == GPIODIR(en_a_port))
+		/* Check that all the port pins are output pins */
+		if(gl_arr_u8_gpio_valid_pins[en_a_port] == gl_arr_st_gpio_shadow[en_a_port].u8_dir)
 		{
 				GPIODATA(en_a_port) = u8_a_portVal;
 		}
@@ -199,6 +513,47 @@ en_gpio_error_t gpio_setPortVal		 (en_gpio_port_t en_a_port,  uint8_t_ u8_a_port
 	return gpio_error_state;
 }
 
+/** 
+ ** @breif Function to set the value of a group of pins in the same port
+ *
+ * This function updates only the pins selected by the given mask
+ * with a single store, other pins of the port are untouched
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	 : The port of the desired pins
+ *				[in]  u8_a_pinsMask: Mask of the pins to update (bit n -> pin n)
+ *				[in] 	u8_a_pinsVal : The values to set the masked pins to (bit n -> pin n)
+ *
+ ** @return	GPIO_OK           : If the operation is done successfully
+ *					GPIO_INVALID_PORT : If the passed port is not a valid port
+ *					GPIO_INVALID_PIN  : If the mask contains a pin that is not valid for the port
+ *					GPIO_ERROR				: If any of the masked pins is not configured as an output pin
+ */
+en_gpio_error_t gpio_setPinsMasked (en_gpio_port_t en_a_port, uint8_t_ u8_a_pinsMask, uint8_t_ u8_a_pinsVal)
+{
+	en_gpio_error_t gpio_error_state = GPIO_OK;
+	
+	if(en_a_port >= GPIO_PORT_TOTAL)
+	{
+		gpio_error_state = GPIO_INVALID_PORT;
+	}
+	else if(u8_a_pinsMask & ~gl_arr_u8_gpio_valid_pins[en_a_port])
+	{
+		gpio_error_state = GPIO_INVALID_PIN;
+	}
+	/* Check that all the masked pins are output pins */
+	else if((gl_arr_st_gpio_shadow[en_a_port].u8_dir & u8_a_pinsMask) != u8_a_pinsMask)
+	{
+		gpio_error_state = GPIO_ERROR;
+	}
+	else
+	{
+		GPIODATA_MASKED(en_a_port, u8_a_pinsMask) = u8_a_pinsVal;
+	}
+	
+	return gpio_error_state;
+}
+
 /** 
  ** @breif Function to set the value of a given pin 
  *
@@ -224,12 +579,13 @@ en_gpio_error_t gpio_setPinVal (en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin
 	if(GPIO_OK == gpio_error_state)
 	{
 		/* Check that the pin is an outpun pin */
-		if(GET_BIT(GPIODIR(en_a_port), en_a_pin))
+		if(GET_BIT(gl_arr_st_gpio_shadow[en_a_port].u8_dir, en_a_pin))
 		{
+			/* Single store through the masked data address, other pins are untouched */
 			switch(en_a_pinVal)
 			{
-				case LOW : CLR_BIT(GPIODATA(en_a_port), en_a_pin); break;
-				case HIGH: SET_BIT(GPIODATA(en_a_port), en_a_pin); break;
+				case LOW : GPIODATA_MASKED(en_a_port, (1 << en_a_pin)) = PORT_CLR; break;
+				case HIGH: GPIODATA_MASKED(en_a_port, (1 << en_a_pin)) = PORT_SET; break;
 				default	 : gpio_error_state = GPIO_ERROR;
 			}
 		}
@@ -266,9 +622,11 @@ en_gpio_error_t gpio_togPinVal 		 (en_gpio_port_t en_a_port, en_gpio_pin_t en_a_
 	if(GPIO_OK == gpio_error_state)
 	{
 		/* Check that the pin is an outpun pin */
-		if(GET_BIT(GPIODIR(en_a_port), en_a_pin))
+		if(GET_BIT(gl_arr_st_gpio_shadow[en_a_port].u8_dir, en_a_pin))
 		{
-			TOG_BIT(GPIODATA(en_a_port), en_a_pin);
+			/* The masked address only exposes this pin, so an ISR writing
+			 * other pins of the same port can not be overwritten */
+			GPIODATA_MASKED(en_a_port, (1 << en_a_pin)) ^= PORT_SET;
 		}
 		else
 		{
@@ -342,16 +700,20 @@ en_gpio_error_t gpio_enableInt (en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin
 	
 	if(GPIO_OK == gpio_error_state)
 	{
-		SET_BIT(GPIOIM(en_a_port), en_a_pin);
+		SET_BIT(gl_arr_st_gpio_shadow[en_a_port].u8_im, en_a_pin);
+		GPIOIM(en_a_port) = gl_arr_st_gpio_shadow[en_a_port].u8_im;
 		
+		/* Same priority on every port (see GPIO_IRQ_PRIORITY) */
 		if(GPIO_PORT_F == en_a_port)
 		{
 			/* Todo: */
+			NVIC_SetPriority(GPIOF_IRQn, GPIO_IRQ_PRIORITY);
 			NVIC_EnableIRQ(GPIOF_IRQn);
 			__enable_irq();
 		}
 		else
 		{
+			NVIC_SetPriority((IRQn_Type) en_a_port, GPIO_IRQ_PRIORITY);
 			NVIC_EnableIRQ((IRQn_Type) en_a_port);
 			__enable_irq();
 		}
@@ -379,7 +741,8 @@ en_gpio_error_t gpio_disableInt(en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin
 	
 	if(GPIO_OK == gpio_error_state)
 	{
-		CLR_BIT(GPIOIM(en_a_port), en_a_pin);
+		CLR_BIT(gl_arr_st_gpio_shadow[en_a_port].u8_im, en_a_pin);
+		GPIOIM(en_a_port) = gl_arr_st_gpio_shadow[en_a_port].u8_im;
 	}
 	else { /* Do Nothing */}
 	
@@ -411,32 +774,40 @@ en_gpio_error_t gpio_setIntSense(en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pi
 	{
 		if(en_a_event < INT_EVENT_TOTAL)
 		{
+			st_gpio_shadow_t* ptr_st_shadow = &gl_arr_st_gpio_shadow[en_a_port];
 			uint32_t_ pin_mask = NULL;
 			SET_BIT(pin_mask, en_a_pin);
 			
 			/* Disable the interrupt */
-			CLR_BIT(GPIOIM(en_a_port), en_a_pin);
+			GPIOIM(en_a_port) = ptr_st_shadow->u8_im & ~pin_mask;
 			
 			/* Configure the interrupt sense */
-			if(GET_BIT(en_a_event, GPIO_INT_SENSE_MASK)) SET_BIT(GPIOIS(en_a_port), en_a_pin);
-			else CLR_BIT(GPIOIS(en_a_port), en_a_pin);
+			if(GET_BIT(en_a_event, GPIO_INT_SENSE_MASK)) SET_BIT(ptr_st_shadow->u8_is, en_a_pin);
+			else CLR_BIT(ptr_st_shadow->u8_is, en_a_pin);
 			
 			if(BOTH_EDGES == en_a_event)
 			{
-				SET_BIT(GPIOIBE(en_a_port), en_a_pin);
+				SET_BIT(ptr_st_shadow->u8_ibe, en_a_pin);
 			}
 			else
 			{
+				CLR_BIT(ptr_st_shadow->u8_ibe, en_a_pin);
+				
 				/* Configure the interrupt level */
-				if(GET_BIT(en_a_event, GPIO_INT_LEVEL_MASK)) SET_BIT(GPIOIEV(en_a_port), en_a_pin);
-				else CLR_BIT(GPIOIEV(en_a_port), en_a_pin);
+				if(GET_BIT(en_a_event, GPIO_INT_LEVEL_MASK)) SET_BIT(ptr_st_shadow->u8_iev, en_a_pin);
+				else CLR_BIT(ptr_st_shadow->u8_iev, en_a_pin);
 			}
 			
-			/* Clear the raw interrupt flag */
-			CLR_BIT(GPIORIS(en_a_port), en_a_pin);
+			GPIOIS(en_a_port)  = ptr_st_shadow->u8_is;
+			GPIOIBE(en_a_port) = ptr_st_shadow->u8_ibe;
+			GPIOIEV(en_a_port) = ptr_st_shadow->u8_iev;
+			
+			/* Clear the interrupt flag raised by the reconfiguration */
+			GPIOICR(en_a_port) = pin_mask;
 			
 			/* Enable the interrupt */
-			SET_BIT(GPIOIM(en_a_port), en_a_pin);
+			SET_BIT(ptr_st_shadow->u8_im, en_a_pin);
+			GPIOIM(en_a_port) = ptr_st_shadow->u8_im;
 		}
 		else
 		{
@@ -488,208 +859,262 @@ en_gpio_error_t gpio_setIntCallback(en_gpio_port_t en_a_port, en_gpio_pin_t en_a
 	
 	return gpio_error_state;
 }
-/*---------------------------------------------------------/
-/ INTERRUPT HANDLERS
-/---------------------------------------------------------*/
-void GPIOA_Handler(void)
+/** 
+ ** @breif Function to get the driver shadow of a port configuration
+ *
+ * This function copies the RAM shadow of the port registers that 
+ * the driver uses instead of reading them back from the bus
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	   : The desired port
+ *				[out] ptr_st_shadow  : pointer to the structure to copy the shadow to
+ *
+ ** @return	GPIO_OK          : If the operation is done successfully
+ *					GPIO_INVALID_PORT: If the passed port is not a valid port
+ *					GPIO_ERROR	     : If the passed pointer is a null pointer
+ */
+en_gpio_error_t gpio_getShadow(en_gpio_port_t en_a_port, st_gpio_shadow_t* ptr_st_shadow)
 {
-	en_gpio_pin_t pin = GPIO_PIN_TOTAL;
-	
-	if		 (GET_BIT(GPIOMIS(GPIO_PORT_A), GPIO_PIN_0)) pin = GPIO_PIN_0;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_A), GPIO_PIN_1)) pin = GPIO_PIN_1;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_A), GPIO_PIN_2)) pin = GPIO_PIN_2;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_A), GPIO_PIN_3)) pin = GPIO_PIN_3;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_A), GPIO_PIN_4)) pin = GPIO_PIN_4;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_A), GPIO_PIN_5)) pin = GPIO_PIN_5;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_A), GPIO_PIN_6)) pin = GPIO_PIN_6;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_A), GPIO_PIN_7)) pin = GPIO_PIN_7;
-	else{/* Do Nothing */}
+	en_gpio_error_t gpio_error_state = GPIO_OK;
 	
-	/* Clear the interrupt flag */
-	SET_BIT(GPIOICR(GPIO_PORT_A), pin);
-
-	if(pin != GPIO_PIN_TOTAL)
+	if(NULL_PTR == ptr_st_shadow)
 	{
-		if(arr_gpio_cbf[GPIO_PORT_A][pin] != NULL)
-		{
-			arr_gpio_cbf[GPIO_PORT_A][pin]();
-		}
-		else
-		{
-			/* Do Nothing */
-		}
+		gpio_error_state = GPIO_ERROR;
+	}
+	else if(en_a_port >= GPIO_PORT_TOTAL)
+	{
+		gpio_error_state = GPIO_INVALID_PORT;
 	}
 	else
 	{
-		/* Do Nothing */
+		*ptr_st_shadow = gl_arr_st_gpio_shadow[en_a_port];
 	}
+	
+	return gpio_error_state;
 }
 
-void GPIOB_Handler(void)
+/** 
+ ** @breif Function to switch a pin interrupt to event mode
+ *
+ * In event mode the GPIO ISR does not call the pin callback, it pushes
+ * a timestamped event to a lock-free queue that the main loop drains 
+ * with gpio_readEvents, keeping the ISR time constant
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	 : The port of the desired pin
+ *				[in]  en_a_pin   	 : The desired pin 
+ *				[in]  bool_a_enable: TRUE to queue events, FALSE to call the pin callback
+ *
+ ** @return	GPIO_OK          : If the operation is done successfully
+ *					GPIO_INVALID_PORT: If the passed port is not a valid port
+ *					GPIO_INVALID_PIN : If the passed pin is not a valid pin
+ */
+en_gpio_error_t gpio_setEventMode(en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin, boolean bool_a_enable)
 {
-	en_gpio_pin_t pin = GPIO_PIN_TOTAL;
-	
-	if		 (GET_BIT(GPIOMIS(GPIO_PORT_B), GPIO_PIN_0)) pin = GPIO_PIN_0;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_B), GPIO_PIN_1)) pin = GPIO_PIN_1;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_B), GPIO_PIN_2)) pin = GPIO_PIN_2;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_B), GPIO_PIN_3)) pin = GPIO_PIN_3;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_B), GPIO_PIN_4)) pin = GPIO_PIN_4;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_B), GPIO_PIN_5)) pin = GPIO_PIN_5;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_B), GPIO_PIN_6)) pin = GPIO_PIN_6;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_B), GPIO_PIN_7)) pin = GPIO_PIN_7;
-	else{/* Do Nothing */}
-
-	/* Clear the interrupt flag */
-	SET_BIT(GPIOICR(GPIO_PORT_B), pin);
+	en_gpio_error_t gpio_error_state = port_pin_check(en_a_port, en_a_pin);
 	
-	if(pin != GPIO_PIN_TOTAL)
+	if(GPIO_OK == gpio_error_state)
 	{
-		if(arr_gpio_cbf[GPIO_PORT_B][pin] != NULL)
+		if(TRUE == bool_a_enable)
 		{
-			arr_gpio_cbf[GPIO_PORT_B][pin]();
+			/* Start the core cycle counter used to timestamp the events */
+			CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+			DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 		}
 		else
 		{
 			/* Do Nothing */
 		}
+		
+		WRITE_BIT(gl_arr_u8_gpio_event_pins[en_a_port], en_a_pin, bool_a_enable);
+	}
+	else { /* Do Nothing */}
+	
+	return gpio_error_state;
+}
+
+/** 
+ ** @breif Function to drain the queued edge events
+ *
+ * This function copies up to u8_a_max_events of the oldest queued events
+ * to the given array, it must only be called from one context (main loop)
+ *
+ ** @Parameters
+ *				[out] ptr_st_events   : pointer to the array to copy the events to
+ *				[in]  u8_a_max_events : capacity of the given array
+ *				[out] pu8_a_count     : pointer to variable to store the number of copied events
+ *
+ ** @return	GPIO_OK          : If the operation is done successfully
+ *					GPIO_ERROR	     : If a passed pointer is a null pointer
+ */
+en_gpio_error_t gpio_readEvents(st_gpio_event_t* ptr_st_events, uint8_t_ u8_a_max_events, uint8_t_* pu8_a_count)
+{
+	en_gpio_error_t gpio_error_state = GPIO_OK;
+	
+	if((NULL_PTR == ptr_st_events) || (NULL_PTR == pu8_a_count))
+	{
+		gpio_error_state = GPIO_ERROR;
 	}
 	else
 	{
-		/* Do Nothing */
+		uint8_t_ u8_tail  = gl_u8_gpio_event_tail;
+		uint8_t_ u8_head  = gl_u8_gpio_event_head;
+		uint8_t_ u8_count = 0;
+		
+		while((u8_tail != u8_head) && (u8_count < u8_a_max_events))
+		{
+			ptr_st_events[u8_count] = gl_arr_st_gpio_events[u8_tail];
+			u8_tail = (u8_tail + 1) & GPIO_EVENT_IDX_MASK;
+			u8_count++;
+		}
+		
+		/* Release the slots only after they were copied */
+		__DMB();
+		gl_u8_gpio_event_tail = u8_tail;
+		
+		*pu8_a_count = u8_count;
 	}
-}	
+	
+	return gpio_error_state;
+}
 
-void GPIOC_Handler(void)
+/** 
+ ** @breif Function to get the number of events dropped because the queue was full
+ *
+ ** @Parameters
+ *				[out] pu32_a_dropped : pointer to variable to store the dropped events count
+ *
+ ** @return	GPIO_OK          : If the operation is done successfully
+ *					GPIO_ERROR	     : If the passed pointer is a null pointer
+ */
+en_gpio_error_t gpio_getDroppedEvents(uint32_t_* pu32_a_dropped)
 {
-	en_gpio_pin_t pin = GPIO_PIN_TOTAL;
-	
-	if		 (GET_BIT(GPIOMIS(GPIO_PORT_C), GPIO_PIN_0)) pin = GPIO_PIN_0;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_C), GPIO_PIN_1)) pin = GPIO_PIN_1;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_C), GPIO_PIN_2)) pin = GPIO_PIN_2;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_C), GPIO_PIN_3)) pin = GPIO_PIN_3;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_C), GPIO_PIN_4)) pin = GPIO_PIN_4;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_C), GPIO_PIN_5)) pin = GPIO_PIN_5;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_C), GPIO_PIN_6)) pin = GPIO_PIN_6;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_C), GPIO_PIN_7)) pin = GPIO_PIN_7;
-	else{/* Do Nothing */}
-
-	/* Clear the interrupt flag */
-	SET_BIT(GPIOICR(GPIO_PORT_C), pin);
+	en_gpio_error_t gpio_error_state = GPIO_OK;
 	
-	if(pin != GPIO_PIN_TOTAL)
+	if(NULL_PTR != pu32_a_dropped)
 	{
-		if(arr_gpio_cbf[GPIO_PORT_C][pin] != NULL)
-		{
-			arr_gpio_cbf[GPIO_PORT_C][pin]();
-		}
-		else
-		{
-			/* Do Nothing */
-		}
+		*pu32_a_dropped = gl_u32_gpio_events_dropped;
 	}
 	else
 	{
-		/* Do Nothing */
+		gpio_error_state = GPIO_ERROR;
 	}
+	
+	return gpio_error_state;
 }
 
-void GPIOD_Handler(void)
+/** 
+ ** @breif Function to push an edge event to the event queue (ISR context)
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	    : The port that triggered the interrupt
+ *				[in]  en_a_pin   	    : The pin that triggered the interrupt
+ *				[in]  u8_a_levels 	  : The port pins levels sampled at ISR entry
+ *				[in]  u32_a_timestamp : The cycle counter sampled at ISR entry
+ */
+static void gpio_push_event(en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin, uint8_t_ u8_a_levels, uint32_t_ u32_a_timestamp)
 {
-	en_gpio_pin_t pin = GPIO_PIN_TOTAL;
-	
-	if		 (GET_BIT(GPIOMIS(GPIO_PORT_D), GPIO_PIN_0)) pin = GPIO_PIN_0;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_D), GPIO_PIN_1)) pin = GPIO_PIN_1;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_D), GPIO_PIN_2)) pin = GPIO_PIN_2;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_D), GPIO_PIN_3)) pin = GPIO_PIN_3;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_D), GPIO_PIN_4)) pin = GPIO_PIN_4;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_D), GPIO_PIN_5)) pin = GPIO_PIN_5;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_D), GPIO_PIN_6)) pin = GPIO_PIN_6;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_D), GPIO_PIN_7)) pin = GPIO_PIN_7;
-	else{/* Do Nothing */}
-
-	/* Clear the interrupt flag */
-	SET_BIT(GPIOICR(GPIO_PORT_D), pin);
+	uint8_t_ u8_head = gl_u8_gpio_event_head;
+	uint8_t_ u8_next = (u8_head + 1) & GPIO_EVENT_IDX_MASK;
 	
-	if(pin != GPIO_PIN_TOTAL)
+	if(u8_next != gl_u8_gpio_event_tail)
 	{
-		if(arr_gpio_cbf[GPIO_PORT_D][pin] != NULL)
-		{
-			arr_gpio_cbf[GPIO_PORT_D][pin]();
-		}
-		else
-		{
-			/* Do Nothing */
-		}
+		gl_arr_st_gpio_events[u8_head].u32_timestamp = u32_a_timestamp;
+		gl_arr_st_gpio_events[u8_head].port  = en_a_port;
+		gl_arr_st_gpio_events[u8_head].pin   = en_a_pin;
+		gl_arr_st_gpio_events[u8_head].level = (en_gpio_pin_level_t) GET_BIT(u8_a_levels, en_a_pin);
+		
+		/* Publish the slot only after it was written */
+		__DMB();
+		gl_u8_gpio_event_head = u8_next;
 	}
 	else
 	{
-		/* Do Nothing */
+		/* Queue full */
+		gl_u32_gpio_events_dropped++;
 	}
 }
 
-
-void GPIOE_Handler(void)
+/** 
+ ** @breif Function to service every pending interrupt of a given port
+ *
+ * This function reads the masked interrupt status once, clears all the
+ * pending flags with a single write then calls the callback of each 
+ * pending pin, so simultaneous edges are serviced in one ISR entry
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	 : The port that triggered the interrupt
+ */
+static void gpio_irq_dispatch(en_gpio_port_t en_a_port)
 {
-	en_gpio_pin_t pin = GPIO_PIN_TOTAL;
+	uint32_t_ u32_timestamp = DWT->CYCCNT;
+	uint32_t_ u32_pending_pins = GPIOMIS(en_a_port);
+	uint8_t_  u8_levels = ZERO;
+	en_gpio_pin_t pin;
 	
-	if		 (GET_BIT(GPIOMIS(GPIO_PORT_E), GPIO_PIN_0)) pin = GPIO_PIN_0;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_E), GPIO_PIN_1)) pin = GPIO_PIN_1;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_E), GPIO_PIN_2)) pin = GPIO_PIN_2;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_E), GPIO_PIN_3)) pin = GPIO_PIN_3;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_E), GPIO_PIN_4)) pin = GPIO_PIN_4;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_E), GPIO_PIN_5)) pin = GPIO_PIN_5;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_E), GPIO_PIN_6)) pin = GPIO_PIN_6;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_E), GPIO_PIN_7)) pin = GPIO_PIN_7;
-	else{/* Do Nothing */}
-
-	/* Clear the interrupt flag */
-	SET_BIT(GPIOICR(GPIO_PORT_E), pin);
+	/* Clear the interrupt flags of all serviced pins */
+	GPIOICR(en_a_port) = u32_pending_pins;
 	
-	if(pin != GPIO_PIN_TOTAL)
+	/* Sample the levels once for all the pending pins in event mode */
+	if(u32_pending_pins & gl_arr_u8_gpio_event_pins[en_a_port])
 	{
-		if(arr_gpio_cbf[GPIO_PORT_E][pin] != NULL)
-		{
-			arr_gpio_cbf[GPIO_PORT_E][pin]();
-		}
-		else
-		{
-			/* Do Nothing */
-		}
+		u8_levels = GPIODATA_MASKED(en_a_port, u32_pending_pins & gl_arr_u8_gpio_event_pins[en_a_port]);
 	}
 	else
 	{
 		/* Do Nothing */
 	}
-}
-
-void GPIOF_Handler(void)
-{
-	en_gpio_pin_t pin = GPIO_PIN_TOTAL;
-	
-	if		 (GET_BIT(GPIOMIS(GPIO_PORT_F), GPIO_PIN_0)) pin = GPIO_PIN_0;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_F), GPIO_PIN_1)) pin = GPIO_PIN_1;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_F), GPIO_PIN_2)) pin = GPIO_PIN_2;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_F), GPIO_PIN_3)) pin = GPIO_PIN_3;
-	else if(GET_BIT(GPIOMIS(GPIO_PORT_F), GPIO_PIN_4)) pin = GPIO_PIN_4;
-	else{/* Do Nothing */}
-
-	/* Clear the interrupt flag */
-	SET_BIT(GPIOICR(GPIO_PORT_F), pin);
 	
-	if(pin != GPIO_PIN_TOTAL)
+	while(ZERO != u32_pending_pins)
 	{
-		if(arr_gpio_cbf[GPIO_PORT_F][pin] != NULL)
+		/* Index of the highest pending pin */
+		pin = (en_gpio_pin_t) (GPIO_MIS_MSB - __CLZ(u32_pending_pins));
+		CLR_BIT(u32_pending_pins, pin);
+		
+		if(GET_BIT(gl_arr_u8_gpio_event_pins[en_a_port], pin))
+		{
+			gpio_push_event(en_a_port, pin, u8_levels, u32_timestamp);
+		}
+		else if(arr_gpio_cbf[en_a_port][pin] != NULL)
 		{
-			arr_gpio_cbf[GPIO_PORT_F][pin]();
+			arr_gpio_cbf[en_a_port][pin]();
 		}
 		else
 		{
 			/* Do Nothing */
 		}
 	}
-	else
-	{
-		/* Do Nothing */
-	}
 }
 
+/*---------------------------------------------------------/
+/ INTERRUPT HANDLERS
+/---------------------------------------------------------*/
+void GPIOA_Handler(void)
+{
+	gpio_irq_dispatch(GPIO_PORT_A);
+}
+
+void GPIOB_Handler(void)
+{
+	gpio_irq_dispatch(GPIO_PORT_B);
+}
+
+void GPIOC_Handler(void)
+{
+	gpio_irq_dispatch(GPIO_PORT_C);
+}
+
+void GPIOD_Handler(void)
+{
+	gpio_irq_dispatch(GPIO_PORT_D);
+}
+
+void GPIOE_Handler(void)
+{
+	gpio_irq_dispatch(GPIO_PORT_E);
+}
+
+void GPIOF_Handler(void)
+{
+	gpio_irq_dispatch(GPIO_PORT_F);
+}
@@ -0,0 +1,260 @@
+/**
+ * @file    :   gpt_interface.h
+ * @brief   :   Header File contains all GPT (General Purpose Timer) functions' prototypes, typedefs and pre-configurations
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef GPT_INTERFACE_H
+#define GPT_INTERFACE_H
+
+#include "std.h"
+
+// timers are clocked by the system clock (keep in sync with SYS_CLOCK_MHZ)
+#define GPT_CLOCK_MHZ   8
+
+// NVIC priority of the time-out interrupts (0 = highest): below SysTick, above the GPIO ports
+#define GPT_IRQ_PRIORITY    1
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum{
+    /* 16/32-bit timer blocks */
+    GPT_TIMER_0     =   0   ,
+    GPT_TIMER_1             ,
+    GPT_TIMER_2             ,
+    GPT_TIMER_3             ,
+    GPT_TIMER_4             ,
+    GPT_TIMER_5             ,
+
+    /* 32/64-bit wide timer blocks */
+    GPT_WTIMER_0            ,
+    GPT_WTIMER_1            ,
+    GPT_WTIMER_2            ,
+    GPT_WTIMER_3            ,
+    GPT_WTIMER_4            ,
+    GPT_WTIMER_5            ,
+
+    GPT_TIMER_TOTAL
+}en_gpt_timer_t;
+
+typedef enum{
+    GPT_CHANNEL_A   =   0   ,
+    GPT_CHANNEL_B           ,
+    GPT_CHANNEL_TOTAL
+}en_gpt_channel_t;
+
+typedef enum{
+    /* A and B run independently: 16-bit + 8-bit prescaler (wide: 32-bit + 16-bit prescaler) */
+    GPT_WIDTH_INDIVIDUAL    =   0   ,
+
+    /* A and B chained as one timer on channel A: 32-bit (wide: 64-bit), no prescaler */
+    GPT_WIDTH_CONCATENATED          ,
+
+    GPT_WIDTH_TOTAL
+}en_gpt_width_t;
+
+typedef enum{
+    /* counts down once and stops */
+    GPT_MODE_ONE_SHOT   =   0   ,
+
+    /* reloads automatically on every time-out */
+    GPT_MODE_PERIODIC           ,
+
+    /* periodic, drives the CCP pin high from reload to the duty match (individual width only,
+     * the prescaler extends the counter: 24-bit, wide 48-bit) */
+    GPT_MODE_PWM                ,
+
+    GPT_MODE_TOTAL
+}en_gpt_mode_t;
+
+typedef enum{
+    GPT_TIME_US     =   0   ,
+    GPT_TIME_MS             ,
+    GPT_TIME_S              ,
+    GPT_TIME_UNIT_TOTAL
+}en_gpt_time_unit_t;
+
+typedef enum{
+    GPT_OK              =   0   ,
+    GPT_INVALID_CONFIG          ,
+    GPT_INVALID_ARGS            ,
+    GPT_OUT_OF_RANGE            ,
+}en_gpt_error_t;
+
+typedef void (*fun_gpt_cb_t)(void * ptr_v_ctx);
+
+
+/*----------------------------------------------------------/
+/- STRUCTURES
+/----------------------------------------------------------*/
+typedef struct{
+
+    en_gpt_timer_t en_gpt_timer;
+
+    /* ignored when concatenated (the chained timer is accessed as channel A) */
+    en_gpt_channel_t en_gpt_channel;
+
+    /* applies to the whole block, both channels of an individual block must use it */
+    en_gpt_width_t en_gpt_width;
+
+    en_gpt_mode_t en_gpt_mode;
+
+}st_gpt_cfg_t;
+
+/**
+ * @brief                       : Initializes a GPT channel (enables the block clock), the channel is left stopped
+ *
+ * @param ptr_st_a_gpt_cfg        : Pointer to GPT Configuration
+ *
+ * @return  GPT_OK              :   In case of Successful Operation
+ *          GPT_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ *          GPT_INVALID_CONFIG  :   In case of Failed Operation (Invalid GPT Config Given, PWM concatenated, or a
+ *                                  width different from the other channel of the block)
+ */
+en_gpt_error_t gpt_init(const st_gpt_cfg_t * ptr_st_a_gpt_cfg);
+
+
+/**
+ * @brief                       : Starts (or restarts) a channel for the given time
+ *
+ * @param en_a_timer              : Timer block
+ * @param en_a_channel            : Timer channel (GPT_CHANNEL_A when concatenated)
+ * @param u32_a_time              : Time-out (and reload period in periodic / PWM mode)
+ * @param en_a_unit               : Unit of u32_a_time
+ * @note                        : Times above the counter range use the prescaler, rounded to the nearest
+ *                                prescaled count (max error half a prescaler step)
+ *                                Range at 8 MHz: individual ~2 s (wide ~1 year), concatenated ~9 min (wide any)
+ *
+ * @return  GPT_OK              :   In case of Successful Operation
+ *          GPT_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given or zero time)
+ *          GPT_INVALID_CONFIG  :   In case of Failed Operation (Channel not initialized)
+ *          GPT_OUT_OF_RANGE    :   In case the time does not fit the channel counter and prescaler
+ */
+en_gpt_error_t gpt_start(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel,
+                         uint32_t_ u32_a_time, en_gpt_time_unit_t en_a_unit);
+
+
+/**
+ * @brief                       : Stops a channel, the counter keeps its value
+ *
+ * @param en_a_timer              : Timer block
+ * @param en_a_channel            : Timer channel
+ *
+ * @return  GPT_OK              :   In case of Successful Operation
+ *          GPT_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ *          GPT_INVALID_CONFIG  :   In case of Failed Operation (Channel not initialized)
+ */
+en_gpt_error_t gpt_stop(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel);
+
+
+/**
+ * @brief                       : Gets the time elapsed in the running period
+ *
+ * @param en_a_timer              : Timer block
+ * @param en_a_channel            : Timer channel
+ * @param ptr_u64_a_elapsed_us    : Pointer to store the elapsed time in us (full period once a one shot expired)
+ *
+ * @return  GPT_OK              :   In case of Successful Operation
+ *          GPT_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ *          GPT_INVALID_CONFIG  :   In case of Failed Operation (Channel not initialized or never started)
+ */
+en_gpt_error_t gpt_get_elapsed(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel,
+                               uint64_t_ * ptr_u64_a_elapsed_us);
+
+
+/**
+ * @brief                       : Gets the time left to the next time-out
+ *
+ * @param en_a_timer              : Timer block
+ * @param en_a_channel            : Timer channel
+ * @param ptr_u64_a_remaining_us  : Pointer to store the remaining time in us (0 once a one shot expired)
+ *
+ * @return  GPT_OK              :   In case of Successful Operation
+ *          GPT_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ *          GPT_INVALID_CONFIG  :   In case of Failed Operation (Channel not initialized or never started)
+ */
+en_gpt_error_t gpt_get_remaining(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel,
+                                 uint64_t_ * ptr_u64_a_remaining_us);
+
+
+/**
+ * @brief                       : Enables the time-out interrupt of a channel (and its NVIC line)
+ *
+ * @param en_a_timer              : Timer block
+ * @param en_a_channel            : Timer channel
+ * @note                        : The NVIC line is set to GPT_IRQ_PRIORITY
+ *
+ * @return  GPT_OK              :   In case of Successful Operation
+ *          GPT_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ *          GPT_INVALID_CONFIG  :   In case of Failed Operation (Channel not initialized)
+ */
+en_gpt_error_t gpt_enable_interrupt(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel);
+
+
+/**
+ * @brief                       : Disables the time-out interrupt of a channel
+ *
+ * @param en_a_timer              : Timer block
+ * @param en_a_channel            : Timer channel
+ *
+ * @return  GPT_OK              :   In case of Successful Operation
+ *          GPT_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ *          GPT_INVALID_CONFIG  :   In case of Failed Operation (Channel not initialized)
+ */
+en_gpt_error_t gpt_disable_interrupt(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel);
+
+
+/**
+ * @brief                       : Sets the period that follows the running one of a periodic channel
+ *
+ * @param en_a_timer              : Timer block
+ * @param en_a_channel            : Timer channel
+ * @param u32_a_ticks             : Next period in timer clocks (GPT_CLOCK_MHZ per us)
+ * @note                        : Loaded by the hardware at the coming time-out, so a callback re-programming every
+ *                                period adds no drift or latency. Needs a channel started without prescaler
+ *                                (period within the counter range). gpt_get_elapsed / gpt_get_remaining keep
+ *                                using the gpt_start period
+ *
+ * @return  GPT_OK              :   In case of Successful Operation
+ *          GPT_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given or zero ticks)
+ *          GPT_INVALID_CONFIG  :   In case of Failed Operation (Channel not periodic, or never started)
+ *          GPT_OUT_OF_RANGE    :   In case the ticks do not fit the counter, or the channel uses the prescaler
+ */
+en_gpt_error_t gpt_set_next_period(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel, uint32_t_ u32_a_ticks);
+
+
+/**
+ * @brief                       : Sets the PWM duty cycle of a channel in GPT_MODE_PWM
+ *
+ * @param en_a_timer              : Timer block
+ * @param en_a_channel            : Timer channel
+ * @param u16_a_duty_permille     : High time in 1/1000 of the period (0 -> 1000)
+ * @note                        : Applied on the next period boundary (no glitch), kept across gpt_start.
+ *                                0 and 1000 are one timer clock short of constant low/high
+ *
+ * @return  GPT_OK              :   In case of Successful Operation
+ *          GPT_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ *          GPT_INVALID_CONFIG  :   In case of Failed Operation (Channel not initialized in PWM mode)
+ */
+en_gpt_error_t gpt_set_pwm_duty(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel,
+                                uint16_t_ u16_a_duty_permille);
+
+
+/**
+ * @brief                       : Sets the function called from the channel interrupt on every time-out
+ *
+ * @param en_a_timer              : Timer block
+ * @param en_a_channel            : Timer channel
+ * @param fun_ptr_a_cb            : Pointer to callback fn (NULL_PTR to remove)
+ * @param ptr_v_a_ctx             : Context pointer passed back to the callback
+ *
+ * @return  GPT_OK              :   In case of Successful Operation
+ *          GPT_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ */
+en_gpt_error_t gpt_set_callback(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel,
+                                fun_gpt_cb_t fun_ptr_a_cb, void * ptr_v_a_ctx);
+
+#endif //GPT_INTERFACE_H
@@ -0,0 +1,9 @@
+#include "gpt_linking_cfg.h"
+
+st_gpt_cfg_t gl_st_gpt_cfg_0 =
+{
+        .en_gpt_timer   = GPT_WTIMER_0,
+        .en_gpt_channel = GPT_CHANNEL_A,
+        .en_gpt_width   = GPT_WIDTH_INDIVIDUAL,
+        .en_gpt_mode    = GPT_MODE_ONE_SHOT
+};
@@ -0,0 +1,8 @@
+#ifndef GPT_LINKING_CFG_H
+#define GPT_LINKING_CFG_H
+
+#include "gpt_interface.h"
+
+extern st_gpt_cfg_t gl_st_gpt_cfg_0;
+
+#endif //GPT_LINKING_CFG_H
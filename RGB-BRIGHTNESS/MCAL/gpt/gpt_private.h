@@ -0,0 +1,87 @@
+/**
+ * @file    :   gpt_private.h
+ * @brief   :   Header File contains GPT registers, bits and private macros
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef GPT_PRIVATE_H
+#define GPT_PRIVATE_H
+
+#include "std.h"
+
+/* GPTM register block, A/B register pairs are indexed by en_gpt_channel_t */
+typedef struct
+{
+    volatile uint32_t_ CFG;                             /* 0x000 : GPTM Configuration */
+    volatile uint32_t_ TnMR[GPT_CHANNEL_TOTAL];         /* 0x004 - 0x008 : GPTM Timer A/B Mode */
+    volatile uint32_t_ CTL;                             /* 0x00C : GPTM Control */
+    volatile uint32_t_ SYNC;                            /* 0x010 : GPTM Synchronize (timer 0 only) */
+    volatile uint32_t_ RESERVED0;                       /* 0x014 */
+    volatile uint32_t_ IMR;                             /* 0x018 : GPTM Interrupt Mask */
+    volatile uint32_t_ RIS;                             /* 0x01C : GPTM Raw Interrupt Status */
+    volatile uint32_t_ MIS;                             /* 0x020 : GPTM Masked Interrupt Status */
+    volatile uint32_t_ ICR;                             /* 0x024 : GPTM Interrupt Clear */
+    volatile uint32_t_ TnILR[GPT_CHANNEL_TOTAL];        /* 0x028 - 0x02C : GPTM Timer A/B Interval Load */
+    volatile uint32_t_ TnMATCHR[GPT_CHANNEL_TOTAL];     /* 0x030 - 0x034 : GPTM Timer A/B Match */
+    volatile uint32_t_ TnPR[GPT_CHANNEL_TOTAL];         /* 0x038 - 0x03C : GPTM Timer A/B Prescale */
+    volatile uint32_t_ TnPMR[GPT_CHANNEL_TOTAL];        /* 0x040 - 0x044 : GPTM Timer A/B Prescale Match */
+    volatile uint32_t_ TnR[GPT_CHANNEL_TOTAL];          /* 0x048 - 0x04C : GPTM Timer A/B */
+    volatile uint32_t_ TnV[GPT_CHANNEL_TOTAL];          /* 0x050 - 0x054 : GPTM Timer A/B Value */
+    volatile uint32_t_ RTCPD;                           /* 0x058 : GPTM RTC Predivide */
+    volatile uint32_t_ TnPS[GPT_CHANNEL_TOTAL];         /* 0x05C - 0x060 : GPTM Timer A/B Prescale Snapshot */
+    volatile uint32_t_ TnPV[GPT_CHANNEL_TOTAL];         /* 0x064 - 0x068 : GPTM Timer A/B Prescale Value */
+}st_gpt_regs_t;
+
+/* block base addresses, 16/32-bit timers then 32/64-bit wide timers (en_gpt_timer_t order) */
+#define GPT_TIMER_BASE(X)       (0x40030000 + ((X) * 0x1000))           /* Timer 0 -> 5 */
+#define GPT_WTIMER_BASE(X)      ((X) < 2 ? (0x40036000 + ((X) * 0x1000)) : (0x4004C000 + (((X) - 2) * 0x1000)))
+
+#define GPT_REGS(X)             (gl_arr_ptr_st_gpt_regs[X])
+
+#define RCGCTIMER               *((volatile uint32_t_*) 0x400FE604)     /* 16/32-bit Timer Run Mode Clock Gating Control */
+#define RCGCWTIMER              *((volatile uint32_t_*) 0x400FE65C)     /* 32/64-bit Wide Timer Run Mode Clock Gating Control */
+#define PRTIMER                 *((volatile uint32_t_*) 0x400FEA04)     /* 16/32-bit Timer Peripheral Ready */
+#define PRWTIMER                *((volatile uint32_t_*) 0x400FEA5C)     /* 32/64-bit Wide Timer Peripheral Ready */
+
+#define GPT_WTIMER_FIRST        GPT_WTIMER_0
+#define GPT_IS_WIDE(X)          ((X) >= GPT_WTIMER_FIRST)
+
+// GPTMCFG values
+#define GPT_CFG_CONCATENATED    0x0     // 32-bit (wide: 64-bit) timer
+#define GPT_CFG_INDIVIDUAL      0x4     // 16-bit (wide: 32-bit) timers
+
+// GPTMTnMR bits
+#define GPT_TnMR_TnMR_MASK      0x3
+#define GPT_TnMR_ONE_SHOT       0x1
+#define GPT_TnMR_PERIODIC       0x2
+#define GPT_TnMR_TnAMS          3       // alternate mode select: PWM
+#define GPT_TnMR_TnCDIR         4       // count up (cleared: count down)
+#define GPT_TnMR_TnILD          8       // interval load takes effect on the next time-out
+#define GPT_TnMR_TnMRSU         10      // match update takes effect on the next time-out
+
+// GPTMCTL / GPTMIMR / GPTMICR bits of channel A, channel B bits are 8 positions up
+#define GPT_CHANNEL_BIT(BIT, CHANNEL)   ((BIT) + ((CHANNEL) * 8))
+#define GPT_CTL_TnEN            0       // timer enable
+#define GPT_CTL_TnSTALL         1       // stop while the debugger halts the core
+#define GPT_CTL_TnPWML          6       // invert the PWM output
+#define GPT_INT_TnTO            0       // time-out interrupt
+#define GPT_INT_CHANNEL_MASK(CHANNEL)   (0x1FUL << ((CHANNEL) * 8))   // all interrupts of a channel
+
+// counter / prescaler ranges in timer clocks (16/32-bit block, wide block)
+#define GPT_COUNTER_RANGE(WIDE, CONCAT)     ((CONCAT) ? ((WIDE) ? 0xFFFFFFFFFFFFFFFFULL : 0x100000000ULL) : \
+                                                        ((WIDE) ? 0x100000000ULL : 0x10000ULL))
+#define GPT_PRESCALE_RANGE(WIDE, CONCAT)    ((CONCAT) ? 1 : ((WIDE) ? 0x10000UL : 0x100UL))
+
+// PWM mode: the prescaler registers hold the upper bits of the count
+#define GPT_PWM_RANGE(WIDE)                 ((WIDE) ? 0x1000000000000ULL : 0x1000000ULL)
+#define GPT_PWM_LOW_BITS(WIDE)              ((WIDE) ? 32 : 16)
+#define GPT_PWM_LOW_MASK(WIDE)              ((WIDE) ? 0xFFFFFFFFULL : 0xFFFFULL)
+
+#define GPT_PWM_DUTY_MAX        1000    // permille
+
+#define GPT_US_PER_MS           1000UL
+#define GPT_US_PER_S            1000000UL
+
+#endif //GPT_PRIVATE_H
@@ -0,0 +1,695 @@
+/**
+ * @file    :   gpt_program.c
+ * @brief   :   Program File contains all GPT (General Purpose Timer) functions' implementation
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "TM4C123.h"
+#include "bit_math.h"
+#include "gpt_interface.h"
+#include "gpt_private.h"
+
+// runtime state of a timer channel
+typedef struct{
+    fun_gpt_cb_t fun_ptr_cb;
+    void * ptr_v_ctx;
+    uint64_t_ u64_period_ticks;     // programmed period in timer clocks (load * prescale)
+    uint32_t_ u32_prescale;         // timer clocks per count
+    uint16_t_ u16_duty_permille;    // PWM high time
+    en_gpt_width_t en_width;
+    en_gpt_mode_t en_mode;
+    boolean bool_initialized;
+    boolean bool_started;
+    boolean bool_stopped;           // stopped by gpt_stop (a one shot also stops on its own when it expires)
+}st_gpt_channel_t;
+
+static st_gpt_regs_t * const gl_arr_ptr_st_gpt_regs[GPT_TIMER_TOTAL] =
+{
+        (st_gpt_regs_t *) GPT_TIMER_BASE(0),    (st_gpt_regs_t *) GPT_TIMER_BASE(1),
+        (st_gpt_regs_t *) GPT_TIMER_BASE(2),    (st_gpt_regs_t *) GPT_TIMER_BASE(3),
+        (st_gpt_regs_t *) GPT_TIMER_BASE(4),    (st_gpt_regs_t *) GPT_TIMER_BASE(5),
+        (st_gpt_regs_t *) GPT_WTIMER_BASE(0),   (st_gpt_regs_t *) GPT_WTIMER_BASE(1),
+        (st_gpt_regs_t *) GPT_WTIMER_BASE(2),   (st_gpt_regs_t *) GPT_WTIMER_BASE(3),
+        (st_gpt_regs_t *) GPT_WTIMER_BASE(4),   (st_gpt_regs_t *) GPT_WTIMER_BASE(5)
+};
+
+static const IRQn_Type gl_arr_en_gpt_irqs[GPT_TIMER_TOTAL][GPT_CHANNEL_TOTAL] =
+{
+        {TIMER0A_IRQn,  TIMER0B_IRQn},  {TIMER1A_IRQn,  TIMER1B_IRQn},
+        {TIMER2A_IRQn,  TIMER2B_IRQn},  {TIMER3A_IRQn,  TIMER3B_IRQn},
+        {TIMER4A_IRQn,  TIMER4B_IRQn},  {TIMER5A_IRQn,  TIMER5B_IRQn},
+        {WTIMER0A_IRQn, WTIMER0B_IRQn}, {WTIMER1A_IRQn, WTIMER1B_IRQn},
+        {WTIMER2A_IRQn, WTIMER2B_IRQn}, {WTIMER3A_IRQn, WTIMER3B_IRQn},
+        {WTIMER4A_IRQn, WTIMER4B_IRQn}, {WTIMER5A_IRQn, WTIMER5B_IRQn}
+};
+
+static st_gpt_channel_t gl_arr_st_gpt_channels[GPT_TIMER_TOTAL][GPT_CHANNEL_TOTAL];
+
+/**
+ * @brief                      : Checks a timer/channel pair refers to an initialized channel
+ *
+ * @param en_a_timer             : Timer block
+ * @param en_a_channel           : Timer channel
+ *
+ * @return  GPT_OK             :   Channel usable
+ *          GPT_INVALID_ARGS   :   Timer or channel out of range
+ *          GPT_INVALID_CONFIG :   Channel not initialized (or channel B of a concatenated block)
+ */
+static en_gpt_error_t gpt_channel_check(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel)
+{
+    en_gpt_error_t en_gpt_error_retval = GPT_OK;
+
+    if(
+            (en_a_timer >= GPT_TIMER_TOTAL) ||
+            (en_a_channel >= GPT_CHANNEL_TOTAL)
+            )
+    {
+        en_gpt_error_retval = GPT_INVALID_ARGS;
+    }
+    else if(FALSE == gl_arr_st_gpt_channels[en_a_timer][en_a_channel].bool_initialized)
+    {
+        en_gpt_error_retval = GPT_INVALID_CONFIG;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return en_gpt_error_retval;
+}
+
+/**
+ * @brief                      : Reads the down counter of a channel in timer clocks
+ *
+ * @param en_a_timer             : Timer block
+ * @param en_a_channel           : Timer channel
+ *
+ * @note                       : The 64-bit wide concatenated counter is read high/low/high so a carry
+ *                               between both halves is not torn
+ *
+ * @return                     : Timer clocks left to the next time-out
+ */
+static uint64_t_ gpt_read_counter(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel)
+{
+    const st_gpt_channel_t * ptr_st_channel = &gl_arr_st_gpt_channels[en_a_timer][en_a_channel];
+    st_gpt_regs_t * ptr_st_regs = GPT_REGS(en_a_timer);
+    uint64_t_ u64_ticks;
+
+    if(GPT_WIDTH_CONCATENATED == ptr_st_channel->en_width)
+    {
+        if(GPT_IS_WIDE(en_a_timer))
+        {
+            uint32_t_ u32_high;
+            uint32_t_ u32_low;
+
+            do
+            {
+                u32_high = ptr_st_regs->TnV[GPT_CHANNEL_B];
+                u32_low = ptr_st_regs->TnV[GPT_CHANNEL_A];
+            } while(u32_high != ptr_st_regs->TnV[GPT_CHANNEL_B]);
+
+            u64_ticks = ((uint64_t_) u32_high << 32) | u32_low;
+        }
+        else
+        {
+            u64_ticks = ptr_st_regs->TnV[GPT_CHANNEL_A];
+        }
+    }
+    else if(GPT_MODE_PWM == ptr_st_channel->en_mode)
+    {
+        // PWM: the prescaler extends the counter (24-bit in TnV, wide: upper 16 bits in TnPV)
+        u64_ticks = GPT_IS_WIDE(en_a_timer) ?
+                    (((uint64_t_) ptr_st_regs->TnPV[en_a_channel] << 32) | ptr_st_regs->TnV[en_a_channel]) :
+                    (ptr_st_regs->TnV[en_a_channel] & 0xFFFFFF);
+    }
+    else
+    {
+        // counter counts prescaled clocks, the prescaler holds the clocks left in the current count
+        uint32_t_ u32_count = GPT_IS_WIDE(en_a_timer) ?
+                              ptr_st_regs->TnV[en_a_channel] : (ptr_st_regs->TnV[en_a_channel] & 0xFFFF);
+
+        u64_ticks = ((uint64_t_) u32_count * ptr_st_channel->u32_prescale) +
+                    (ptr_st_regs->TnPV[en_a_channel] % ptr_st_channel->u32_prescale);
+    }
+
+    return u64_ticks;
+}
+
+/**
+ * @brief                      : Gets the timer clocks left in the running period
+ *
+ * @param en_a_timer             : Timer block
+ * @param en_a_channel           : Timer channel
+ *
+ * @return                     : Clocks to the next time-out, 0 once a one shot expired
+ */
+static uint64_t_ gpt_remaining_ticks(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel)
+{
+    const st_gpt_channel_t * ptr_st_channel = &gl_arr_st_gpt_channels[en_a_timer][en_a_channel];
+    uint64_t_ u64_ticks = 0;
+
+    if(
+            (GPT_MODE_ONE_SHOT == ptr_st_channel->en_mode) &&
+            (FALSE == ptr_st_channel->bool_stopped) &&
+            (!GET_BIT(GPT_REGS(en_a_timer)->CTL, GPT_CHANNEL_BIT(GPT_CTL_TnEN, en_a_channel)))
+            )
+    {
+        // expired, the hardware cleared TnEN
+        /* Do Nothing */
+    }
+    else
+    {
+        u64_ticks = gpt_read_counter(en_a_timer, en_a_channel);
+        u64_ticks = (u64_ticks > ptr_st_channel->u64_period_ticks) ? ptr_st_channel->u64_period_ticks : u64_ticks;
+    }
+
+    return u64_ticks;
+}
+
+/**
+ * @brief                      : Writes the PWM match of a channel from its period and duty
+ *
+ * @param en_a_timer             : Timer block
+ * @param en_a_channel           : Timer channel
+ *
+ * @note                       : The output is set on reload and cleared on match, the high time is clamped to
+ *                               [1, period - 1] clocks (match 0 -> period - 2)
+ */
+static void gpt_pwm_write_match(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel)
+{
+    const st_gpt_channel_t * ptr_st_channel = &gl_arr_st_gpt_channels[en_a_timer][en_a_channel];
+    st_gpt_regs_t * ptr_st_regs = GPT_REGS(en_a_timer);
+    boolean bool_wide = GPT_IS_WIDE(en_a_timer);
+    uint64_t_ u64_high = (ptr_st_channel->u64_period_ticks * ptr_st_channel->u16_duty_permille) / GPT_PWM_DUTY_MAX;
+    uint64_t_ u64_match;
+
+    if(ZERO == u64_high)
+    {
+        u64_high = 1;
+    }
+    else if(u64_high >= ptr_st_channel->u64_period_ticks)
+    {
+        u64_high = ptr_st_channel->u64_period_ticks - 1;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    u64_match = (ptr_st_channel->u64_period_ticks - 1) - u64_high;
+
+    // prescale match first, both are latched together on the next time-out (TnMRSU)
+    ptr_st_regs->TnPMR[en_a_channel] = (uint32_t_) (u64_match >> GPT_PWM_LOW_BITS(bool_wide));
+    ptr_st_regs->TnMATCHR[en_a_channel] = (uint32_t_) (u64_match & GPT_PWM_LOW_MASK(bool_wide));
+}
+
+/**
+ * @brief                      : Clears and dispatches the pending interrupts of a channel
+ *
+ * @param en_a_timer             : Timer block
+ * @param en_a_channel           : Timer channel
+ */
+static void gpt_irq_dispatch(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel)
+{
+    st_gpt_regs_t * ptr_st_regs = GPT_REGS(en_a_timer);
+    uint32_t_ u32_pending = ptr_st_regs->MIS & GPT_INT_CHANNEL_MASK(en_a_channel);
+
+    ptr_st_regs->ICR = u32_pending;
+    // read back so the clear reaches the peripheral before the handler returns (no spurious re-entry)
+    (void) ptr_st_regs->ICR;
+
+    if(
+            (GET_BIT(u32_pending, GPT_CHANNEL_BIT(GPT_INT_TnTO, en_a_channel))) &&
+            (NULL_PTR != gl_arr_st_gpt_channels[en_a_timer][en_a_channel].fun_ptr_cb)
+            )
+    {
+        gl_arr_st_gpt_channels[en_a_timer][en_a_channel].fun_ptr_cb(
+                gl_arr_st_gpt_channels[en_a_timer][en_a_channel].ptr_v_ctx);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+en_gpt_error_t gpt_init(const st_gpt_cfg_t * ptr_st_a_gpt_cfg)
+{
+    en_gpt_error_t en_gpt_error_retval = GPT_OK;
+
+    if(NULL_PTR == ptr_st_a_gpt_cfg)
+    {
+        en_gpt_error_retval = GPT_INVALID_ARGS;
+    }
+    else if(
+            (ptr_st_a_gpt_cfg->en_gpt_timer >= GPT_TIMER_TOTAL) ||
+            (ptr_st_a_gpt_cfg->en_gpt_channel >= GPT_CHANNEL_TOTAL) ||
+            (ptr_st_a_gpt_cfg->en_gpt_width >= GPT_WIDTH_TOTAL) ||
+            (ptr_st_a_gpt_cfg->en_gpt_mode >= GPT_MODE_TOTAL) ||
+            (
+                    (GPT_MODE_PWM == ptr_st_a_gpt_cfg->en_gpt_mode) &&
+                    (GPT_WIDTH_CONCATENATED == ptr_st_a_gpt_cfg->en_gpt_width)
+            )
+            )
+    {
+        en_gpt_error_retval = GPT_INVALID_CONFIG;
+    }
+    else
+    {
+        en_gpt_timer_t en_timer = ptr_st_a_gpt_cfg->en_gpt_timer;
+        en_gpt_channel_t en_channel = (GPT_WIDTH_CONCATENATED == ptr_st_a_gpt_cfg->en_gpt_width) ?
+                                      GPT_CHANNEL_A : ptr_st_a_gpt_cfg->en_gpt_channel;
+        st_gpt_channel_t * ptr_st_other = &gl_arr_st_gpt_channels[en_timer][GPT_CHANNEL_B - en_channel];
+
+        if(
+                (TRUE == ptr_st_other->bool_initialized) &&
+                (
+                        (ptr_st_other->en_width != ptr_st_a_gpt_cfg->en_gpt_width) ||
+                        (GPT_WIDTH_CONCATENATED == ptr_st_a_gpt_cfg->en_gpt_width)
+                )
+                )
+        {
+            // CFG is shared by both channels of the block
+            en_gpt_error_retval = GPT_INVALID_CONFIG;
+        }
+        else
+        {
+            st_gpt_channel_t * ptr_st_channel = &gl_arr_st_gpt_channels[en_timer][en_channel];
+            st_gpt_regs_t * ptr_st_regs = GPT_REGS(en_timer);
+
+            // 1. Enable the block clock and wait until it is ready
+            if(GPT_IS_WIDE(en_timer))
+            {
+                SET_BIT(RCGCWTIMER, (en_timer - GPT_WTIMER_FIRST));
+                while(!GET_BIT(PRWTIMER, (en_timer - GPT_WTIMER_FIRST)));
+            }
+            else
+            {
+                SET_BIT(RCGCTIMER, en_timer);
+                while(!GET_BIT(PRTIMER, en_timer));
+            }
+
+            // 2. Disable the channel (both channels when concatenated) before configuring it
+            if(GPT_WIDTH_CONCATENATED == ptr_st_a_gpt_cfg->en_gpt_width)
+            {
+                CLR_BIT(ptr_st_regs->CTL, GPT_CHANNEL_BIT(GPT_CTL_TnEN, GPT_CHANNEL_B));
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+            CLR_BIT(ptr_st_regs->CTL, GPT_CHANNEL_BIT(GPT_CTL_TnEN, en_channel));
+
+            // 3. Block width, CFG may only change with both channels disabled: an initialized sibling already
+            //    set the same (individual) width and may be running, leave CFG untouched then
+            if(FALSE == ptr_st_other->bool_initialized)
+            {
+                ptr_st_regs->CFG = (GPT_WIDTH_CONCATENATED == ptr_st_a_gpt_cfg->en_gpt_width) ?
+                                   GPT_CFG_CONCATENATED : GPT_CFG_INDIVIDUAL;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            // 4. One shot / periodic / PWM (periodic + alternate mode), count down
+            if(GPT_MODE_PWM == ptr_st_a_gpt_cfg->en_gpt_mode)
+            {
+                ptr_st_regs->TnMR[en_channel] = GPT_TnMR_PERIODIC | (1UL << GPT_TnMR_TnAMS);
+                CLR_BIT(ptr_st_regs->CTL, GPT_CHANNEL_BIT(GPT_CTL_TnPWML, en_channel));
+            }
+            else
+            {
+                ptr_st_regs->TnMR[en_channel] = (GPT_MODE_PERIODIC == ptr_st_a_gpt_cfg->en_gpt_mode) ?
+                                                GPT_TnMR_PERIODIC : GPT_TnMR_ONE_SHOT;
+            }
+
+            // 5. Freeze with the core in debug, interrupts masked and cleared
+            SET_BIT(ptr_st_regs->CTL, GPT_CHANNEL_BIT(GPT_CTL_TnSTALL, en_channel));
+            ptr_st_regs->IMR &= ~GPT_INT_CHANNEL_MASK(en_channel);
+            ptr_st_regs->ICR = GPT_INT_CHANNEL_MASK(en_channel);
+
+            ptr_st_channel->en_width = ptr_st_a_gpt_cfg->en_gpt_width;
+            ptr_st_channel->en_mode = ptr_st_a_gpt_cfg->en_gpt_mode;
+            ptr_st_channel->u32_prescale = 1;
+            ptr_st_channel->u64_period_ticks = 0;
+            ptr_st_channel->bool_started = FALSE;
+            ptr_st_channel->bool_stopped = TRUE;
+            ptr_st_channel->bool_initialized = TRUE;
+        }
+    }
+
+    return en_gpt_error_retval;
+}
+
+en_gpt_error_t gpt_start(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel,
+                         uint32_t_ u32_a_time, en_gpt_time_unit_t en_a_unit)
+{
+    en_gpt_error_t en_gpt_error_retval = gpt_channel_check(en_a_timer, en_a_channel);
+
+    if(GPT_OK != en_gpt_error_retval)
+    {
+        /* Do Nothing */
+    }
+    else if(
+            (ZERO == u32_a_time) ||
+            (en_a_unit >= GPT_TIME_UNIT_TOTAL)
+            )
+    {
+        en_gpt_error_retval = GPT_INVALID_ARGS;
+    }
+    else
+    {
+        st_gpt_channel_t * ptr_st_channel = &gl_arr_st_gpt_channels[en_a_timer][en_a_channel];
+        st_gpt_regs_t * ptr_st_regs = GPT_REGS(en_a_timer);
+        boolean bool_concat = (GPT_WIDTH_CONCATENATED == ptr_st_channel->en_width);
+        boolean bool_pwm = (GPT_MODE_PWM == ptr_st_channel->en_mode);
+        // PWM counts single clocks over the prescaler extended counter
+        uint64_t_ u64_counter_range = (TRUE == bool_pwm) ? GPT_PWM_RANGE(GPT_IS_WIDE(en_a_timer)) :
+                                      GPT_COUNTER_RANGE(GPT_IS_WIDE(en_a_timer), bool_concat);
+        uint64_t_ u64_ticks = (uint64_t_) u32_a_time * GPT_CLOCK_MHZ *
+                              ((GPT_TIME_S == en_a_unit) ? GPT_US_PER_S :
+                               (GPT_TIME_MS == en_a_unit) ? GPT_US_PER_MS : 1);
+        // smallest prescaler that fits the counter (written this way, the 64-bit range is all ones)
+        uint64_t_ u64_prescale = ((u64_ticks - 1) / u64_counter_range) + 1;
+
+        if(u64_prescale > ((TRUE == bool_pwm) ? 1 : GPT_PRESCALE_RANGE(GPT_IS_WIDE(en_a_timer), bool_concat)))
+        {
+            en_gpt_error_retval = GPT_OUT_OF_RANGE;
+        }
+        else
+        {
+            // nearest whole number of prescaled counts
+            uint64_t_ u64_load = (u64_ticks + (u64_prescale / 2)) / u64_prescale;
+
+            u64_load = (u64_load > u64_counter_range) ? u64_counter_range : u64_load;
+
+            CLR_BIT(ptr_st_regs->CTL, GPT_CHANNEL_BIT(GPT_CTL_TnEN, en_a_channel));
+
+            // loads apply immediately while restarting
+            ptr_st_regs->TnMR[en_a_channel] &= ~((1UL << GPT_TnMR_TnILD) | (1UL << GPT_TnMR_TnMRSU));
+
+            if(TRUE == bool_pwm)
+            {
+                // the prescaler holds the upper bits of the count
+                ptr_st_regs->TnPR[en_a_channel] = (uint32_t_) ((u64_load - 1) >> GPT_PWM_LOW_BITS(GPT_IS_WIDE(en_a_timer)));
+                ptr_st_regs->TnILR[en_a_channel] = (uint32_t_) ((u64_load - 1) & GPT_PWM_LOW_MASK(GPT_IS_WIDE(en_a_timer)));
+            }
+            else
+            {
+                if(FALSE == bool_concat)
+                {
+                    ptr_st_regs->TnPR[en_a_channel] = (uint32_t_) (u64_prescale - 1);
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+
+                // time-out when the counter reaches 0, the period is ILR + 1 counts
+                ptr_st_regs->TnILR[en_a_channel] = (uint32_t_) (u64_load - 1);
+                if(
+                        (TRUE == bool_concat) &&
+                        (GPT_IS_WIDE(en_a_timer))
+                        )
+                {
+                    // 64-bit: B holds the upper half
+                    ptr_st_regs->TnILR[GPT_CHANNEL_B] = (uint32_t_) ((u64_load - 1) >> 32);
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+            }
+
+            ptr_st_channel->u32_prescale = (uint32_t_) u64_prescale;
+            ptr_st_channel->u64_period_ticks = u64_load * u64_prescale;
+            ptr_st_channel->bool_started = TRUE;
+            ptr_st_channel->bool_stopped = FALSE;
+
+            if(TRUE == bool_pwm)
+            {
+                // later duty changes are latched on the period boundary
+                gpt_pwm_write_match(en_a_timer, en_a_channel);
+                ptr_st_regs->TnMR[en_a_channel] |= (1UL << GPT_TnMR_TnILD) | (1UL << GPT_TnMR_TnMRSU);
+            }
+            else if(GPT_MODE_PERIODIC == ptr_st_channel->en_mode)
+            {
+                // gpt_set_next_period loads are latched on the time-out
+                ptr_st_regs->TnMR[en_a_channel] |= (1UL << GPT_TnMR_TnILD);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            // clear a stale time-out, then start
+            ptr_st_regs->ICR = (1UL << GPT_CHANNEL_BIT(GPT_INT_TnTO, en_a_channel));
+            SET_BIT(ptr_st_regs->CTL, GPT_CHANNEL_BIT(GPT_CTL_TnEN, en_a_channel));
+        }
+    }
+
+    return en_gpt_error_retval;
+}
+
+en_gpt_error_t gpt_stop(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel)
+{
+    en_gpt_error_t en_gpt_error_retval = gpt_channel_check(en_a_timer, en_a_channel);
+
+    if(GPT_OK == en_gpt_error_retval)
+    {
+        CLR_BIT(GPT_REGS(en_a_timer)->CTL, GPT_CHANNEL_BIT(GPT_CTL_TnEN, en_a_channel));
+        gl_arr_st_gpt_channels[en_a_timer][en_a_channel].bool_stopped = TRUE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return en_gpt_error_retval;
+}
+
+en_gpt_error_t gpt_get_elapsed(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel,
+                               uint64_t_ * ptr_u64_a_elapsed_us)
+{
+    en_gpt_error_t en_gpt_error_retval = gpt_channel_check(en_a_timer, en_a_channel);
+
+    if(GPT_OK != en_gpt_error_retval)
+    {
+        /* Do Nothing */
+    }
+    else if(NULL_PTR == ptr_u64_a_elapsed_us)
+    {
+        en_gpt_error_retval = GPT_INVALID_ARGS;
+    }
+    else if(FALSE == gl_arr_st_gpt_channels[en_a_timer][en_a_channel].bool_started)
+    {
+        en_gpt_error_retval = GPT_INVALID_CONFIG;
+    }
+    else
+    {
+        *ptr_u64_a_elapsed_us = (gl_arr_st_gpt_channels[en_a_timer][en_a_channel].u64_period_ticks -
+                                 gpt_remaining_ticks(en_a_timer, en_a_channel)) / GPT_CLOCK_MHZ;
+    }
+
+    return en_gpt_error_retval;
+}
+
+en_gpt_error_t gpt_get_remaining(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel,
+                                 uint64_t_ * ptr_u64_a_remaining_us)
+{
+    en_gpt_error_t en_gpt_error_retval = gpt_channel_check(en_a_timer, en_a_channel);
+
+    if(GPT_OK != en_gpt_error_retval)
+    {
+        /* Do Nothing */
+    }
+    else if(NULL_PTR == ptr_u64_a_remaining_us)
+    {
+        en_gpt_error_retval = GPT_INVALID_ARGS;
+    }
+    else if(FALSE == gl_arr_st_gpt_channels[en_a_timer][en_a_channel].bool_started)
+    {
+        en_gpt_error_retval = GPT_INVALID_CONFIG;
+    }
+    else
+    {
+        *ptr_u64_a_remaining_us = gpt_remaining_ticks(en_a_timer, en_a_channel) / GPT_CLOCK_MHZ;
+    }
+
+    return en_gpt_error_retval;
+}
+
+en_gpt_error_t gpt_enable_interrupt(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel)
+{
+    en_gpt_error_t en_gpt_error_retval = gpt_channel_check(en_a_timer, en_a_channel);
+
+    if(GPT_OK == en_gpt_error_retval)
+    {
+        SET_BIT(GPT_REGS(en_a_timer)->IMR, GPT_CHANNEL_BIT(GPT_INT_TnTO, en_a_channel));
+        NVIC_SetPriority(gl_arr_en_gpt_irqs[en_a_timer][en_a_channel], GPT_IRQ_PRIORITY);
+        NVIC_EnableIRQ(gl_arr_en_gpt_irqs[en_a_timer][en_a_channel]);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return en_gpt_error_retval;
+}
+
+en_gpt_error_t gpt_disable_interrupt(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel)
+{
+    en_gpt_error_t en_gpt_error_retval = gpt_channel_check(en_a_timer, en_a_channel);
+
+    if(GPT_OK == en_gpt_error_retval)
+    {
+        // NVIC line stays enabled, it may serve other interrupt sources of the channel
+        CLR_BIT(GPT_REGS(en_a_timer)->IMR, GPT_CHANNEL_BIT(GPT_INT_TnTO, en_a_channel));
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return en_gpt_error_retval;
+}
+
+en_gpt_error_t gpt_set_next_period(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel, uint32_t_ u32_a_ticks)
+{
+    en_gpt_error_t en_gpt_error_retval = gpt_channel_check(en_a_timer, en_a_channel);
+
+    if(GPT_OK != en_gpt_error_retval)
+    {
+        /* Do Nothing */
+    }
+    else if(ZERO == u32_a_ticks)
+    {
+        en_gpt_error_retval = GPT_INVALID_ARGS;
+    }
+    else
+    {
+        const st_gpt_channel_t * ptr_st_channel = &gl_arr_st_gpt_channels[en_a_timer][en_a_channel];
+        boolean bool_concat = (GPT_WIDTH_CONCATENATED == ptr_st_channel->en_width);
+
+        if(
+                (GPT_MODE_PERIODIC != ptr_st_channel->en_mode) ||
+                (FALSE == ptr_st_channel->bool_started)
+                )
+        {
+            en_gpt_error_retval = GPT_INVALID_CONFIG;
+        }
+        else if(
+                (1 != ptr_st_channel->u32_prescale) ||
+                (u32_a_ticks > GPT_COUNTER_RANGE(GPT_IS_WIDE(en_a_timer), bool_concat))
+                )
+        {
+            en_gpt_error_retval = GPT_OUT_OF_RANGE;
+        }
+        else
+        {
+            // latched on the coming time-out (TnILD)
+            GPT_REGS(en_a_timer)->TnILR[en_a_channel] = u32_a_ticks - 1;
+            if(
+                    (TRUE == bool_concat) &&
+                    (GPT_IS_WIDE(en_a_timer))
+                    )
+            {
+                // 64-bit: clear the upper half left by gpt_start
+                GPT_REGS(en_a_timer)->TnILR[GPT_CHANNEL_B] = ZERO;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+    }
+
+    return en_gpt_error_retval;
+}
+
+en_gpt_error_t gpt_set_pwm_duty(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel,
+                                uint16_t_ u16_a_duty_permille)
+{
+    en_gpt_error_t en_gpt_error_retval = gpt_channel_check(en_a_timer, en_a_channel);
+
+    if(GPT_OK != en_gpt_error_retval)
+    {
+        /* Do Nothing */
+    }
+    else if(u16_a_duty_permille > GPT_PWM_DUTY_MAX)
+    {
+        en_gpt_error_retval = GPT_INVALID_ARGS;
+    }
+    else if(GPT_MODE_PWM != gl_arr_st_gpt_channels[en_a_timer][en_a_channel].en_mode)
+    {
+        en_gpt_error_retval = GPT_INVALID_CONFIG;
+    }
+    else
+    {
+        gl_arr_st_gpt_channels[en_a_timer][en_a_channel].u16_duty_permille = u16_a_duty_permille;
+
+        if(TRUE == gl_arr_st_gpt_channels[en_a_timer][en_a_channel].bool_started)
+        {
+            gpt_pwm_write_match(en_a_timer, en_a_channel);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    return en_gpt_error_retval;
+}
+
+en_gpt_error_t gpt_set_callback(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel,
+                                fun_gpt_cb_t fun_ptr_a_cb, void * ptr_v_a_ctx)
+{
+    en_gpt_error_t en_gpt_error_retval = GPT_OK;
+
+    if(
+            (en_a_timer >= GPT_TIMER_TOTAL) ||
+            (en_a_channel >= GPT_CHANNEL_TOTAL)
+            )
+    {
+        en_gpt_error_retval = GPT_INVALID_ARGS;
+    }
+    else
+    {
+        st_gpt_channel_t * ptr_st_channel = &gl_arr_st_gpt_channels[en_a_timer][en_a_channel];
+
+        // callback is cleared first so the handler never pairs a callback with the wrong context
+        ptr_st_channel->fun_ptr_cb = NULL_PTR;
+        ptr_st_channel->ptr_v_ctx = ptr_v_a_ctx;
+        ptr_st_channel->fun_ptr_cb = fun_ptr_a_cb;
+    }
+
+    return en_gpt_error_retval;
+}
+
+// timer interrupt handlers
+void TIMER0A_Handler(void)  { gpt_irq_dispatch(GPT_TIMER_0,  GPT_CHANNEL_A); }
+void TIMER0B_Handler(void)  { gpt_irq_dispatch(GPT_TIMER_0,  GPT_CHANNEL_B); }
+void TIMER1A_Handler(void)  { gpt_irq_dispatch(GPT_TIMER_1,  GPT_CHANNEL_A); }
+void TIMER1B_Handler(void)  { gpt_irq_dispatch(GPT_TIMER_1,  GPT_CHANNEL_B); }
+void TIMER2A_Handler(void)  { gpt_irq_dispatch(GPT_TIMER_2,  GPT_CHANNEL_A); }
+void TIMER2B_Handler(void)  { gpt_irq_dispatch(GPT_TIMER_2,  GPT_CHANNEL_B); }
+void TIMER3A_Handler(void)  { gpt_irq_dispatch(GPT_TIMER_3,  GPT_CHANNEL_A); }
+void TIMER3B_Handler(void)  { gpt_irq_dispatch(GPT_TIMER_3,  GPT_CHANNEL_B); }
+void TIMER4A_Handler(void)  { gpt_irq_dispatch(GPT_TIMER_4,  GPT_CHANNEL_A); }
+void TIMER4B_Handler(void)  { gpt_irq_dispatch(GPT_TIMER_4,  GPT_CHANNEL_B); }
+void TIMER5A_Handler(void)  { gpt_irq_dispatch(GPT_TIMER_5,  GPT_CHANNEL_A); }
+void TIMER5B_Handler(void)  { gpt_irq_dispatch(GPT_TIMER_5,  GPT_CHANNEL_B); }
+void WTIMER0A_Handler(void) { gpt_irq_dispatch(GPT_WTIMER_0, GPT_CHANNEL_A); }
+void WTIMER0B_Handler(void) { gpt_irq_dispatch(GPT_WTIMER_0, GPT_CHANNEL_B); }
+void WTIMER1A_Handler(void) { gpt_irq_dispatch(GPT_WTIMER_1, GPT_CHANNEL_A); }
+void WTIMER1B_Handler(void) { gpt_irq_dispatch(GPT_WTIMER_1, GPT_CHANNEL_B); }
+void WTIMER2A_Handler(void) { gpt_irq_dispatch(GPT_WTIMER_2, GPT_CHANNEL_A); }
+void WTIMER2B_Handler(void) { gpt_irq_dispatch(GPT_WTIMER_2, GPT_CHANNEL_B); }
+void WTIMER3A_Handler(void) { gpt_irq_dispatch(GPT_WTIMER_3, GPT_CHANNEL_A); }
+void WTIMER3B_Handler(void) { gpt_irq_dispatch(GPT_WTIMER_3, GPT_CHANNEL_B); }
+void WTIMER4A_Handler(void) { gpt_irq_dispatch(GPT_WTIMER_4, GPT_CHANNEL_A); }
+void WTIMER4B_Handler(void) { gpt_irq_dispatch(GPT_WTIMER_4, GPT_CHANNEL_B); }
+void WTIMER5A_Handler(void) { gpt_irq_dispatch(GPT_WTIMER_5, GPT_CHANNEL_A); }
+void WTIMER5B_Handler(void) { gpt_irq_dispatch(GPT_WTIMER_5, GPT_CHANNEL_B); }
@@ -0,0 +1,145 @@
+/**
+ * @file    :   pwm_interface.h
+ * @brief   :   Header File contains all PWM (Module 1 PWM generators) functions' prototypes, typedefs and pre-configurations
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef PWM_INTERFACE_H
+#define PWM_INTERFACE_H
+
+#include "std.h"
+
+// PWM module is clocked by the system clock (keep in sync with SYS_CLOCK_MHZ)
+#define PWM_CLOCK_MHZ   8
+
+// duty cycle full scale, the duty is scaled to the counts of the selected resolution
+#define PWM_DUTY_FULL   0xFFFF
+
+// channel mask, used in st_pwm_cfg_t
+#define PWM_CHANNEL_MASK(CHANNEL)   (1 << (CHANNEL))
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum{
+    /* M1PWMn outputs, generator n / 2, channel n % 2 */
+    PWM_CHANNEL_0   =   0   ,   // PD0 (gen 0)
+    PWM_CHANNEL_1           ,   // PD1 (gen 0)
+    PWM_CHANNEL_2           ,   // PA6 (gen 1)
+    PWM_CHANNEL_3           ,   // PA7 (gen 1)
+    PWM_CHANNEL_4           ,   // PF0 (gen 2)
+    PWM_CHANNEL_5           ,   // PF1 (gen 2) - red LED
+    PWM_CHANNEL_6           ,   // PF2 (gen 3) - blue LED
+    PWM_CHANNEL_7           ,   // PF3 (gen 3) - green LED
+    PWM_CHANNEL_TOTAL
+}en_pwm_channel_t;
+
+typedef enum{
+    PWM_OK              =   0   ,
+    PWM_INVALID_CONFIG          ,
+    PWM_INVALID_ARGS            ,
+    PWM_OUT_OF_RANGE            ,
+}en_pwm_error_t;
+
+
+/*----------------------------------------------------------/
+/- STRUCTURES
+/----------------------------------------------------------*/
+typedef struct{
+
+    /* PWM_CHANNEL_MASK of the used channels, their generators run in lock step */
+    uint8_t_ u8_channels_mask;
+
+    /* initial frequency, see pwm_set_frequency */
+    uint32_t_ u32_freq_hz;
+
+}st_pwm_cfg_t;
+
+// frequency / resolution trade-off in effect: freq_hz * steps = PWM clock
+typedef struct{
+    uint32_t_ u32_freq_hz;          // actual frequency (rounded to a whole number of counts)
+    uint32_t_ u32_steps;            // duty steps per period (counts)
+    uint8_t_ u8_resolution_bits;    // whole bits of duty resolution (log2 of steps)
+}st_pwm_timing_t;
+
+/**
+ * @brief                       : Initializes the PWM module, the configured channels start at 0% duty
+ *
+ * @param ptr_st_a_pwm_cfg        : Pointer to PWM Configuration
+ * @note                        : Routing the pins (GPIO ALT_FUNCTION, PCTL 5) is left to the caller
+ *
+ * @return  PWM_OK              :   In case of Successful Operation
+ *          PWM_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ *          PWM_INVALID_CONFIG  :   In case of Failed Operation (No channel selected)
+ *          PWM_OUT_OF_RANGE    :   In case the frequency can not be generated
+ */
+en_pwm_error_t pwm_init(const st_pwm_cfg_t * ptr_st_a_pwm_cfg);
+
+
+/**
+ * @brief                       : Selects the PWM frequency, the resolution is the most the clock allows
+ *
+ * @param u32_a_freq_hz           : PWM frequency
+ * @param ptr_st_a_timing         : Pointer to store the resulting timing (NULL_PTR if not needed)
+ * @note                        : Steps = clock / freq, at 8 MHz: 25 kHz -> 320 steps (8 bits), 122 Hz -> 16 bits.
+ *                                The clock divider (up to /64) extends the range down to ~2 Hz.
+ *                                The period and duties are latched on pwm_update, a divider change applies at once
+ *
+ * @return  PWM_OK              :   In case of Successful Operation
+ *          PWM_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ *          PWM_INVALID_CONFIG  :   In case of Failed Operation (Module not initialized)
+ *          PWM_OUT_OF_RANGE    :   In case of less than 2 steps or a period above the counter and divider
+ */
+en_pwm_error_t pwm_set_frequency(uint32_t_ u32_a_freq_hz, st_pwm_timing_t * ptr_st_a_timing);
+
+
+/**
+ * @brief                       : Selects the duty resolution, the frequency is the most the clock allows
+ *
+ * @param u8_a_resolution_bits    : Duty resolution (1 -> 16 bits)
+ * @param ptr_st_a_timing         : Pointer to store the resulting timing (NULL_PTR if not needed)
+ * @note                        : Frequency = clock / 2^bits, latched on pwm_update
+ *
+ * @return  PWM_OK              :   In case of Successful Operation
+ *          PWM_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ *          PWM_INVALID_CONFIG  :   In case of Failed Operation (Module not initialized)
+ */
+en_pwm_error_t pwm_set_resolution(uint8_t_ u8_a_resolution_bits, st_pwm_timing_t * ptr_st_a_timing);
+
+
+/**
+ * @brief                       : Gets the timing in effect
+ *
+ * @param ptr_st_a_timing         : Pointer to store the timing
+ *
+ * @return  PWM_OK              :   In case of Successful Operation
+ *          PWM_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ *          PWM_INVALID_CONFIG  :   In case of Failed Operation (Module not initialized)
+ */
+en_pwm_error_t pwm_get_timing(st_pwm_timing_t * ptr_st_a_timing);
+
+
+/**
+ * @brief                       : Stages the duty cycle of a channel, applied by pwm_update
+ *
+ * @param en_a_channel            : PWM channel (configured in pwm_init)
+ * @param u16_a_duty              : High time in 1/PWM_DUTY_FULL of the period (0 and PWM_DUTY_FULL are exact)
+ *
+ * @return  PWM_OK              :   In case of Successful Operation
+ *          PWM_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ *          PWM_INVALID_CONFIG  :   In case of Failed Operation (Channel not configured)
+ */
+en_pwm_error_t pwm_set_duty(en_pwm_channel_t en_a_channel, uint16_t_ u16_a_duty);
+
+
+/**
+ * @brief                       : Latches the staged duties and period of all channels on the same period boundary
+ *
+ * @return  PWM_OK              :   In case of Successful Operation
+ *          PWM_INVALID_CONFIG  :   In case of Failed Operation (Module not initialized)
+ */
+en_pwm_error_t pwm_update(void);
+
+#endif //PWM_INTERFACE_H
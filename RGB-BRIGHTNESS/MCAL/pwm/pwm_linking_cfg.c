@@ -0,0 +1,9 @@
+#include "pwm_linking_cfg.h"
+
+// RGB LED channels, 25 kHz (inaudible, no camera flicker) -> 320 steps at 8 MHz
+st_pwm_cfg_t gl_st_pwm_cfg_0 =
+{
+        .u8_channels_mask   = PWM_CHANNEL_MASK(PWM_CHANNEL_5) | PWM_CHANNEL_MASK(PWM_CHANNEL_6) |
+                              PWM_CHANNEL_MASK(PWM_CHANNEL_7),
+        .u32_freq_hz        = 25000
+};
@@ -0,0 +1,8 @@
+#ifndef PWM_LINKING_CFG_H
+#define PWM_LINKING_CFG_H
+
+#include "pwm_interface.h"
+
+extern st_pwm_cfg_t gl_st_pwm_cfg_0;
+
+#endif //PWM_LINKING_CFG_H
@@ -0,0 +1,104 @@
+/**
+ * @file    :   pwm_private.h
+ * @brief   :   Header File contains PWM registers, bits and private macros
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef PWM_PRIVATE_H
+#define PWM_PRIVATE_H
+
+#include "std.h"
+
+/* PWM generator register block */
+typedef struct
+{
+    volatile uint32_t_ CTL;                 /* 0x00 : PWMn Control */
+    volatile uint32_t_ INTEN;               /* 0x04 : PWMn Interrupt and Trigger Enable */
+    volatile uint32_t_ RIS;                 /* 0x08 : PWMn Raw Interrupt Status */
+    volatile uint32_t_ ISC;                 /* 0x0C : PWMn Interrupt Status and Clear */
+    volatile uint32_t_ LOAD;                /* 0x10 : PWMn Load */
+    volatile uint32_t_ COUNT;               /* 0x14 : PWMn Counter */
+    volatile uint32_t_ CMP[2];              /* 0x18 - 0x1C : PWMn Compare A/B */
+    volatile uint32_t_ GEN[2];              /* 0x20 - 0x24 : PWMn Generator A/B Control */
+    volatile uint32_t_ DBCTL;               /* 0x28 : PWMn Dead-Band Control */
+    volatile uint32_t_ DBRISE;              /* 0x2C : PWMn Dead-Band Rising-Edge Delay */
+    volatile uint32_t_ DBFALL;              /* 0x30 : PWMn Dead-Band Falling-Edge Delay */
+    volatile uint32_t_ FLTSRC0;             /* 0x34 : PWMn Fault Source 0 */
+    volatile uint32_t_ FLTSRC1;             /* 0x38 : PWMn Fault Source 1 */
+    volatile uint32_t_ MINFLTPER;           /* 0x3C : PWMn Minimum Fault Period */
+}st_pwm_gen_regs_t;
+
+/* PWM module register block */
+typedef struct
+{
+    volatile uint32_t_ CTL;                 /* 0x000 : PWM Master Control */
+    volatile uint32_t_ SYNC;                /* 0x004 : PWM Time Base Sync */
+    volatile uint32_t_ ENABLE;              /* 0x008 : PWM Output Enable */
+    volatile uint32_t_ INVERT;              /* 0x00C : PWM Output Inversion */
+    volatile uint32_t_ FAULT;               /* 0x010 : PWM Output Fault */
+    volatile uint32_t_ INTEN;               /* 0x014 : PWM Interrupt Enable */
+    volatile uint32_t_ RIS;                 /* 0x018 : PWM Raw Interrupt Status */
+    volatile uint32_t_ ISC;                 /* 0x01C : PWM Interrupt Status and Clear */
+    volatile uint32_t_ STATUS;              /* 0x020 : PWM Status */
+    volatile uint32_t_ FAULTVAL;            /* 0x024 : PWM Fault Condition Value */
+    volatile uint32_t_ ENUPD;               /* 0x028 : PWM Enable Update */
+    volatile uint32_t_ RESERVED0[5];        /* 0x02C - 0x03C */
+    st_pwm_gen_regs_t GEN[4];               /* 0x040 - 0x13C : PWM0 -> PWM3 generators */
+}st_pwm_regs_t;
+
+#define PWM1_REGS               ((st_pwm_regs_t *) 0x40029000)
+
+#define RCGCPWM                 *((volatile uint32_t_*) 0x400FE640)     /* PWM Run Mode Clock Gating Control */
+#define PRPWM                   *((volatile uint32_t_*) 0x400FEA40)     /* PWM Peripheral Ready */
+#define PWM_RCC                 *((volatile uint32_t_*) 0x400FE060)     /* Run-Mode Clock Configuration */
+
+#define PWM_MODULE_1            1
+
+// RCC PWM clock divider: USEPWMDIV cleared -> system clock, set -> system clock / 2^(PWMDIV + 1)
+#define PWM_RCC_USEPWMDIV       20
+#define PWM_RCC_PWMDIV_SHIFT    17
+#define PWM_RCC_PWMDIV_MASK     (0x7UL << PWM_RCC_PWMDIV_SHIFT)
+#define PWM_DIV_SHIFT_MAX       6       // /64
+
+// channel -> generator / generator output (A, B)
+#define PWM_GENERATORS          4
+#define PWM_GEN(CHANNEL)        ((CHANNEL) >> 1)
+#define PWM_GEN_OUT(CHANNEL)    ((CHANNEL) & 1)
+#define PWM_GEN_CHANNELS(GEN)   (0x3 << ((GEN) * 2))    // channel mask of a generator
+
+// PWMnCTL bits, count down, updates globally synchronized (latched at zero after a PWMCTL GLOBALSYNC request)
+#define PWM_GEN_CTL_ENABLE      0
+#define PWM_GEN_CTL_LOADUPD     3
+#define PWM_GEN_CTL_CMPAUPD     4
+#define PWM_GEN_CTL_CMPBUPD     5
+#define PWM_GEN_CTL_GENAUPD     6       // 2 bits
+#define PWM_GEN_CTL_GENBUPD     8       // 2 bits
+#define PWM_GEN_UPD_GLOBAL      0x3
+#define PWM_GEN_CTL_SYNC_ALL    ((1UL << PWM_GEN_CTL_LOADUPD) | (1UL << PWM_GEN_CTL_CMPAUPD) | \
+                                 (1UL << PWM_GEN_CTL_CMPBUPD) | (PWM_GEN_UPD_GLOBAL << PWM_GEN_CTL_GENAUPD) | \
+                                 (PWM_GEN_UPD_GLOBAL << PWM_GEN_CTL_GENBUPD))
+
+// PWMnGENA/B actions (2 bits each), output A uses compare A, output B compare B
+#define PWM_ACT_LOW             0x2
+#define PWM_ACT_HIGH            0x3
+#define PWM_ACT_ZERO_SHIFT      0
+#define PWM_ACT_LOAD_SHIFT      2
+#define PWM_ACT_CMPA_DOWN_SHIFT 6
+#define PWM_ACT_CMPB_DOWN_SHIFT 10
+
+// high on load, low on the own compare going down
+#define PWM_GEN_ACT_PULSE(OUT)  ((PWM_ACT_HIGH << PWM_ACT_LOAD_SHIFT) | \
+                                 (PWM_ACT_LOW << ((OUT) ? PWM_ACT_CMPB_DOWN_SHIFT : PWM_ACT_CMPA_DOWN_SHIFT)))
+#define PWM_GEN_ACT_CONST_LOW   ((PWM_ACT_LOW << PWM_ACT_LOAD_SHIFT) | (PWM_ACT_LOW << PWM_ACT_ZERO_SHIFT))
+#define PWM_GEN_ACT_CONST_HIGH  ((PWM_ACT_HIGH << PWM_ACT_LOAD_SHIFT) | (PWM_ACT_HIGH << PWM_ACT_ZERO_SHIFT))
+
+// 16-bit counter
+#define PWM_STEPS_MAX           0x10000UL
+#define PWM_STEPS_MIN           2
+#define PWM_RESOLUTION_MAX      16
+
+#define PWM_CLOCK_HZ            (PWM_CLOCK_MHZ * 1000000UL)
+
+#endif //PWM_PRIVATE_H
@@ -0,0 +1,357 @@
+/**
+ * @file    :   pwm_program.c
+ * @brief   :   Program File contains all PWM (Module 1 PWM generators) functions' implementation
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "bit_math.h"
+#include "pwm_interface.h"
+#include "pwm_private.h"
+
+static uint8_t_ gl_u8_pwm_channels_mask = ZERO;     // channels configured by pwm_init
+static uint8_t_ gl_u8_pwm_gens_mask = ZERO;         // generators of the configured channels
+static uint16_t_ gl_arr_u16_pwm_duty[PWM_CHANNEL_TOTAL];
+static uint32_t_ gl_u32_pwm_steps = ZERO;           // counts per period (LOAD + 1)
+static uint8_t_ gl_u8_pwm_div_shift = ZERO;         // PWM clock = system clock >> div shift
+static boolean gl_bool_pwm_initialized = FALSE;
+
+/**
+ * @brief                      : Writes the compare and actions of a channel for its staged duty
+ *
+ * @param en_a_channel           : PWM channel
+ *
+ * @note                       : The output is set on load and cleared on the compare going down, 0% and 100%
+ *                               use constant actions so both ends are exact
+ */
+static void pwm_write_channel(en_pwm_channel_t en_a_channel)
+{
+    st_pwm_gen_regs_t * ptr_st_gen = &PWM1_REGS->GEN[PWM_GEN(en_a_channel)];
+    uint8_t_ u8_out = PWM_GEN_OUT(en_a_channel);
+    // high counts, rounded to the nearest step
+    uint32_t_ u32_high = (uint32_t_) ((((uint64_t_) gl_arr_u16_pwm_duty[en_a_channel] * gl_u32_pwm_steps) +
+                                       (PWM_DUTY_FULL / 2)) / PWM_DUTY_FULL);
+
+    if(ZERO == u32_high)
+    {
+        ptr_st_gen->GEN[u8_out] = PWM_GEN_ACT_CONST_LOW;
+    }
+    else if(u32_high >= gl_u32_pwm_steps)
+    {
+        ptr_st_gen->GEN[u8_out] = PWM_GEN_ACT_CONST_HIGH;
+    }
+    else
+    {
+        // counter runs LOAD -> 0, high from LOAD down to the compare
+        ptr_st_gen->CMP[u8_out] = (gl_u32_pwm_steps - 1) - u32_high;
+        ptr_st_gen->GEN[u8_out] = PWM_GEN_ACT_PULSE(u8_out);
+    }
+}
+
+/**
+ * @brief                      : Applies a clock divider and period to all configured generators
+ *
+ * @param u8_a_div_shift         : PWM clock divider as a power of 2 (0 -> PWM_DIV_SHIFT_MAX)
+ * @param u32_a_steps            : Counts per period (PWM_STEPS_MIN -> PWM_STEPS_MAX)
+ * @param ptr_st_a_timing        : Pointer to store the resulting timing (NULL_PTR if not needed)
+ */
+static void pwm_apply_timing(uint8_t_ u8_a_div_shift, uint32_t_ u32_a_steps, st_pwm_timing_t * ptr_st_a_timing)
+{
+    uint8_t_ u8_gen;
+    uint8_t_ u8_channel;
+
+    if(ZERO == u8_a_div_shift)
+    {
+        CLR_BIT(PWM_RCC, PWM_RCC_USEPWMDIV);
+    }
+    else
+    {
+        PWM_RCC = (PWM_RCC & ~PWM_RCC_PWMDIV_MASK) |
+                  ((uint32_t_) (u8_a_div_shift - 1) << PWM_RCC_PWMDIV_SHIFT) |
+                  (1UL << PWM_RCC_USEPWMDIV);
+    }
+
+    gl_u8_pwm_div_shift = u8_a_div_shift;
+    gl_u32_pwm_steps = u32_a_steps;
+
+    for(u8_gen = ZERO; u8_gen < PWM_GENERATORS; u8_gen++)
+    {
+        if(GET_BIT(gl_u8_pwm_gens_mask, u8_gen))
+        {
+            PWM1_REGS->GEN[u8_gen].LOAD = u32_a_steps - 1;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    // rescale the staged duties to the new step count
+    for(u8_channel = ZERO; u8_channel < PWM_CHANNEL_TOTAL; u8_channel++)
+    {
+        if(GET_BIT(gl_u8_pwm_channels_mask, u8_channel))
+        {
+            pwm_write_channel((en_pwm_channel_t) u8_channel);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    if(NULL_PTR != ptr_st_a_timing)
+    {
+        pwm_get_timing(ptr_st_a_timing);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ * @brief                      : Finds the divider and period of a frequency, the smallest divider keeps the
+ *                               most resolution
+ *
+ * @param u32_a_freq_hz          : PWM frequency
+ * @param ptr_u8_a_div_shift     : Pointer to store the divider
+ * @param ptr_u32_a_steps        : Pointer to store the counts per period
+ *
+ * @return  PWM_OK             :   Frequency reachable
+ *          PWM_OUT_OF_RANGE   :   Less than PWM_STEPS_MIN steps, or a period above the counter and divider
+ */
+static en_pwm_error_t pwm_calc_timing(uint32_t_ u32_a_freq_hz, uint8_t_ * ptr_u8_a_div_shift,
+                                      uint32_t_ * ptr_u32_a_steps)
+{
+    en_pwm_error_t en_pwm_error_retval = PWM_OK;
+    uint32_t_ u32_ticks = (PWM_CLOCK_HZ + (u32_a_freq_hz / 2)) / u32_a_freq_hz;
+    uint8_t_ u8_div_shift = ZERO;
+
+    while(
+            (u8_div_shift < PWM_DIV_SHIFT_MAX) &&
+            (((u32_ticks + (1UL << u8_div_shift) / 2) >> u8_div_shift) > PWM_STEPS_MAX)
+            )
+    {
+        u8_div_shift++;
+    }
+
+    // nearest whole number of divided counts
+    *ptr_u32_a_steps = (u32_ticks + ((1UL << u8_div_shift) / 2)) >> u8_div_shift;
+    *ptr_u8_a_div_shift = u8_div_shift;
+
+    if(
+            (*ptr_u32_a_steps < PWM_STEPS_MIN) ||
+            (*ptr_u32_a_steps > PWM_STEPS_MAX)
+            )
+    {
+        en_pwm_error_retval = PWM_OUT_OF_RANGE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return en_pwm_error_retval;
+}
+
+en_pwm_error_t pwm_init(const st_pwm_cfg_t * ptr_st_a_pwm_cfg)
+{
+    en_pwm_error_t en_pwm_error_retval = PWM_OK;
+    uint8_t_ u8_div_shift = ZERO;
+    uint32_t_ u32_steps = ZERO;
+
+    if(
+            (NULL_PTR == ptr_st_a_pwm_cfg) ||
+            (ZERO == ptr_st_a_pwm_cfg->u32_freq_hz)
+            )
+    {
+        en_pwm_error_retval = PWM_INVALID_ARGS;
+    }
+    else if(ZERO == ptr_st_a_pwm_cfg->u8_channels_mask)
+    {
+        en_pwm_error_retval = PWM_INVALID_CONFIG;
+    }
+    else if(PWM_OK != pwm_calc_timing(ptr_st_a_pwm_cfg->u32_freq_hz, &u8_div_shift, &u32_steps))
+    {
+        en_pwm_error_retval = PWM_OUT_OF_RANGE;
+    }
+    else
+    {
+        st_pwm_regs_t * ptr_st_regs = PWM1_REGS;
+        uint8_t_ u8_gen;
+        uint8_t_ u8_channel;
+
+        // 1. Enable the module clock and wait until it is ready
+        SET_BIT(RCGCPWM, PWM_MODULE_1);
+        while(!GET_BIT(PRPWM, PWM_MODULE_1));
+
+        gl_u8_pwm_channels_mask = ptr_st_a_pwm_cfg->u8_channels_mask;
+        gl_u8_pwm_gens_mask = ZERO;
+        for(u8_gen = ZERO; u8_gen < PWM_GENERATORS; u8_gen++)
+        {
+            if(gl_u8_pwm_channels_mask & PWM_GEN_CHANNELS(u8_gen))
+            {
+                SET_BIT(gl_u8_pwm_gens_mask, u8_gen);
+
+                // 2. Stop the generator, count down
+                ptr_st_regs->GEN[u8_gen].CTL = ZERO;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+
+        // 3. All channels start at 0% duty
+        for(u8_channel = ZERO; u8_channel < PWM_CHANNEL_TOTAL; u8_channel++)
+        {
+            gl_arr_u16_pwm_duty[u8_channel] = ZERO;
+        }
+
+        // 4. Period and compares, taken at once while the generators are stopped
+        pwm_apply_timing(u8_div_shift, u32_steps, NULL_PTR);
+
+        // 5. Start the generators, every later update waits for the global sync,
+        //    counters aligned so all generators share the period boundary
+        for(u8_gen = ZERO; u8_gen < PWM_GENERATORS; u8_gen++)
+        {
+            if(GET_BIT(gl_u8_pwm_gens_mask, u8_gen))
+            {
+                ptr_st_regs->GEN[u8_gen].CTL = PWM_GEN_CTL_SYNC_ALL | (1UL << PWM_GEN_CTL_ENABLE);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        ptr_st_regs->SYNC = gl_u8_pwm_gens_mask;
+        ptr_st_regs->CTL |= gl_u8_pwm_gens_mask;
+
+        // 6. Drive the outputs
+        ptr_st_regs->ENABLE |= gl_u8_pwm_channels_mask;
+
+        gl_bool_pwm_initialized = TRUE;
+    }
+
+    return en_pwm_error_retval;
+}
+
+en_pwm_error_t pwm_set_frequency(uint32_t_ u32_a_freq_hz, st_pwm_timing_t * ptr_st_a_timing)
+{
+    en_pwm_error_t en_pwm_error_retval = PWM_OK;
+    uint8_t_ u8_div_shift = ZERO;
+    uint32_t_ u32_steps = ZERO;
+
+    if(ZERO == u32_a_freq_hz)
+    {
+        en_pwm_error_retval = PWM_INVALID_ARGS;
+    }
+    else if(FALSE == gl_bool_pwm_initialized)
+    {
+        en_pwm_error_retval = PWM_INVALID_CONFIG;
+    }
+    else if(PWM_OK != pwm_calc_timing(u32_a_freq_hz, &u8_div_shift, &u32_steps))
+    {
+        en_pwm_error_retval = PWM_OUT_OF_RANGE;
+    }
+    else
+    {
+        pwm_apply_timing(u8_div_shift, u32_steps, ptr_st_a_timing);
+    }
+
+    return en_pwm_error_retval;
+}
+
+en_pwm_error_t pwm_set_resolution(uint8_t_ u8_a_resolution_bits, st_pwm_timing_t * ptr_st_a_timing)
+{
+    en_pwm_error_t en_pwm_error_retval = PWM_OK;
+
+    if(
+            (ZERO == u8_a_resolution_bits) ||
+            (PWM_RESOLUTION_MAX < u8_a_resolution_bits)
+            )
+    {
+        en_pwm_error_retval = PWM_INVALID_ARGS;
+    }
+    else if(FALSE == gl_bool_pwm_initialized)
+    {
+        en_pwm_error_retval = PWM_INVALID_CONFIG;
+    }
+    else
+    {
+        // undivided clock, the period is exactly 2^bits counts
+        pwm_apply_timing(ZERO, 1UL << u8_a_resolution_bits, ptr_st_a_timing);
+    }
+
+    return en_pwm_error_retval;
+}
+
+en_pwm_error_t pwm_get_timing(st_pwm_timing_t * ptr_st_a_timing)
+{
+    en_pwm_error_t en_pwm_error_retval = PWM_OK;
+
+    if(NULL_PTR == ptr_st_a_timing)
+    {
+        en_pwm_error_retval = PWM_INVALID_ARGS;
+    }
+    else if(FALSE == gl_bool_pwm_initialized)
+    {
+        en_pwm_error_retval = PWM_INVALID_CONFIG;
+    }
+    else
+    {
+        uint32_t_ u32_steps = gl_u32_pwm_steps;
+        uint8_t_ u8_bits = ZERO;
+
+        while(u32_steps > 1)
+        {
+            u32_steps >>= 1;
+            u8_bits++;
+        }
+
+        ptr_st_a_timing->u32_steps = gl_u32_pwm_steps;
+        ptr_st_a_timing->u8_resolution_bits = u8_bits;
+        ptr_st_a_timing->u32_freq_hz = (PWM_CLOCK_HZ >> gl_u8_pwm_div_shift) / gl_u32_pwm_steps;
+    }
+
+    return en_pwm_error_retval;
+}
+
+en_pwm_error_t pwm_set_duty(en_pwm_channel_t en_a_channel, uint16_t_ u16_a_duty)
+{
+    en_pwm_error_t en_pwm_error_retval = PWM_OK;
+
+    if(en_a_channel >= PWM_CHANNEL_TOTAL)
+    {
+        en_pwm_error_retval = PWM_INVALID_ARGS;
+    }
+    else if(!GET_BIT(gl_u8_pwm_channels_mask, en_a_channel))
+    {
+        en_pwm_error_retval = PWM_INVALID_CONFIG;
+    }
+    else
+    {
+        gl_arr_u16_pwm_duty[en_a_channel] = u16_a_duty;
+        pwm_write_channel(en_a_channel);
+    }
+
+    return en_pwm_error_retval;
+}
+
+en_pwm_error_t pwm_update(void)
+{
+    en_pwm_error_t en_pwm_error_retval = PWM_OK;
+
+    if(FALSE == gl_bool_pwm_initialized)
+    {
+        en_pwm_error_retval = PWM_INVALID_CONFIG;
+    }
+    else
+    {
+        // one store requests the update of every generator, all latch when their aligned counters reach zero
+        PWM1_REGS->CTL |= gl_u8_pwm_gens_mask;
+    }
+
+    return en_pwm_error_retval;
+}
@@ -13,6 +13,7 @@
 
 #include "std.h"
 
+// nominal system clock (compile time checks), the driver reads SystemCoreClock at init
 #define SYS_CLOCK_MHZ   8
 
 #if SYS_CLOCK_MHZ < 8
@@ -20,6 +21,20 @@
 #endif
 #define PIOSC_MHZ       16
 
+// free running mode tick period, uptime advances by one period per systick interrupt
+#define SYSTICK_TICK_PERIOD_US  1000
+
+// systick exception priority (0 = highest), blocking waits in SYSTICK_WAIT_SLEEP_SYSTICK_ONLY mask anything lower.
+// Systick must be the only source at this priority: the drivers keep their lines below it
+// (GPT_IRQ_PRIORITY 1, GPIO_IRQ_PRIORITY 2), any other line enabled by the application must too
+#define SYSTICK_IRQ_PRIORITY    0
+
+// subscriber table capacity, systick handler dispatch cost is bounded by this
+#define SYSTICK_MAX_SUBSCRIBERS     4
+
+// us delays up to this length busy-wait on the core cycle counter, longer ones use the systick interrupt
+#define SYSTICK_US_BUSY_WAIT_MAX    100
+
 /*----------------------------------------------------------/
 /- ENUMS
 /----------------------------------------------------------*/
@@ -33,13 +48,47 @@ typedef enum{
     CLK_SRC_TOTAL
 }en_systick_clk_src_t;
 
+typedef enum{
+    /* timer runs only while a delay is pending (stopped otherwise) */
+    SYSTICK_MODE_ONE_SHOT   =   0   ,
+
+    /* periodic tick started by init, keeps a 64-bit uptime counter */
+    SYSTICK_MODE_FREE_RUNNING       ,
+
+    SYSTICK_MODE_TOTAL
+}en_systick_mode_t;
+
+typedef enum{
+    /* sleep (WFI) until woken by an interrupt, other interrupts keep being serviced */
+    SYSTICK_WAIT_SLEEP              =   0   ,
+
+    /* sleep, only systick wakes the core (see SYSTICK_IRQ_PRIORITY), others pend until the wait ends */
+    SYSTICK_WAIT_SLEEP_SYSTICK_ONLY         ,
+
+    /* spin at full power */
+    SYSTICK_WAIT_BUSY                       ,
+
+    SYSTICK_WAIT_TOTAL
+}en_systick_wait_t;
+
 typedef enum{
     ST_OK               =   0   ,
     ST_INVALID_CONFIG           ,
     ST_INVALID_ARGS             ,
+    ST_SUBSCRIBERS_FULL         ,
 }en_systick_error_t;
 
-typedef void (*fun_systick_callback_t)(void);
+typedef enum{
+    /* every free running tick */
+    SYSTICK_EVENT_TICK          =   0   ,
+
+    /* async delay finished */
+    SYSTICK_EVENT_DELAY_DONE            ,
+
+    SYSTICK_EVENT_TOTAL
+}en_systick_event_t;
+
+typedef void (*fun_systick_subscriber_t)(void * ptr_v_ctx);
 
 
 /*----------------------------------------------------------/
@@ -58,10 +107,21 @@ typedef struct{
 
     en_systick_clk_src_t en_systick_clk_src;
 
-    fun_systick_callback_t fun_ptr_systick_cb;
+    en_systick_mode_t en_systick_mode;
+
+    /* how blocking delays wait */
+    en_systick_wait_t en_systick_wait;
 
 }st_systick_cfg_t;
 
+typedef struct{
+    /* periods that ended while the periodic callback was still running */
+    uint32_t_ u32_overruns;
+
+    /* periods that ended without a callback (a callback spanned more than one period) */
+    uint32_t_ u32_missed_ticks;
+}st_systick_periodic_stats_t;
+
 /**
  * @brief                       : Initializes SYSTICK driver
  *
@@ -77,7 +137,8 @@ en_systick_error_t systick_init(st_systick_cfg_t * ptr_a_st_systick_cfg);
 /**
  * @brief                      : Initiates a sync blocking delay
  *
- * @param uint32_a_ms_delay      : Desired delay in ms
+ * @param uint32_a_ms_delay      : Desired delay in ms (any length, chained over 2^24 tick reload periods)
+ * @note                       : Sleeps between systick interrupts (see en_systick_wait), interrupts must be enabled
  *
  * @return  ST_OK              :   In case of Successful Operation
  *          ST_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
@@ -89,8 +150,11 @@ en_systick_error_t systick_ms_delay(uint32_t_ uint32_a_ms_delay);
 /**
  * @brief                      :    Initiates a sync blocking delay
  *
- * @param uint32_a_ms_delay      :    Desired delay in ms
- * @note                       :    Will be cancelled if any sync/blocking delay was requested
+ * @param uint32_a_ms_delay      :    Desired delay in ms (any length, one interrupt per 2^24 ticks)
+ * @note                       :    One shot mode: will be cancelled if any sync/blocking delay was requested
+ *                                  Free running mode: the period the deadline falls in is split so the handler
+ *                                  runs at the deadline (late by at most SYSTICK_IDLE_MIN_TICKS, one tick
+ *                                  period while a periodic callback is active), not cancelled by sync delays
  *
  * @return  ST_OK              :    In case of Successful Operation
  *          ST_INVALID_ARGS    :    In case of Failed Operation (Invalid Arguments Given)
@@ -100,15 +164,148 @@ en_systick_error_t systick_async_ms_delay(uint32_t_ uint32_a_ms_delay);
 
 
 /**
- * @brief                      :    Sets callback function to be called when an async delay is finished
+ * @brief                      : Initiates a sync blocking delay in us
  *
- * @param fun_ptr_a_systick_cb   :    Pointer to callback fn
+ * @param u32_a_us_delay         : Desired delay in us
+ * @note                       : Up to SYSTICK_US_BUSY_WAIT_MAX: cycle counted busy wait, call overhead
+ *                               compensated (same accuracy for both clock sources)
+ *                               Longer: same as systick_ms_delay with us resolution, free running mode
+ *                               sleeps until a systick interrupt split at the deadline (remainders under
+ *                               2 * SYSTICK_IDLE_MIN_TICKS, or any remainder while a periodic callback is
+ *                               active, are busy-polled)
+ *
+ * @return  ST_OK              :   In case of Successful Operation
+ *          ST_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ *          ST_INVALID_CONFIG  :   In case of Failed Operation (Invalid Systick Config Given)
+ */
+en_systick_error_t systick_us_delay(uint32_t_ u32_a_us_delay);
+
+
+/**
+ * @brief                      :    Initiates an async delay in us, notifies SYSTICK_EVENT_DELAY_DONE subscribers when done
+ *
+ * @param u32_a_us_delay         :    Desired delay in us
+ * @note                       :    Same behavior as systick_async_ms_delay (wakes at the deadline in free
+ *                                  running mode)
  *
  * @return  ST_OK              :    In case of Successful Operation
  *          ST_INVALID_ARGS    :    In case of Failed Operation (Invalid Arguments Given)
  *          ST_INVALID_CONFIG  :    In case of Failed Operation (Invalid Systick Config Given)
  */
-en_systick_error_t systick_set_callback(fun_systick_callback_t fun_ptr_a_systick_cb);
+en_systick_error_t systick_async_us_delay(uint32_t_ u32_a_us_delay);
+
+
+/**
+ * @brief                      :    Adds a subscriber called from the systick handler on an event
+ *
+ * @param en_a_event             :    Event to subscribe to
+ * @param fun_ptr_a_cb           :    Pointer to subscriber fn
+ * @param ptr_v_a_ctx            :    Context pointer passed back to the subscriber
+ * @note                       :    Subscribing the same fn/ctx/event again has no effect
+ *
+ * @return  ST_OK              :    In case of Successful Operation
+ *          ST_INVALID_ARGS    :    In case of Failed Operation (Invalid Arguments Given)
+ *          ST_INVALID_CONFIG  :    In case of Failed Operation (Tick event without free running mode)
+ *          ST_SUBSCRIBERS_FULL:    In case all SYSTICK_MAX_SUBSCRIBERS entries are in use
+ */
+en_systick_error_t systick_subscribe(en_systick_event_t en_a_event, fun_systick_subscriber_t fun_ptr_a_cb,
+                                     void * ptr_v_a_ctx);
+
+
+/**
+ * @brief                      :    Removes a subscriber added by systick_subscribe
+ *
+ * @param en_a_event             :    Subscribed event
+ * @param fun_ptr_a_cb           :    Pointer to subscriber fn
+ * @param ptr_v_a_ctx            :    Subscribed context pointer
+ *
+ * @return  ST_OK              :    In case of Successful Operation
+ *          ST_INVALID_ARGS    :    In case of Failed Operation (No such subscriber)
+ */
+en_systick_error_t systick_unsubscribe(en_systick_event_t en_a_event, fun_systick_subscriber_t fun_ptr_a_cb,
+                                       void * ptr_v_a_ctx);
+
+
+/**
+ * @brief                      :    Sleeps until the given uptime or any interrupt, without intermediate ticks
+ *
+ * @param u64_a_wake_ms          :    Uptime (ms) of the next deadline, e.g. the next software timer expiry
+ *                                    (capped to one 24-bit reload, ~4 s at PIOSC/4)
+ * @note                       :    Free running mode only. One systick period up to the deadline is
+ *                                  programmed, the uptime is kept exact on wake-up from systick or any
+ *                                  other interrupt. Returns after the first wake-up, call again while idle.
+ *                                  May be called with interrupts masked (PRIMASK): pending interrupts still
+ *                                  end the sleep and are serviced before it returns
+ *
+ * @return  ST_OK              :    In case of Successful Operation
+ *          ST_INVALID_CONFIG  :    In case of Failed Operation (Systick not initialized in free running mode)
+ */
+en_systick_error_t systick_tickless_idle(uint64_t_ u64_a_wake_ms);
+
+
+/**
+ * @brief                      :    Calls a callback at a fixed rate from the systick handler, using auto-reload
+ *                                  so the rate never drifts with interrupt latency
+ *
+ * @param u32_a_period_us        :    Callback period in us (must fit one 24-bit reload, ~4 s at PIOSC/4)
+ * @param fun_ptr_a_cb           :    Pointer to the periodic callback
+ * @param ptr_v_a_ctx            :    Context pointer passed back to the callback
+ * @note                       :    Free running mode: the tick period becomes u32_a_period_us, the uptime stays
+ *                                  exact and tick subscribers / async delays run on the new tick, tickless idle
+ *                                  keeps ticking while a periodic callback is active.
+ *                                  One shot mode: takes over the timer, cancels any running delay and is
+ *                                  cancelled by the next delay.
+ *                                  Restarting replaces the callback and clears the statistics
+ *
+ * @return  ST_OK              :    In case of Successful Operation
+ *          ST_INVALID_ARGS    :    In case of Failed Operation (NULL callback or period out of range)
+ *          ST_INVALID_CONFIG  :    In case of Failed Operation (Systick not initialized)
+ */
+en_systick_error_t systick_start_periodic(uint32_t_ u32_a_period_us, fun_systick_subscriber_t fun_ptr_a_cb,
+                                          void * ptr_v_a_ctx);
+
+
+/**
+ * @brief                      :    Stops the periodic callback started by systick_start_periodic
+ *
+ * @note                       :    Free running mode: restores the SYSTICK_TICK_PERIOD_US tick period
+ *
+ * @return  ST_OK              :    In case of Successful Operation
+ *          ST_INVALID_CONFIG  :    In case of Failed Operation (Systick not initialized)
+ */
+en_systick_error_t systick_stop_periodic(void);
+
+
+/**
+ * @brief                      :    Gets the periodic callback overrun and missed tick counters
+ *
+ * @param ptr_st_a_stats         :    Pointer to store the counters (since the last systick_start_periodic)
+ *
+ * @return  ST_OK              :    In case of Successful Operation
+ *          ST_INVALID_ARGS    :    In case of Failed Operation (Invalid Arguments Given)
+ */
+en_systick_error_t systick_get_periodic_stats(st_systick_periodic_stats_t * ptr_st_a_stats);
+
+
+/**
+ * @brief                      :    Gets the monotonic uptime since init in us
+ *
+ * @note                       :    Free running mode only, returns 0 otherwise.
+ *                                  Safe to call from any context (thread or ISR)
+ *
+ * @return                     :    Uptime in us (sub-tick precision from STCURRENT)
+ */
+uint64_t_ systick_now_us(void);
+
+
+/**
+ * @brief                      :    Gets the monotonic uptime since init in ms
+ *
+ * @note                       :    Free running mode only, returns 0 otherwise
+ *
+ * @return                     :    Uptime in ms
+ */
+uint64_t_ systick_now_ms(void);
 
 
 #endif //SYSTICK_INTERFACE_H
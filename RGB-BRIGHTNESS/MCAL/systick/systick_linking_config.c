@@ -7,5 +7,6 @@
 st_systick_cfg_t gl_st_systick_cfg_0 =
 {
         .en_systick_clk_src = CLK_SRC_PIOSC,
-        .fun_ptr_systick_cb = NULL_PTR
+        .en_systick_mode    = SYSTICK_MODE_FREE_RUNNING,
+        .en_systick_wait    = SYSTICK_WAIT_SLEEP
 };
@@ -18,7 +18,12 @@
  * ACCESS   :   R/W
  * RESET    :   0x0000.0004
  */
+#ifdef SYSTICK_HOST_REGS
+// host build: the registers of the simulated core (tests/host), through its SysTick block
+#define STCTRL					(SysTick->CTRL)
+#else
 #define STCTRL					*((volatile uint32_t_*) (CORE_PERIPHERALS_BASE_ADDRESS + 0x010))
+#endif
 
 // STCTRL BITS
 #define STCTRL_COUNT        16
@@ -26,8 +31,40 @@
 #define STCTRL_INT_ENABLE   1
 #define STCTRL_CLK_SRC      2
 
+// systick clock ticks per us for each clock source, the system clock one is read from SystemCoreClock at init
+// (SYS_CLK_TICKS_PER_US is the nominal value, only used by the compile time checks below)
+#define PIOSC_TICKS_PER_US      (PIOSC_MHZ / 4)     // PIOSC / 4
+#define SYS_CLK_TICKS_PER_US    (SYS_CLOCK_MHZ)
+
+#define SYSTICK_HZ_PER_MHZ      1000000UL
+
+// BASEPRI value masking every interrupt with lower priority than systick while waiting
+#define SYSTICK_WAIT_BASEPRI    ((SYSTICK_IRQ_PRIORITY + 1) << (8 - __NVIC_PRIO_BITS))
+
+// BASEPRI can not mask the highest priority, systick must be alone above every other line
+#if SYSTICK_IRQ_PRIORITY != 0
+    #error SYSTICK_IRQ_PRIORITY must be 0 for SYSTICK_WAIT_SLEEP_SYSTICK_ONLY to wake on systick only
+#endif
+
+// tickless idle: stop/restart pairs timed against DWT->CYCCNT at init to measure the core cycles the counter is
+// stopped for and the cycle count samples do not cover (restart sample to enable store, less stop sample to
+// disable store). Each pair on the system clock source moves the uptime behind the cycle counter by that amount
+#define SYSTICK_IDLE_CALIBRATION_PAIRS  16
+// tickless idle / split periods: shortest period programmed when cutting a period short (must exceed the
+// restart loss and the handler latency), free running wake-ups at a deadline are late by at most this
+#define SYSTICK_IDLE_MIN_TICKS          64
+// periodic mode: shortest period, leaves the handler time to run before the next reload
+#define SYSTICK_PERIODIC_MIN_TICKS      64
+
 #define STLOAD_MIN_VALUE 0x00000001 // 24-bits countdown timer min value
 #define STLOAD_MAX_VALUE 0x00FFFFFF // 24-bits countdown timer max value
+#define STLOAD_PERIOD_TICKS (STLOAD_MAX_VALUE + 1ULL) // ticks in one full reload period
+
+// free running tick period must fit in the 24-bit reload for either clock source
+#if ((SYSTICK_TICK_PERIOD_US * PIOSC_TICKS_PER_US) > STLOAD_PERIOD_TICKS) || \
+    ((SYSTICK_TICK_PERIOD_US * SYS_CLK_TICKS_PER_US) > STLOAD_PERIOD_TICKS)
+    #error SYSTICK_TICK_PERIOD_US does not fit in the 24-bit systick reload
+#endif
 
 /**
  * BRIEF    :   SysTick Reload Value Register
@@ -37,7 +74,11 @@
  * IMP NOTE :   in order to access this register correctly,
  *              the system clock must be faster than 8 MHz
  */
+#ifdef SYSTICK_HOST_REGS
+#define STRELOAD				(SysTick->LOAD)
+#else
 #define STRELOAD				*((volatile uint32_t_*) (CORE_PERIPHERALS_BASE_ADDRESS + 0x014))
+#endif
 
 /**
  * BRIEF    :   SysTick Current Value Register
@@ -45,6 +86,10 @@
  * ACCESS   :   R/W/C
  * RESET    :   -
  */
+#ifdef SYSTICK_HOST_REGS
+#define STCURRENT				(SysTick->VAL)
+#else
 #define STCURRENT				*((volatile uint32_t_*) (CORE_PERIPHERALS_BASE_ADDRESS + 0x018))
+#endif
 
 #endif //SYSTICK_PRIVATE_H
@@ -11,142 +11,1174 @@
 #include "systick_interface.h"
 #include "systick_private.h"
 #include "bit_math.h"
+#include "TM4C123.h"
+
+// interrupt masking state saved around a blocking wait
+typedef struct{
+    uint32_t_ u32_primask;
+    uint32_t_ u32_basepri;
+}st_systick_wait_ctx_t;
+
+// systick handler subscriber, free when fun_ptr_cb is NULL_PTR
+typedef struct{
+    fun_systick_subscriber_t fun_ptr_cb;
+    void * ptr_v_ctx;
+    en_systick_event_t en_event;
+}st_systick_subscriber_t;
 
 static boolean gl_systick_initialized = FALSE;
 static st_systick_cfg_t * gl_ptr_st_systick_cfg;
 
+// systick clock ticks per time unit, computed once from the selected clock source
+static uint32_t_ gl_u32_ticks_per_us = 0;
+static uint32_t_ gl_u32_ticks_per_ms = 0;
+// core clock cycles per us (SystemCoreClock at init), used by the cycle counter
+static uint32_t_ gl_u32_cpu_cycles_per_us = 0;
+
+// free running mode time base
+static uint32_t_ gl_u32_period_ticks = 0;                   // ticks per systick interrupt
+static volatile uint32_t_ gl_u32_run_ticks = 0;             // length of the running period (longer in tickless idle)
+static volatile uint32_t_ gl_u32_next_run_ticks = 0;        // length of the period queued in STRELOAD
+static volatile boolean gl_bool_split_head = FALSE;         // running period ends at a deadline, not on a tick
+static volatile uint64_t_ gl_u64_uptime_ticks = 0;          // ticks elapsed at the last reload
+static volatile uint64_t_ gl_u64_async_deadline = 0;        // uptime (ticks) of the pending async delay
+static volatile boolean gl_bool_async_pending = FALSE;
+static volatile uint32_t_ gl_u32_retune_ticks = 0;          // tick period change deferred to the handler, 0 if none
+// one shot mode chained delay state
+static volatile uint32_t_ gl_u32_oneshot_segments = 0;      // reload periods left, including the running one
+static uint32_t_ gl_u32_oneshot_last_reload = 0;            // reload value of the final (remainder) period
+static boolean gl_bool_oneshot_async = FALSE;
+static volatile boolean gl_bool_oneshot_busy = FALSE;
+// periodic callback (auto-reload), shares the free running tick or owns the timer in one shot mode
+static volatile boolean gl_bool_periodic_active = FALSE;
+static fun_systick_subscriber_t gl_fun_ptr_periodic_cb = NULL_PTR;
+static void * gl_ptr_v_periodic_ctx = NULL_PTR;
+static volatile uint32_t_ gl_u32_periodic_overruns = 0;
+static volatile uint32_t_ gl_u32_periodic_missed_ticks = 0;
+
+// core cycles spent calling/returning from systick_us_delay, measured at init
+static uint32_t_ gl_u32_us_delay_overhead_cycles = 0;
+// core cycles a tickless stop/restart loses outside the cycle count samples, measured at init
+static uint32_t_ gl_u32_idle_restart_cycles = 0;
+
+static st_systick_subscriber_t gl_arr_st_systick_subscribers[SYSTICK_MAX_SUBSCRIBERS];
+
+/**
+ * @brief                      : Reads the free running uptime in ticks without tearing
+ *
+ * @note                       : The 64-bit counter and STCURRENT are sampled with interrupts masked,
+ *                               a reload not yet accounted for by the handler (PENDSTSET) is added here
+ *
+ * @return                     : Uptime in systick clock ticks
+ */
+static uint64_t_ systick_now_ticks(void)
+{
+    uint32_t_ u32_primask = __get_PRIMASK();
+    uint64_t_ u64_base;
+    uint32_t_ u32_run_ticks;
+    uint32_t_ u32_current;
+
+    __disable_irq();
+
+    u64_base = gl_u64_uptime_ticks;
+    u32_run_ticks = gl_u32_run_ticks;
+    u32_current = STCURRENT;
+
+    if(SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+    {
+        // counter reached 0 but the handler did not run yet (masked or higher priority context)
+        u32_current = STCURRENT;
+        if(ZERO != u32_current)
+        {
+            // already reloaded, current period started after the pending one (the queued one)
+            u64_base += u32_run_ticks;
+            u32_run_ticks = gl_u32_next_run_ticks;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    __set_PRIMASK(u32_primask);
+
+    return u64_base + (u32_run_ticks - 1 - u32_current);
+}
+
+/**
+ * @brief                      : Converts a delay in ms to systick clock ticks
+ *
+ * @param uint32_a_ms_delay      : Desired delay in ms
+ * @param ptr_u64_a_ticks        : Pointer to store the number of ticks
+ *
+ * @return  ST_OK              :   In case of Successful Operation
+ *          ST_INVALID_ARGS    :   In case the delay is zero
+ */
+static en_systick_error_t systick_ms_to_ticks(uint32_t_ uint32_a_ms_delay, uint64_t_ * ptr_u64_a_ticks)
+{
+    en_systick_error_t en_systick_error_retval = ST_OK;
+
+    if(ZERO == uint32_a_ms_delay)
+    {
+        en_systick_error_retval = ST_INVALID_ARGS;
+    }
+    else
+    {
+        // 64-bit product, long delays are chained over several reload periods
+        *ptr_u64_a_ticks = (uint64_t_) uint32_a_ms_delay * gl_u32_ticks_per_ms;
+    }
+
+    return en_systick_error_retval;
+}
+
+/**
+ * @brief                      : Starts a one shot delay of any length as a chain of reload periods
+ *
+ * @param u64_a_ticks            : Delay length in systick clock ticks
+ * @param bool_a_async           : TRUE to notify SYSTICK_EVENT_DELAY_DONE subscribers when done
+ *
+ * @note                       : Full 2^24 tick periods run first and the remainder last, so there is one
+ *                               interrupt per 2^24 ticks and the next reload value is always written
+ *                               while a full period is running (STRELOAD is only latched on reload)
+ */
+static void systick_oneshot_start(uint64_t_ u64_a_ticks, boolean bool_a_async)
+{
+    uint32_t_ u32_segments = (uint32_t_) (u64_a_ticks / STLOAD_PERIOD_TICKS);
+    uint32_t_ u32_remainder = (uint32_t_) (u64_a_ticks % STLOAD_PERIOD_TICKS);
+
+    // cancel any running delay or periodic callback, including an already pended interrupt
+    CLR_BIT(STCTRL, STCTRL_ENABLE);
+    SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+    gl_bool_periodic_active = FALSE;
+
+    if(ZERO == u32_remainder)
+    {
+        // last period is a full one
+        gl_u32_oneshot_last_reload = STLOAD_MAX_VALUE;
+    }
+    else
+    {
+        // a reload value of 0 would stop the counter, round a 1 tick remainder up
+        if(u32_remainder <= STLOAD_MIN_VALUE)
+        {
+            u32_remainder = STLOAD_MIN_VALUE + 1;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        gl_u32_oneshot_last_reload = u32_remainder - 1;
+        u32_segments++;
+    }
+
+    gl_u32_oneshot_segments = u32_segments;
+    gl_bool_oneshot_async = bool_a_async;
+    gl_bool_oneshot_busy = TRUE;
+
+    // 1. Program the value in the STRELOAD Register (counts reload..0)
+    STRELOAD = (1 == u32_segments) ? gl_u32_oneshot_last_reload : STLOAD_MAX_VALUE;
+
+    // 2. Clear STCURRENT register by writing any value (preferably a zero)
+    STCURRENT = ZERO;
+
+    // 3. Configure the STCTRL register for the required operation
+    SET_BIT(STCTRL, STCTRL_INT_ENABLE);
+    SET_BIT(STCTRL, STCTRL_ENABLE); // start timer
+
+    if(2 == u32_segments)
+    {
+        // wait for the first (full) period to be loaded, then queue the remainder behind it
+        while(ZERO == STCURRENT);
+        STRELOAD = gl_u32_oneshot_last_reload;
+    }
+    else
+    {
+        // further reloads are queued by the interrupt handler
+        /* Do Nothing */
+    }
+}
+
+/**
+ * @brief                      : Prepares a blocking wait, interrupts are masked (PRIMASK) while the
+ *                               wait condition is checked so a wake-up right before WFI is not lost
+ *
+ * @param ptr_st_a_wait_ctx      : Pointer to store the masking state to restore
+ */
+static void systick_wait_begin(st_systick_wait_ctx_t * ptr_st_a_wait_ctx)
+{
+    ptr_st_a_wait_ctx->u32_primask = __get_PRIMASK();
+    ptr_st_a_wait_ctx->u32_basepri = __get_BASEPRI();
+
+    __disable_irq();
+
+    if(SYSTICK_WAIT_SLEEP_SYSTICK_ONLY == gl_ptr_st_systick_cfg->en_systick_wait)
+    {
+        // lower priority interrupts neither wake the core nor run until the wait ends
+        __set_BASEPRI(SYSTICK_WAIT_BASEPRI);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ * @brief                      : Waits for the next interrupt and lets it run
+ *
+ * @note                       : A pending interrupt wakes WFI even with PRIMASK set
+ */
+static void systick_wait_sleep(void)
+{
+    if(SYSTICK_WAIT_BUSY != gl_ptr_st_systick_cfg->en_systick_wait)
+    {
+        __DSB();
+        __WFI();
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    // take the pending interrupt(s), then mask again before the condition is re-checked
+    __enable_irq();
+    __disable_irq();
+}
+
+/**
+ * @brief                      : Restores the masking state saved by systick_wait_begin
+ */
+static void systick_wait_end(const st_systick_wait_ctx_t * ptr_st_a_wait_ctx)
+{
+    __set_BASEPRI(ptr_st_a_wait_ctx->u32_basepri);
+    __set_PRIMASK(ptr_st_a_wait_ctx->u32_primask);
+}
+
+/**
+ * @brief                      : Calls every subscriber of an event, bounded by SYSTICK_MAX_SUBSCRIBERS
+ *
+ * @param en_a_event             : Event that occurred
+ */
+static void systick_notify(en_systick_event_t en_a_event)
+{
+    for(uint8_t_ u8_idx = 0; u8_idx < SYSTICK_MAX_SUBSCRIBERS; u8_idx++)
+    {
+        fun_systick_subscriber_t fun_ptr_cb = gl_arr_st_systick_subscribers[u8_idx].fun_ptr_cb;
+
+        if(
+                (NULL_PTR != fun_ptr_cb) &&
+                (en_a_event == gl_arr_st_systick_subscribers[u8_idx].en_event)
+                )
+        {
+            fun_ptr_cb(gl_arr_st_systick_subscribers[u8_idx].ptr_v_ctx);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+}
+
+/**
+ * @brief                      : Restarts the stopped free running counter with one period ending exactly
+ *                               u32_a_ticks_to_wrap ticks after the point it was stopped at
+ *
+ * @param u32_a_current          : STCURRENT read right after stopping the counter
+ * @param u32_a_ticks_to_wrap    : Ticks from the stop point until the new period reaches 0
+ * @param u32_a_stop_cycles      : DWT cycle count sampled when the counter was stopped
+ * @param u32_a_next_ticks       : Length of the period queued behind the new one
+ *
+ * @note                       : Called with interrupts masked. Ticks lost while stopped are measured with
+ *                               the cycle counter and taken out of the reload, so the tick grid and the
+ *                               uptime are kept
+ */
+static void systick_idle_restart(uint32_t_ u32_a_current, uint32_t_ u32_a_ticks_to_wrap, uint32_t_ u32_a_stop_cycles,
+                                 uint32_t_ u32_a_next_ticks)
+{
+    // ticks elapsed while stopped (rounded up) + the tick taken to load the new period
+    uint32_t_ u32_lost_ticks = 1 +
+            ((((DWT->CYCCNT - u32_a_stop_cycles) + gl_u32_idle_restart_cycles) * gl_u32_ticks_per_us) +
+             (gl_u32_cpu_cycles_per_us - 1)) / gl_u32_cpu_cycles_per_us;
+    uint32_t_ u32_reload = u32_a_ticks_to_wrap - u32_lost_ticks;
+
+    // uptime at the instant the new period is loaded
+    gl_u64_uptime_ticks += (gl_u32_run_ticks - 1 - u32_a_current) + u32_lost_ticks;
+    gl_u32_run_ticks = u32_reload + 1;
+
+    STRELOAD = u32_reload;
+    STCURRENT = ZERO;
+    SET_BIT(STCTRL, STCTRL_ENABLE);
+
+    // STRELOAD is latched on reload, queue the next period once the new one is loaded
+    while(ZERO == STCURRENT);
+    STRELOAD = u32_a_next_ticks - 1;
+    gl_u32_next_run_ticks = u32_a_next_ticks;
+}
+
+/**
+ * @brief                      : Stops the free running counter for reprogramming
+ *
+ * @param ptr_u32_a_current      : Pointer to store STCURRENT at the stop point
+ * @param ptr_u32_a_stop_cycles  : Pointer to store the DWT cycle count at the stop point
+ *
+ * @note                       : Called with interrupts masked. The counter is left running when the period
+ *                               is about to end, so it is never stopped across a reload
+ *
+ * @return  TRUE               :   Counter stopped, caller must restart it with systick_idle_restart
+ *          FALSE              :   Tick pending or due within SYSTICK_IDLE_MIN_TICKS, counter untouched
+ */
+static boolean systick_idle_stop(uint32_t_ * ptr_u32_a_current, uint32_t_ * ptr_u32_a_stop_cycles)
+{
+    boolean bool_stopped = FALSE;
+
+    if(
+            (ZERO == (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)) &&
+            (STCURRENT >= SYSTICK_IDLE_MIN_TICKS)
+            )
+    {
+        *ptr_u32_a_stop_cycles = DWT->CYCCNT;
+        CLR_BIT(STCTRL, STCTRL_ENABLE);
+        *ptr_u32_a_current = STCURRENT;
+        bool_stopped = TRUE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return bool_stopped;
+}
+
+/**
+ * @brief                      : Measures gl_u32_idle_restart_cycles with the DWT cycle counter
+ *
+ * @note                       : Called from systick_init before the tick starts. The counter runs on the system
+ *                               clock source, a tick per core cycle, through SYSTICK_IDLE_CALIBRATION_PAIRS
+ *                               stop/restarts with no compensation. The uptime then falls behind the cycle counter
+ *                               by the uncovered cycles of every pair. The counter is left stopped on the
+ *                               configured clock source
+ */
+static void systick_idle_calibrate(void)
+{
+    uint32_t_ u32_primask = __get_PRIMASK();
+    uint32_t_ u32_ticks_per_us = gl_u32_ticks_per_us;
+    uint32_t_ u32_clk_src = GET_BIT(STCTRL, STCTRL_CLK_SRC);
+    uint32_t_ u32_start_cycles;
+    uint32_t_ u32_cycles;
+    uint64_t_ u64_start_ticks;
+    uint64_t_ u64_ticks;
+    uint32_t_ u32_current;
+    uint32_t_ u32_stop_cycles;
+
+    __disable_irq();
+
+    SET_BIT(STCTRL, STCTRL_CLK_SRC);
+    gl_u32_ticks_per_us = gl_u32_cpu_cycles_per_us;
+    gl_u32_idle_restart_cycles = 0;
+    gl_u32_run_ticks = STLOAD_PERIOD_TICKS;
+    gl_u32_next_run_ticks = STLOAD_PERIOD_TICKS;
+    gl_u64_uptime_ticks = 0;
+
+    STRELOAD = STLOAD_MAX_VALUE;
+    STCURRENT = ZERO;
+    SET_BIT(STCTRL, STCTRL_ENABLE);
+    while(ZERO == STCURRENT);
+
+    // both counters are sampled the same way at each end, the sampling cost cancels out
+    u32_start_cycles = DWT->CYCCNT;
+    u64_start_ticks = gl_u64_uptime_ticks + (gl_u32_run_ticks - 1 - STCURRENT);
+
+    for(uint8_t_ u8_pair = 0; u8_pair < SYSTICK_IDLE_CALIBRATION_PAIRS; u8_pair++)
+    {
+        // the period keeps its end, a full reload is far from it
+        if(TRUE == systick_idle_stop(&u32_current, &u32_stop_cycles))
+        {
+            systick_idle_restart(u32_current, u32_current, u32_stop_cycles, STLOAD_PERIOD_TICKS);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    u32_cycles = DWT->CYCCNT - u32_start_cycles;
+    u64_ticks = (gl_u64_uptime_ticks + (gl_u32_run_ticks - 1 - STCURRENT)) - u64_start_ticks;
+
+    gl_u32_idle_restart_cycles = (u32_cycles > u64_ticks) ?
+                                 (uint32_t_) (((u32_cycles - u64_ticks) + (SYSTICK_IDLE_CALIBRATION_PAIRS / 2)) /
+                                              SYSTICK_IDLE_CALIBRATION_PAIRS) : ZERO;
+
+    CLR_BIT(STCTRL, STCTRL_ENABLE);
+    WRITE_BIT(STCTRL, STCTRL_CLK_SRC, u32_clk_src);
+    gl_u32_ticks_per_us = u32_ticks_per_us;
+
+    __set_PRIMASK(u32_primask);
+}
+
+/**
+ * @brief                      : Changes the free running tick period, the running period is not touched
+ *
+ * @param u32_a_period_ticks     : New tick period in systick clock ticks
+ *
+ * @note                       : STRELOAD is latched on the next reload. If that reload already happened and
+ *                               the handler did not run yet, or the tail of a split period is queued, the change
+ *                               is left to the handler so the period it accounts for always matches the loaded one
+ */
+static void systick_retune(uint32_t_ u32_a_period_ticks)
+{
+    uint32_t_ u32_primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    if(
+            (ZERO == (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)) &&
+            (gl_u32_next_run_ticks == gl_u32_period_ticks)
+            )
+    {
+        STRELOAD = u32_a_period_ticks - 1;
+        gl_u32_period_ticks = u32_a_period_ticks;
+        gl_u32_next_run_ticks = u32_a_period_ticks;
+        gl_u32_retune_ticks = ZERO;
+    }
+    else
+    {
+        gl_u32_retune_ticks = u32_a_period_ticks;
+    }
+
+    __set_PRIMASK(u32_primask);
+}
+
+/**
+ * @brief                      : Splits the running free running period so a systick interrupt happens at a deadline
+ *
+ * @param u64_a_deadline         : Uptime (ticks) of the deadline
+ *
+ * @note                       : Called with interrupts masked (or from the handler). The head of the split ends
+ *                               at the deadline (SYSTICK_IDLE_MIN_TICKS from now at the earliest), the tail ends
+ *                               on the next tick of the grid, so ticks and uptime are kept.
+ *                               Nothing is done when the deadline is not inside the running period, a split is
+ *                               already queued, a tick is due within SYSTICK_IDLE_MIN_TICKS or the periodic
+ *                               callback owns the tick (every reload is a callback)
+ */
+static void systick_wake_at(uint64_t_ u64_a_deadline)
+{
+    uint32_t_ u32_current;
+    uint32_t_ u32_stop_cycles;
+
+    if(
+            (FALSE == gl_bool_periodic_active) &&
+            (FALSE == gl_bool_split_head) &&
+            (gl_u32_next_run_ticks == gl_u32_period_ticks) &&
+            (u64_a_deadline < (gl_u64_uptime_ticks + gl_u32_run_ticks)) &&
+            (TRUE == systick_idle_stop(&u32_current, &u32_stop_cycles))
+            )
+    {
+        // the new period ends (ticks_to_wrap + 1) ticks after the stop point
+        uint64_t_ u64_stop_ticks = gl_u64_uptime_ticks + (gl_u32_run_ticks - 1 - u32_current);
+        uint32_t_ u32_head_ticks = (u64_a_deadline > (u64_stop_ticks + 1 + SYSTICK_IDLE_MIN_TICKS)) ?
+                                   (uint32_t_) (u64_a_deadline - u64_stop_ticks - 1) : SYSTICK_IDLE_MIN_TICKS;
+        uint32_t_ u32_tail_ticks;
+
+        u32_head_ticks = (u32_head_ticks > u32_current) ? u32_current : u32_head_ticks;
+
+        // rest of the running period, up to the next grid tick (long tickless periods included)
+        u32_tail_ticks = (u32_current - u32_head_ticks) % gl_u32_period_ticks;
+        while(u32_tail_ticks < SYSTICK_IDLE_MIN_TICKS)
+        {
+            u32_tail_ticks += gl_u32_period_ticks;
+        }
+
+        systick_idle_restart(u32_current, u32_head_ticks, u32_stop_cycles, u32_tail_ticks);
+        gl_bool_split_head = TRUE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ * @brief                      : Calls the periodic callback and accounts for the periods it overran
+ *
+ * @param u32_a_entry_cycles     : DWT cycle count at handler entry
+ * @param u32_a_entry_current    : STCURRENT at handler entry
+ * @param u32_a_run_ticks        : Length of the period running at handler entry (later ones are normal periods)
+ *
+ * @note                       : Called from the handler after the period that fired was accounted for.
+ *                               Only one reload can pend, so the periods ended while the callback ran are
+ *                               counted from its duration (cycle counter), rounded against the live counter
+ *
+ * @return                     : Number of periods that ended with no handler run (folded in the pending one)
+ */
+static uint32_t_ systick_periodic_run(uint32_t_ u32_a_entry_cycles, uint32_t_ u32_a_entry_current,
+                                      uint32_t_ u32_a_run_ticks)
+{
+    uint32_t_ u32_missed_ticks = 0;
+    uint32_t_ u32_current;
+    uint32_t_ u32_period_ticks = gl_u32_period_ticks;
+
+    gl_fun_ptr_periodic_cb(gl_ptr_v_periodic_ctx);
+
+    // counter is read before the pending flag, a reload in between is seen as pending
+    u32_current = STCURRENT;
+
+    if(SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+    {
+        // ticks from the start of the period the handler runs in to now, and known ticks before the last reload
+        uint64_t_ u64_elapsed_ticks = (u32_a_run_ticks - 1 - u32_a_entry_current) +
+                (((uint64_t_) (DWT->CYCCNT - u32_a_entry_cycles) * gl_u32_ticks_per_us) / gl_u32_cpu_cycles_per_us);
+        uint64_t_ u64_known_ticks = (uint64_t_) u32_a_run_ticks + (u32_period_ticks - 1 - u32_current);
+        uint32_t_ u32_reloads = 1;
+
+        if(u64_elapsed_ticks > u64_known_ticks)
+        {
+            // nearest whole number of extra periods, the cycle estimate is only off by a few ticks
+            u32_reloads += (uint32_t_) (((u64_elapsed_ticks - u64_known_ticks) + (u32_period_ticks / 2)) /
+                                        u32_period_ticks);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        u32_missed_ticks = u32_reloads - 1;
+        gl_u32_periodic_overruns++;
+        gl_u32_periodic_missed_ticks += u32_missed_ticks;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return u32_missed_ticks;
+}
+
+/**
+ * @brief                      : Blocks for a number of systick clock ticks
+ *
+ * @param u64_a_ticks            : Delay length in systick clock ticks
+ */
+static void systick_ticks_delay(uint64_t_ u64_a_ticks)
+{
+    st_systick_wait_ctx_t st_wait_ctx;
+
+    if(SYSTICK_MODE_FREE_RUNNING == gl_ptr_st_systick_cfg->en_systick_mode)
+    {
+        // timer is shared, wait on the uptime (woken every tick, the last period is split at the deadline)
+        uint64_t_ u64_now = systick_now_ticks();
+        uint64_t_ u64_deadline = u64_now + u64_a_ticks;
+
+        systick_wait_begin(&st_wait_ctx);
+        while(u64_now < u64_deadline)
+        {
+            // end the running period at the deadline once it falls inside it (short remainders are polled)
+            if((u64_deadline - u64_now) > (2 * SYSTICK_IDLE_MIN_TICKS))
+            {
+                systick_wake_at(u64_deadline);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            // sleep only while the next systick interrupt (the wake-up) comes before the deadline,
+            // a remainder that could not be split is busy-polled so the delay does not overshoot to the next tick
+            if((u64_deadline - u64_now) > STCURRENT)
+            {
+                systick_wait_sleep();
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            u64_now = systick_now_ticks();
+        }
+        systick_wait_end(&st_wait_ctx);
+    }
+    else
+    {
+        // run the reload chain, the interrupt handler clears the busy flag on the last period
+        systick_oneshot_start(u64_a_ticks, FALSE);
+
+        systick_wait_begin(&st_wait_ctx);
+        while(TRUE == gl_bool_oneshot_busy)
+        {
+            systick_wait_sleep();
+        }
+        systick_wait_end(&st_wait_ctx);
+    }
+}
+
+/**
+ * @brief                      : Arms the async delay for a number of systick clock ticks
+ *
+ * @param u64_a_ticks            : Delay length in systick clock ticks
+ */
+static void systick_async_ticks_delay(uint64_t_ u64_a_ticks)
+{
+    if(SYSTICK_MODE_FREE_RUNNING == gl_ptr_st_systick_cfg->en_systick_mode)
+    {
+        // checked by the handler on every reload, the period the deadline falls in is split at the deadline
+        uint32_t_ u32_primask = __get_PRIMASK();
+        __disable_irq();
+
+        gl_u64_async_deadline = systick_now_ticks() + u64_a_ticks;
+        gl_bool_async_pending = TRUE;
+        systick_wake_at(gl_u64_async_deadline);
+
+        __set_PRIMASK(u32_primask);
+    }
+    else
+    {
+        // run the reload chain, interrupt handler calls back when done
+        systick_oneshot_start(u64_a_ticks, TRUE);
+    }
+}
+
+/**
+ * @brief                      : Initializes SYSTICK driver
+ *
+ * @param ptr_a_st_systick_cfg   : Pointer to Systick Configuration
+ *
+ * @return  ST_OK              :   In case of Successful Operation
+ *          ST_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ *          ST_INVALID_CONFIG  :   In case of Failed Operation (Invalid Systick Config Given)
+ */
+en_systick_error_t systick_init(st_systick_cfg_t * ptr_a_st_systick_cfg)
+{
+    en_systick_error_t en_systick_error_retval = ST_OK;
+
+    // args/cfg check
+    if(NULL_PTR == ptr_a_st_systick_cfg)
+    {
+        en_systick_error_retval = ST_INVALID_ARGS;
+    }
+    else
+    {
+        // cfg check
+        if(
+//                (ptr_a_st_systick_cfg->bool_systick_int_enabled > TRUE) ||
+                (ptr_a_st_systick_cfg->en_systick_clk_src >= CLK_SRC_TOTAL) ||
+                (ptr_a_st_systick_cfg->en_systick_mode >= SYSTICK_MODE_TOTAL) ||
+                (ptr_a_st_systick_cfg->en_systick_wait >= SYSTICK_WAIT_TOTAL)
+                )
+        {
+            en_systick_error_retval = ST_INVALID_CONFIG;
+        }
+        else
+        {
+            if(TRUE == gl_systick_initialized)
+            {
+                // systick already initialized before
+                /* Skip */
+            }
+            else
+            {
+                // set clock source
+                WRITE_BIT(STCTRL, STCTRL_CLK_SRC, ptr_a_st_systick_cfg->en_systick_clk_src);
+
+                NVIC_SetPriority(SysTick_IRQn, SYSTICK_IRQ_PRIORITY);
+
+                // precompute ticks per time unit for the selected clock source (system clock: as configured)
+                SystemCoreClockUpdate();
+                gl_u32_cpu_cycles_per_us = SystemCoreClock / SYSTICK_HZ_PER_MHZ;
+                gl_u32_ticks_per_us = (CLK_SRC_PIOSC == ptr_a_st_systick_cfg->en_systick_clk_src) ?
+                                      PIOSC_TICKS_PER_US : gl_u32_cpu_cycles_per_us;
+                gl_u32_ticks_per_ms = gl_u32_ticks_per_us * 1000;
+
+                if(SYSTICK_MODE_FREE_RUNNING == ptr_a_st_systick_cfg->en_systick_mode)
+                {
+                    // measure the tickless restart loss on the cycle counter
+                    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+                    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+                    systick_idle_calibrate();
+
+                    // start periodic tick, uptime counts from here
+                    gl_u32_period_ticks = SYSTICK_TICK_PERIOD_US * gl_u32_ticks_per_us;
+                    gl_u32_run_ticks = gl_u32_period_ticks;
+                    gl_u32_next_run_ticks = gl_u32_period_ticks;
+                    gl_u64_uptime_ticks = 0;
+
+                    STRELOAD = gl_u32_period_ticks - 1;
+                    STCURRENT = ZERO;
+                    SET_BIT(STCTRL, STCTRL_INT_ENABLE);
+                    SET_BIT(STCTRL, STCTRL_ENABLE);
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+
+                // update globals
+                gl_ptr_st_systick_cfg = ptr_a_st_systick_cfg;
+                gl_systick_initialized = TRUE;
+
+                // calibrate short us delays: time a 1 us busy wait with no compensation
+                {
+                    uint32_t_ u32_start_cycles;
+                    uint32_t_ u32_cycles;
+
+                    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+                    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+                    gl_u32_us_delay_overhead_cycles = 0;
+                    u32_start_cycles = DWT->CYCCNT;
+                    systick_us_delay(1);
+                    u32_cycles = DWT->CYCCNT - u32_start_cycles;
+
+                    gl_u32_us_delay_overhead_cycles = (u32_cycles > gl_u32_cpu_cycles_per_us) ?
+                                                      (u32_cycles - gl_u32_cpu_cycles_per_us) : ZERO;
+                }
+            }
+        }
+    }
+
+    return en_systick_error_retval;
+}
+
+/**
+ * @brief                      : Initiates a sync blocking delay
+ *
+ * @param uint32_a_ms_delay      : Desired delay in ms
+ * @note                       : Will cancel any async delays
+ *
+ * @return  ST_OK              :   In case of Successful Operation
+ *          ST_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ *          ST_INVALID_CONFIG  :   In case of Failed Operation (Invalid Systick Config Given)
+ */
+en_systick_error_t systick_ms_delay(uint32_t_ uint32_a_ms_delay)
+{
+    en_systick_error_t en_systick_error_retval = ST_OK;
+
+    if(
+            (FALSE == gl_systick_initialized) ||
+            (NULL_PTR == gl_ptr_st_systick_cfg)
+            )
+    {
+        en_systick_error_retval = ST_INVALID_CONFIG;
+    }
+    else
+    {
+        uint64_t_ u64_ticks = 0;
+
+        // a. calculate number of clock ticks for desired delay
+        en_systick_error_retval = systick_ms_to_ticks(uint32_a_ms_delay, &u64_ticks);
+
+        if(ST_OK == en_systick_error_retval)
+        {
+            // b. wait
+            systick_ticks_delay(u64_ticks);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    return en_systick_error_retval;
+}
+
+
+/**
+ * @brief                      : Initiates a sync blocking delay
+ *
+ * @param uint32_a_ms_delay      : Desired delay in ms
+ * @note                       : Will be cancelled if any sync/blocking delay was requested
+ *
+ * @return  ST_OK              :   In case of Successful Operation
+ *          ST_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ *          ST_INVALID_CONFIG  :   In case of Failed Operation (Invalid Systick Config Given)
+ */
+en_systick_error_t systick_async_ms_delay(uint32_t_ uint32_a_ms_delay)
+{
+    en_systick_error_t en_systick_error_retval = ST_OK;
+
+    if(
+            (FALSE == gl_systick_initialized) ||
+            (NULL_PTR == gl_ptr_st_systick_cfg)
+            )
+    {
+        en_systick_error_retval = ST_INVALID_CONFIG;
+    }
+    else
+    {
+        uint64_t_ u64_ticks = 0;
+
+        // a. calculate number of clock ticks for desired delay
+        en_systick_error_retval = systick_ms_to_ticks(uint32_a_ms_delay, &u64_ticks);
+
+        if(ST_OK == en_systick_error_retval)
+        {
+            // b. arm, the interrupt handler calls back when done
+            systick_async_ticks_delay(u64_ticks);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    return en_systick_error_retval;
+}
+
+/**
+ * @brief                      : Initiates a sync blocking delay in us
+ *
+ * @param u32_a_us_delay         : Desired delay in us
+ * @note                       : Up to SYSTICK_US_BUSY_WAIT_MAX: compensated cycle counted busy wait,
+ *                               longer: interrupt driven wait ending at the deadline (see systick_ticks_delay)
+ *
+ * @return  ST_OK              :   In case of Successful Operation
+ *          ST_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ *          ST_INVALID_CONFIG  :   In case of Failed Operation (Invalid Systick Config Given)
+ */
+en_systick_error_t systick_us_delay(uint32_t_ u32_a_us_delay)
+{
+    // sampled first, everything below is inside the compensated window
+    uint32_t_ u32_start_cycles = DWT->CYCCNT;
+    en_systick_error_t en_systick_error_retval = ST_OK;
+
+    if(
+            (FALSE == gl_systick_initialized) ||
+            (NULL_PTR == gl_ptr_st_systick_cfg)
+            )
+    {
+        en_systick_error_retval = ST_INVALID_CONFIG;
+    }
+    else if(ZERO == u32_a_us_delay)
+    {
+        en_systick_error_retval = ST_INVALID_ARGS;
+    }
+    else if(u32_a_us_delay <= SYSTICK_US_BUSY_WAIT_MAX)
+    {
+        // short wait: core cycles, independent of the systick clock source
+        uint32_t_ u32_cycles = u32_a_us_delay * gl_u32_cpu_cycles_per_us;
+
+        u32_cycles = (u32_cycles > gl_u32_us_delay_overhead_cycles) ?
+                     (u32_cycles - gl_u32_us_delay_overhead_cycles) : ZERO;
+
+        while((DWT->CYCCNT - u32_start_cycles) < u32_cycles);
+    }
+    else
+    {
+        systick_ticks_delay((uint64_t_) u32_a_us_delay * gl_u32_ticks_per_us);
+    }
+
+    return en_systick_error_retval;
+}
+
+/**
+ * @brief                      : Initiates an async delay in us
+ *
+ * @param u32_a_us_delay         : Desired delay in us
+ * @note                       : SYSTICK_EVENT_DELAY_DONE subscribers are notified when done
+ *
+ * @return  ST_OK              :   In case of Successful Operation
+ *          ST_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ *          ST_INVALID_CONFIG  :   In case of Failed Operation (Invalid Systick Config Given)
+ */
+en_systick_error_t systick_async_us_delay(uint32_t_ u32_a_us_delay)
+{
+    en_systick_error_t en_systick_error_retval = ST_OK;
+
+    if(
+            (FALSE == gl_systick_initialized) ||
+            (NULL_PTR == gl_ptr_st_systick_cfg)
+            )
+    {
+        en_systick_error_retval = ST_INVALID_CONFIG;
+    }
+    else if(ZERO == u32_a_us_delay)
+    {
+        en_systick_error_retval = ST_INVALID_ARGS;
+    }
+    else
+    {
+        systick_async_ticks_delay((uint64_t_) u32_a_us_delay * gl_u32_ticks_per_us);
+    }
+
+    return en_systick_error_retval;
+}
+
 /**
- * @brief                      : Initializes SYSTICK driver
+ * @brief                      : Adds a subscriber to a systick event
  *
- * @param ptr_a_st_systick_cfg   : Pointer to Systick Configuration
+ * @param en_a_event             : Event to subscribe to
+ * @param fun_ptr_a_cb           : Pointer to subscriber fn
+ * @param ptr_v_a_ctx            : Context pointer passed back to the subscriber
+ * @note                       : The table is updated with interrupts masked, the handler never sees a half
+ *                               written entry
  *
- * @return  ST_OK              :   In case of Successful Operation
+ * @return  ST_OK              :   In case of Successful Operation (or already subscribed)
  *          ST_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
- *          ST_INVALID_CONFIG  :   In case of Failed Operation (Invalid Systick Config Given)
+ *          ST_INVALID_CONFIG  :   In case of Failed Operation (Tick event without free running mode)
+ *          ST_SUBSCRIBERS_FULL:   In case all SYSTICK_MAX_SUBSCRIBERS entries are in use
  */
-en_systick_error_t systick_init(st_systick_cfg_t * ptr_a_st_systick_cfg)
+en_systick_error_t systick_subscribe(en_systick_event_t en_a_event, fun_systick_subscriber_t fun_ptr_a_cb,
+                                     void * ptr_v_a_ctx)
 {
-    en_systick_error_t en_systick_error_retval = ST_OK;
+    en_systick_error_t en_systick_error_retval = ST_SUBSCRIBERS_FULL;
 
-    // args/cfg check
-    if(NULL_PTR == ptr_a_st_systick_cfg)
+    if(
+            (en_a_event >= SYSTICK_EVENT_TOTAL) ||
+            (NULL_PTR == fun_ptr_a_cb)
+            )
     {
         en_systick_error_retval = ST_INVALID_ARGS;
     }
+    else if(
+            (SYSTICK_EVENT_TICK == en_a_event) &&
+            (
+                    (FALSE == gl_systick_initialized) ||
+                    (SYSTICK_MODE_FREE_RUNNING != gl_ptr_st_systick_cfg->en_systick_mode)
+            )
+            )
+    {
+        // ticks only exist in free running mode
+        en_systick_error_retval = ST_INVALID_CONFIG;
+    }
     else
     {
-        // cfg check
-        if(
-//                (ptr_a_st_systick_cfg->bool_systick_int_enabled > TRUE) ||
-                (ptr_a_st_systick_cfg->en_systick_clk_src >= CLK_SRC_TOTAL)
-                )
-        {
-            en_systick_error_retval = ST_INVALID_CONFIG;
-        }
-        else
+        st_systick_subscriber_t * ptr_st_free = NULL_PTR;
+        uint32_t_ u32_primask = __get_PRIMASK();
+        __disable_irq();
+
+        for(uint8_t_ u8_idx = 0; u8_idx < SYSTICK_MAX_SUBSCRIBERS; u8_idx++)
         {
-            if(TRUE == gl_systick_initialized)
+            st_systick_subscriber_t * ptr_st_subscriber = &gl_arr_st_systick_subscribers[u8_idx];
+
+            if(
+                    (fun_ptr_a_cb == ptr_st_subscriber->fun_ptr_cb) &&
+                    (ptr_v_a_ctx == ptr_st_subscriber->ptr_v_ctx) &&
+                    (en_a_event == ptr_st_subscriber->en_event)
+                    )
             {
-                // systick already initialized before
-                /* Skip */
+                // already subscribed
+                ptr_st_free = NULL_PTR;
+                en_systick_error_retval = ST_OK;
+                break;
+            }
+            else if(
+                    (NULL_PTR == ptr_st_free) &&
+                    (NULL_PTR == ptr_st_subscriber->fun_ptr_cb)
+                    )
+            {
+                ptr_st_free = ptr_st_subscriber;
             }
             else
             {
-                // set clock source
-                WRITE_BIT(STCTRL, STCTRL_CLK_SRC, ptr_a_st_systick_cfg->en_systick_clk_src);
-
-                // update globals
-                gl_ptr_st_systick_cfg = ptr_a_st_systick_cfg;
-                gl_systick_initialized = TRUE;
+                /* Do Nothing */
             }
         }
+
+        if(NULL_PTR != ptr_st_free)
+        {
+            ptr_st_free->ptr_v_ctx = ptr_v_a_ctx;
+            ptr_st_free->en_event = en_a_event;
+            ptr_st_free->fun_ptr_cb = fun_ptr_a_cb;
+            en_systick_error_retval = ST_OK;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        __set_PRIMASK(u32_primask);
     }
 
     return en_systick_error_retval;
 }
 
 /**
- * @brief                      : Initiates a sync blocking delay
+ * @brief                      : Removes a subscriber from a systick event
  *
- * @param uint32_a_ms_delay      : Desired delay in ms
- * @note                       : Will cancel any async delays
+ * @param en_a_event             : Subscribed event
+ * @param fun_ptr_a_cb           : Pointer to subscriber fn
+ * @param ptr_v_a_ctx            : Subscribed context pointer
  *
  * @return  ST_OK              :   In case of Successful Operation
- *          ST_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
- *          ST_INVALID_CONFIG  :   In case of Failed Operation (Invalid Systick Config Given)
+ *          ST_INVALID_ARGS    :   In case of Failed Operation (No such subscriber)
  */
-en_systick_error_t systick_ms_delay(uint32_t_ uint32_a_ms_delay)
+en_systick_error_t systick_unsubscribe(en_systick_event_t en_a_event, fun_systick_subscriber_t fun_ptr_a_cb,
+                                       void * ptr_v_a_ctx)
+{
+    en_systick_error_t en_systick_error_retval = ST_INVALID_ARGS;
+
+    for(uint8_t_ u8_idx = 0; u8_idx < SYSTICK_MAX_SUBSCRIBERS; u8_idx++)
+    {
+        st_systick_subscriber_t * ptr_st_subscriber = &gl_arr_st_systick_subscribers[u8_idx];
+
+        if(
+                (NULL_PTR != fun_ptr_a_cb) &&
+                (fun_ptr_a_cb == ptr_st_subscriber->fun_ptr_cb) &&
+                (ptr_v_a_ctx == ptr_st_subscriber->ptr_v_ctx) &&
+                (en_a_event == ptr_st_subscriber->en_event)
+                )
+        {
+            // single store, safe against the handler walking the table
+            ptr_st_subscriber->fun_ptr_cb = NULL_PTR;
+            en_systick_error_retval = ST_OK;
+            break;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    return en_systick_error_retval;
+}
+
+/**
+ * @brief                      : Sleeps until a deadline or any interrupt, skipping the ticks in between
+ *
+ * @param u64_a_wake_ms          : Uptime (ms) to wake up at
+ * @note                       : Stretches the running period up to the grid tick at/after the deadline
+ *                               (or a pending async delay), cuts it back to the grid on an early wake-up
+ *
+ * @return  ST_OK              :   In case of Successful Operation
+ *          ST_INVALID_CONFIG  :   In case of Failed Operation (Systick not initialized in free running mode)
+ */
+en_systick_error_t systick_tickless_idle(uint64_t_ u64_a_wake_ms)
 {
     en_systick_error_t en_systick_error_retval = ST_OK;
 
     if(
             (FALSE == gl_systick_initialized) ||
-            (NULL_PTR == gl_ptr_st_systick_cfg)
+            (SYSTICK_MODE_FREE_RUNNING != gl_ptr_st_systick_cfg->en_systick_mode)
             )
     {
         en_systick_error_retval = ST_INVALID_CONFIG;
     }
     else
     {
-        // disable interrupt mode
-        // enable interrupt
-        CLR_BIT(STCTRL, STCTRL_INT_ENABLE);
+        st_systick_wait_ctx_t st_wait_ctx;
+        uint32_t_ u32_current;
+        uint32_t_ u32_stop_cycles;
+        uint32_t_ u32_extra_periods = 0;
+
+        systick_wait_begin(&st_wait_ctx);
 
-        // a. calculate number of clock cycles for desired delay
-        float fl_ms_per_cycle = 0.0f;
-        uint32_t_ fl_no_of_cycles_req = 0;
-        if(CLK_SRC_PIOSC == gl_ptr_st_systick_cfg->en_systick_clk_src)
+        u32_current = STCURRENT;
+
+        if(
+                (ZERO == (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)) &&
+                (FALSE == gl_bool_periodic_active) &&
+                (FALSE == gl_bool_split_head) &&
+                (gl_u32_next_run_ticks == gl_u32_period_ticks)
+                )
         {
-            fl_ms_per_cycle = 1000.0f/((float)((PIOSC_MHZ/4.0f) * 1000000.0f)); // PIOSC / 4
-            fl_no_of_cycles_req = ((float)uint32_a_ms_delay / fl_ms_per_cycle) + 1;
+            uint64_t_ u64_now_ticks = gl_u64_uptime_ticks + (gl_u32_run_ticks - 1 - u32_current);
+            uint64_t_ u64_wake_ticks;
+
+            // a pending async delay is a wake-up source as well
+            if(
+                    (TRUE == gl_bool_async_pending) &&
+                    ((gl_u64_async_deadline / gl_u32_ticks_per_ms) < u64_a_wake_ms)
+                    )
+            {
+                u64_a_wake_ms = gl_u64_async_deadline / gl_u32_ticks_per_ms;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            // saturate far deadlines before converting to ticks (compared in ms), one reload caps the sleep anyway
+            u64_wake_ticks = (u64_a_wake_ms > ((u64_now_ticks / gl_u32_ticks_per_ms) +
+                                               (STLOAD_PERIOD_TICKS / gl_u32_ticks_per_ms))) ?
+                             (u64_now_ticks + STLOAD_PERIOD_TICKS) :
+                             (u64_a_wake_ms * gl_u32_ticks_per_ms);
+
+            // whole periods to skip after the running one, so the long period ends on the tick grid
+            if(u64_wake_ticks > (u64_now_ticks + u32_current + 1))
+            {
+                uint32_t_ u32_max_periods = (STLOAD_MAX_VALUE - u32_current) / gl_u32_period_ticks;
+                uint64_t_ u64_periods = ((u64_wake_ticks - (u64_now_ticks + u32_current + 1)) +
+                                         (gl_u32_period_ticks - 1)) / gl_u32_period_ticks;
+
+                u32_extra_periods = (u64_periods > u32_max_periods) ? u32_max_periods : (uint32_t_) u64_periods;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
         }
-        else if(CLK_SRC_SYS_CLK == gl_ptr_st_systick_cfg->en_systick_clk_src)
+        else
         {
-            fl_ms_per_cycle = 1000.0f/((float)(SYS_CLOCK_MHZ * 1000000.0f));
-            fl_no_of_cycles_req = ((float)uint32_a_ms_delay / fl_ms_per_cycle) + 1;
+            // tick pending, let the handler run first (periodic callback: every tick is needed, split: wake-up queued)
+            /* Do Nothing */
         }
 
-        // args check
         if(
-                (fl_no_of_cycles_req > STLOAD_MAX_VALUE) ||
-                (fl_no_of_cycles_req < STLOAD_MIN_VALUE)
+                (ZERO != u32_extra_periods) &&
+                (TRUE == systick_idle_stop(&u32_current, &u32_stop_cycles))
                 )
         {
-            en_systick_error_retval = ST_INVALID_ARGS;
-        }
+            systick_idle_restart(u32_current,
+                                 u32_current + (u32_extra_periods * gl_u32_period_ticks),
+                                 u32_stop_cycles, gl_u32_period_ticks);
+
+            // sleep until the long period ends or any other interrupt
+            systick_wait_sleep();
 
-        // 1. Program the value in the STRELOAD Register
-        /* todo Software should not rely on the value of a reserved bit. To provide
-           todo compatibility with future products, the value of a reserved bit should be
-           todo preserved across a read-modify-write operation. */
-        STRELOAD = fl_no_of_cycles_req;
+            // woken early, cut the long period back to the next grid tick so normal ticking resumes
+            // (a split armed by the waking interrupt already ends on the grid)
+            if(
+                    (gl_u32_run_ticks != gl_u32_period_ticks) &&
+                    (FALSE == gl_bool_split_head) &&
+                    (gl_u32_next_run_ticks == gl_u32_period_ticks) &&
+                    (TRUE == systick_idle_stop(&u32_current, &u32_stop_cycles))
+                    )
+            {
+                uint32_t_ u32_ticks_to_wrap = u32_current % gl_u32_period_ticks;
+
+                while(u32_ticks_to_wrap < SYSTICK_IDLE_MIN_TICKS)
+                {
+                    u32_ticks_to_wrap += gl_u32_period_ticks;
+                }
 
-        // 2. Clear STCURRENT register by writing any value (preferably a zero)
-        STCURRENT = ZERO;
+                systick_idle_restart(u32_current, u32_ticks_to_wrap, u32_stop_cycles, gl_u32_period_ticks);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else
+        {
+            // next tick is due first (or already pending), plain sleep
+            systick_wait_sleep();
+        }
 
-        // 3. Configure the STCTRL register for the required operation
-        SET_BIT(STCTRL, STCTRL_ENABLE); // start timer
-        while (GET_BIT(STCTRL, STCTRL_COUNT) == 0);
-        CLR_BIT(STCTRL, STCTRL_ENABLE); // stop timer
+        systick_wait_end(&st_wait_ctx);
     }
 
     return en_systick_error_retval;
 }
 
-
 /**
- * @brief                      : Initiates a sync blocking delay
+ * @brief                      : Starts calling a callback on every auto-reload of the timer
  *
- * @param uint32_a_ms_delay      : Desired delay in ms
- * @note                       : Will be cancelled if any sync/blocking delay was requested
+ * @param u32_a_period_us        : Callback period in us
+ * @param fun_ptr_a_cb           : Pointer to the periodic callback
+ * @param ptr_v_a_ctx            : Context pointer passed back to the callback
+ * @note                       : Free running mode retunes the tick, one shot mode takes over the timer
  *
  * @return  ST_OK              :   In case of Successful Operation
- *          ST_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
- *          ST_INVALID_CONFIG  :   In case of Failed Operation (Invalid Systick Config Given)
+ *          ST_INVALID_ARGS    :   In case of Failed Operation (NULL callback or period out of range)
+ *          ST_INVALID_CONFIG  :   In case of Failed Operation (Systick not initialized)
  */
-en_systick_error_t systick_async_ms_delay(uint32_t_ uint32_a_ms_delay)
+en_systick_error_t systick_start_periodic(uint32_t_ u32_a_period_us, fun_systick_subscriber_t fun_ptr_a_cb,
+                                          void * ptr_v_a_ctx)
 {
     en_systick_error_t en_systick_error_retval = ST_OK;
+    uint64_t_ u64_period_ticks = (uint64_t_) u32_a_period_us * gl_u32_ticks_per_us;
 
     if(
             (FALSE == gl_systick_initialized) ||
@@ -155,56 +1187,65 @@ en_systick_error_t systick_async_ms_delay(uint32_t_ uint32_a_ms_delay)
     {
         en_systick_error_retval = ST_INVALID_CONFIG;
     }
+    else if(
+            (NULL_PTR == fun_ptr_a_cb) ||
+            (u64_period_ticks < SYSTICK_PERIODIC_MIN_TICKS) ||
+            (u64_period_ticks > STLOAD_PERIOD_TICKS)
+            )
+    {
+        en_systick_error_retval = ST_INVALID_ARGS;
+    }
     else
     {
-        // enable interrupt
-        SET_BIT(STCTRL, STCTRL_INT_ENABLE);
+        uint32_t_ u32_primask = __get_PRIMASK();
+        __disable_irq();
+
+        gl_bool_periodic_active = FALSE;
+        gl_fun_ptr_periodic_cb = fun_ptr_a_cb;
+        gl_ptr_v_periodic_ctx = ptr_v_a_ctx;
+        gl_u32_periodic_overruns = 0;
+        gl_u32_periodic_missed_ticks = 0;
 
-        // a. calculate number of clock cycles for desired delay
-        float fl_ms_per_cycle = 0.0f;
-        uint32_t_ fl_no_of_cycles_req = 0;
-        if(CLK_SRC_PIOSC == gl_ptr_st_systick_cfg->en_systick_clk_src)
+        if(SYSTICK_MODE_FREE_RUNNING == gl_ptr_st_systick_cfg->en_systick_mode)
         {
-            fl_ms_per_cycle = 1000.0f/((float)((PIOSC_MHZ/4.0f) * 1000000)); // PIOSC / 4
-            fl_no_of_cycles_req = ((float)uint32_a_ms_delay / fl_ms_per_cycle) + 1;
+            // the callback runs on every tick, first call when the running period ends
+            systick_retune((uint32_t_) u64_period_ticks);
         }
-        else if(CLK_SRC_SYS_CLK == gl_ptr_st_systick_cfg->en_systick_clk_src)
+        else
         {
-            fl_ms_per_cycle = 1000.0f/((float)(SYS_CLOCK_MHZ * 1000000.0f));
-            fl_no_of_cycles_req = ((float)uint32_a_ms_delay / fl_ms_per_cycle) + 1;
-        }
+            // cancel any running delay (a blocked sync delay returns) and take over the timer
+            CLR_BIT(STCTRL, STCTRL_ENABLE);
+            SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+            gl_u32_oneshot_segments = 0;
+            gl_bool_oneshot_busy = FALSE;
 
-        // args check
-        if(
-                (fl_no_of_cycles_req > STLOAD_MAX_VALUE) ||
-                (fl_no_of_cycles_req < STLOAD_MIN_VALUE)
-                )
-        {
-            en_systick_error_retval = ST_INVALID_ARGS;
+            gl_u32_period_ticks = (uint32_t_) u64_period_ticks;
+            STRELOAD = gl_u32_period_ticks - 1;
+            STCURRENT = ZERO;
+            SET_BIT(STCTRL, STCTRL_INT_ENABLE);
+            SET_BIT(STCTRL, STCTRL_ENABLE);
         }
 
-        // 1. Program the value in the STRELOAD Register
-        /* todo Software should not rely on the value of a reserved bit. To provide
-           todo compatibility with future products, the value of a reserved bit should be
-           todo preserved across a read-modify-write operation. */
-        STRELOAD = fl_no_of_cycles_req;
-
-        // 2. Clear STCURRENT register by writing any value (preferably a zero)
-        STCURRENT = ZERO;
+        gl_bool_periodic_active = TRUE;
 
-        // 3. Configure the STCTRL register for the required operation
-        SET_BIT(STCTRL, STCTRL_ENABLE); // start timer
-        // interrupt handler will fire when done
+        __set_PRIMASK(u32_primask);
     }
 
     return en_systick_error_retval;
 }
 
-en_systick_error_t systick_set_callback(fun_systick_callback_t fun_ptr_a_systick_cb)
+/**
+ * @brief                      : Stops the periodic callback
+ *
+ * @note                       : Free running mode restores the SYSTICK_TICK_PERIOD_US tick
+ *
+ * @return  ST_OK              :   In case of Successful Operation
+ *          ST_INVALID_CONFIG  :   In case of Failed Operation (Systick not initialized)
+ */
+en_systick_error_t systick_stop_periodic(void)
 {
     en_systick_error_t en_systick_error_retval = ST_OK;
 
-    // config check
     if(
             (FALSE == gl_systick_initialized) ||
             (NULL_PTR == gl_ptr_st_systick_cfg)
@@ -212,36 +1253,253 @@ en_systick_error_t systick_set_callback(fun_systick_callback_t fun_ptr_a_systick
     {
         en_systick_error_retval = ST_INVALID_CONFIG;
     }
-    else if(NULL_PTR == fun_ptr_a_systick_cb)
+    else
+    {
+        uint32_t_ u32_primask = __get_PRIMASK();
+        __disable_irq();
+
+        if(TRUE == gl_bool_periodic_active)
+        {
+            gl_bool_periodic_active = FALSE;
+
+            if(SYSTICK_MODE_FREE_RUNNING == gl_ptr_st_systick_cfg->en_systick_mode)
+            {
+                // back to the default tick
+                systick_retune(SYSTICK_TICK_PERIOD_US * gl_u32_ticks_per_us);
+            }
+            else
+            {
+                CLR_BIT(STCTRL, STCTRL_ENABLE);
+                SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+            }
+        }
+        else
+        {
+            // not running (or already cancelled by a one shot delay)
+            /* Do Nothing */
+        }
+
+        __set_PRIMASK(u32_primask);
+    }
+
+    return en_systick_error_retval;
+}
+
+/**
+ * @brief                      : Gets the periodic callback overrun and missed tick counters
+ *
+ * @param ptr_st_a_stats         : Pointer to store the counters
+ *
+ * @return  ST_OK              :   In case of Successful Operation
+ *          ST_INVALID_ARGS    :   In case of Failed Operation (Invalid Arguments Given)
+ */
+en_systick_error_t systick_get_periodic_stats(st_systick_periodic_stats_t * ptr_st_a_stats)
+{
+    en_systick_error_t en_systick_error_retval = ST_OK;
+
+    if(NULL_PTR == ptr_st_a_stats)
     {
-        // invalid arg
         en_systick_error_retval = ST_INVALID_ARGS;
     }
     else
     {
-        // valid config and args
-        gl_ptr_st_systick_cfg->fun_ptr_systick_cb = fun_ptr_a_systick_cb;
+        uint32_t_ u32_primask = __get_PRIMASK();
+        __disable_irq();
+
+        ptr_st_a_stats->u32_overruns = gl_u32_periodic_overruns;
+        ptr_st_a_stats->u32_missed_ticks = gl_u32_periodic_missed_ticks;
+
+        __set_PRIMASK(u32_primask);
     }
 
     return en_systick_error_retval;
 }
 
+/**
+ * @brief                      : Gets the uptime in us
+ *
+ * @return                     : Uptime in us, 0 when not in free running mode
+ */
+uint64_t_ systick_now_us(void)
+{
+    uint64_t_ u64_now_us = 0;
+
+    if(
+            (TRUE == gl_systick_initialized) &&
+            (SYSTICK_MODE_FREE_RUNNING == gl_ptr_st_systick_cfg->en_systick_mode)
+            )
+    {
+        u64_now_us = systick_now_ticks() / gl_u32_ticks_per_us;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return u64_now_us;
+}
+
+/**
+ * @brief                      : Gets the uptime in ms
+ *
+ * @return                     : Uptime in ms, 0 when not in free running mode
+ */
+uint64_t_ systick_now_ms(void)
+{
+    uint64_t_ u64_now_ms = 0;
+
+    if(
+            (TRUE == gl_systick_initialized) &&
+            (SYSTICK_MODE_FREE_RUNNING == gl_ptr_st_systick_cfg->en_systick_mode)
+            )
+    {
+        u64_now_ms = systick_now_ticks() / gl_u32_ticks_per_ms;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return u64_now_ms;
+}
+
 // sys tick interrupt handler
 void SysTick_Handler(void)
 {
+    // sampled first, the periodic callback overrun is measured from here
+    uint32_t_ u32_entry_cycles = DWT->CYCCNT;
+    uint32_t_ u32_entry_current;
+
+    // the interrupt pends when the counter reaches 0, STRELOAD is latched one systick clock later
+    // (PIOSC/4 is up to 20 core cycles at 80MHz), the queued period must be loaded before it is rewritten
+    while(
+            (ZERO == STCURRENT) &&
+            (GET_BIT(STCTRL, STCTRL_ENABLE))
+            );
+
+    u32_entry_current = STCURRENT;
+
     if(
             (TRUE == gl_systick_initialized) &&
             (NULL_PTR != gl_ptr_st_systick_cfg) &&
-            (NULL_PTR != gl_ptr_st_systick_cfg->fun_ptr_systick_cb)
+            (SYSTICK_MODE_FREE_RUNNING == gl_ptr_st_systick_cfg->en_systick_mode)
             )
     {
-        CLR_BIT(STCTRL, STCTRL_ENABLE); // stop timer
+        // the head of a split period ends at a deadline, not on a tick
+        boolean bool_tick = (FALSE == gl_bool_split_head) ? TRUE : FALSE;
+
+        // advance uptime by the period that just ended, the queued period is running now
+        gl_u64_uptime_ticks += gl_u32_run_ticks;
+        gl_u32_run_ticks = gl_u32_next_run_ticks;
+        gl_bool_split_head = FALSE;
+
+        if(gl_u32_next_run_ticks != gl_u32_period_ticks)
+        {
+            // tail of a split (or of a cut tickless) period is running, normal periods resume after it
+            STRELOAD = gl_u32_period_ticks - 1;
+            gl_u32_next_run_ticks = gl_u32_period_ticks;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        if(ZERO != gl_u32_retune_ticks)
+        {
+            // tick period change requested while this reload was pending, queue it for the next one
+            systick_retune(gl_u32_retune_ticks);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        if(
+                (TRUE == bool_tick) &&
+                (TRUE == gl_bool_periodic_active)
+                )
+        {
+            // periods that ended inside the callback were folded in one reload, keep the uptime whole
+            gl_u64_uptime_ticks += (uint64_t_) systick_periodic_run(u32_entry_cycles, u32_entry_current,
+                                                                    gl_u32_run_ticks) * gl_u32_period_ticks;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        if(
+                (TRUE == gl_bool_async_pending) &&
+                (gl_u64_uptime_ticks >= gl_u64_async_deadline)
+                )
+        {
+            gl_bool_async_pending = FALSE;
+            systick_notify(SYSTICK_EVENT_DELAY_DONE);
+        }
+        else if(TRUE == gl_bool_async_pending)
+        {
+            // end the period that just started at the deadline if it falls inside it
+            systick_wake_at(gl_u64_async_deadline);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
 
-        // callback
-        if(NULL_PTR != gl_ptr_st_systick_cfg->fun_ptr_systick_cb)
+        if(TRUE == bool_tick)
+        {
+            systick_notify(SYSTICK_EVENT_TICK);
+        }
+        else
         {
-            gl_ptr_st_systick_cfg->fun_ptr_systick_cb();
+            /* Do Nothing */
         }
+    }
+    else if(
+            (TRUE == gl_systick_initialized) &&
+            (NULL_PTR != gl_ptr_st_systick_cfg) &&
+            (TRUE == gl_bool_periodic_active)
+            )
+    {
+        // auto-reload already started the next period
+        (void) systick_periodic_run(u32_entry_cycles, u32_entry_current, gl_u32_period_ticks);
+    }
+    else if(
+            (TRUE == gl_systick_initialized) &&
+            (NULL_PTR != gl_ptr_st_systick_cfg) &&
+            (gl_u32_oneshot_segments > 0)
+            )
+    {
+        // one reload period of the chain ended, the next one is already running
+        gl_u32_oneshot_segments--;
+
+        if(ZERO == gl_u32_oneshot_segments)
+        {
+            CLR_BIT(STCTRL, STCTRL_ENABLE); // stop timer
+            gl_bool_oneshot_busy = FALSE;
 
+            if(TRUE == gl_bool_oneshot_async)
+            {
+                systick_notify(SYSTICK_EVENT_DELAY_DONE);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        else if(2 == gl_u32_oneshot_segments)
+        {
+            // period after the running one is the last, queue the remainder
+            STRELOAD = gl_u32_oneshot_last_reload;
+        }
+        else
+        {
+            // full periods keep reloading STLOAD_MAX_VALUE
+            /* Do Nothing */
+        }
     }
-}
\ No newline at end of file
+    else
+    {
+        /* Do Nothing */
+    }
+}
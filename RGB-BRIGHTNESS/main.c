@@ -14,17 +14,24 @@
 
 //#define TEST 1
 #if TEST
+    #include "TM4C123.h"
+    #include "gpio_interface.h"
+    #include "bit_math.h"
+
     void test_systick_sync();
     void test_systick_async();
-    void test_systick_cb_me();
+    void test_systick_cb_me(void * ptr_v_ctx);
+    uint32_t_ test_gpio_bus_toggle();
 #endif
 
 int main(void)
 {
 
 #if TEST
-    //void test_systick_sync();
-    void test_systick_async();
+    // bus toggle rates first, the systick stubs do not return
+    test_gpio_bus_toggle();
+    //test_systick_async();
+    test_systick_sync();
     return 0;
 #endif
     en_app_error_t en_app_error = APP_OK;
@@ -52,7 +59,11 @@ int main(void)
 void test_systick_sync()
 {
     en_systick_error_t en_systick_error =  systick_init(&gl_st_systick_cfg_0);
-    en_systick_error = systick_ms_delay(1000);
+
+    if(ST_OK == en_systick_error)
+    {
+        en_systick_error = systick_ms_delay(1000);
+    }
 
     while(1)
     {
@@ -64,8 +75,16 @@ void test_systick_sync()
 void test_systick_async()
 {
     en_systick_error_t en_systick_error = systick_init(&gl_st_systick_cfg_0);
-    en_systick_error = systick_set_callback(&test_systick_cb_me);
-    en_systick_error = systick_async_ms_delay(1000);
+
+    if(ST_OK == en_systick_error)
+    {
+        en_systick_error = systick_subscribe(SYSTICK_EVENT_DELAY_DONE, &test_systick_cb_me, NULL_PTR);
+    }
+
+    if(ST_OK == en_systick_error)
+    {
+        en_systick_error = systick_async_ms_delay(1000);
+    }
 
     while(1)
     {
@@ -73,7 +92,7 @@ void test_systick_async()
     }
 }
 
-void test_systick_cb_me()
+void test_systick_cb_me(void * ptr_v_ctx)
 {
     // callback from systick
     while(1)
@@ -81,4 +100,74 @@ void test_systick_cb_me()
 
     }
 }
-#endif
\ No newline at end of file
+
+#define TEST_GPIO_TOGGLE_COUNT  1000
+
+// gl_u32_test_gpio_failures bits
+#define TEST_GPIO_FAIL_AHB_SLOWER   0   // the AHB aperture toggles no faster than the APB one
+
+/* Core cycles taken by TEST_GPIO_TOGGLE_COUNT toggles and toggles per ms on each bus (inspect from the debugger) */
+volatile uint32_t_ gl_u32_test_apb_toggle_cycles = 0;
+volatile uint32_t_ gl_u32_test_ahb_toggle_cycles = 0;
+volatile uint32_t_ gl_u32_test_apb_toggles_per_ms = 0;
+volatile uint32_t_ gl_u32_test_ahb_toggles_per_ms = 0;
+volatile uint32_t_ gl_u32_test_gpio_failures = 0;
+
+static uint32_t_ test_gpio_toggle_cycles(en_gpio_bus_t en_a_bus)
+{
+    uint32_t_ u32_start_cycles = 0;
+    uint32_t_ u32_toggle_idx = 0;
+    st_gpio_cfg_t st_gpio_cfg_test = {
+        .port = GPIO_PORT_F,
+        .pin = GPIO_PIN_1,
+        .pin_cfg = OUTPUT,
+        .current = PIN_CURRENT_8MA,
+        .bus = en_a_bus
+    };
+
+    gpio_pin_init(&st_gpio_cfg_test);
+
+    u32_start_cycles = DWT->CYCCNT;
+    for(u32_toggle_idx = 0; u32_toggle_idx < TEST_GPIO_TOGGLE_COUNT; u32_toggle_idx++)
+    {
+        gpio_togPinVal(GPIO_PORT_F, GPIO_PIN_1);
+    }
+
+    return DWT->CYCCNT - u32_start_cycles;
+}
+
+static uint32_t_ test_gpio_toggles_per_ms(uint32_t_ u32_a_cycles)
+{
+    return (uint32_t_) (((uint64_t_) TEST_GPIO_TOGGLE_COUNT * (SystemCoreClock / 1000)) / u32_a_cycles);
+}
+
+/*
+ * Toggles a port F pin through each bus aperture, returns gl_u32_test_gpio_failures (0: the AHB aperture is the
+ * faster one)
+ */
+uint32_t_ test_gpio_bus_toggle()
+{
+    // enable the core cycle counter
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = ZERO;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    SystemCoreClockUpdate();
+
+    gl_u32_test_apb_toggle_cycles = test_gpio_toggle_cycles(GPIO_BUS_APB);
+    gl_u32_test_ahb_toggle_cycles = test_gpio_toggle_cycles(GPIO_BUS_AHB);
+    gl_u32_test_apb_toggles_per_ms = test_gpio_toggles_per_ms(gl_u32_test_apb_toggle_cycles);
+    gl_u32_test_ahb_toggles_per_ms = test_gpio_toggles_per_ms(gl_u32_test_ahb_toggle_cycles);
+
+    if(gl_u32_test_ahb_toggles_per_ms <= gl_u32_test_apb_toggles_per_ms)
+    {
+        SET_BIT(gl_u32_test_gpio_failures, TEST_GPIO_FAIL_AHB_SLOWER);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return gl_u32_test_gpio_failures;
+}
+
+#endif
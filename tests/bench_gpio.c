@@ -0,0 +1,185 @@
+/**
+ * @file    :   bench_gpio.c
+ * @brief   :   Checked vs fast GPIO path: DATA register accesses, instructions and ns per call
+ * @version :   0.1
+ *
+ * @note    :   Instructions are counted with perf_event (user space only) when the host allows it. Every
+ *              DATA access runs the host alias emulation (gpio_host_data), its cost is measured alone and
+ *              taken out, what is left is the driver code that also runs on the target
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "gpio_interface.h"
+#include "gpio_private.h"
+#include "gpio_host.h"
+#include "bench_gpio.h"
+
+// after the driver headers, the system headers take over the NULL of std.h
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "host_test.h"
+
+#define BENCH_GPIO_CALLS            100000UL
+#define BENCH_GPIO_RUNS             5
+
+typedef struct
+{
+    const char* name;
+    fun_bench_gpio_loop_t fun_ptr_loop;
+    double f64_accesses;
+    double f64_instructions;
+    double f64_ns;
+} st_bench_gpio_case_t;
+
+static int gl_s32_bench_gpio_perf_fd = -1;
+
+static void bench_gpio_perf_open(void)
+{
+    struct perf_event_attr st_attr;
+
+    memset(&st_attr, 0, sizeof(st_attr));
+    st_attr.type = PERF_TYPE_HARDWARE;
+    st_attr.size = sizeof(st_attr);
+    st_attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    st_attr.disabled = 1;
+    st_attr.exclude_kernel = 1;
+    st_attr.exclude_hv = 1;
+
+    gl_s32_bench_gpio_perf_fd = (int) syscall(SYS_perf_event_open, &st_attr, 0, -1, -1, 0);
+}
+
+static double bench_gpio_now_ns(void)
+{
+    struct timespec st_now;
+
+    clock_gettime(CLOCK_MONOTONIC, &st_now);
+
+    return (double) st_now.tv_sec * 1e9 + (double) st_now.tv_nsec;
+}
+
+// instructions of a loop run, negative without perf_event (or without a PMU behind it, e.g. in a VM)
+static double bench_gpio_instructions(fun_bench_gpio_loop_t fun_ptr_a_loop, uint32_t_ u32_a_calls)
+{
+    long long s64_count = -1;
+
+    if(gl_s32_bench_gpio_perf_fd >= 0)
+    {
+        ioctl(gl_s32_bench_gpio_perf_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(gl_s32_bench_gpio_perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+        fun_ptr_a_loop(u32_a_calls);
+        ioctl(gl_s32_bench_gpio_perf_fd, PERF_EVENT_IOC_DISABLE, 0);
+
+        if(sizeof(s64_count) != read(gl_s32_bench_gpio_perf_fd, &s64_count, sizeof(s64_count))) s64_count = -1;
+        if(0 == s64_count) s64_count = -1;
+    }
+
+    return (double) s64_count;
+}
+
+static void bench_gpio_measure(st_bench_gpio_case_t* ptr_st_a_case)
+{
+    double f64_best_ns = 0;
+    double f64_calls_instructions;
+    double f64_empty_instructions;
+
+    gl_u32_gpio_host_data_accesses = 0;
+    ptr_st_a_case->fun_ptr_loop(BENCH_GPIO_CALLS);
+    ptr_st_a_case->f64_accesses = (double) gl_u32_gpio_host_data_accesses / BENCH_GPIO_CALLS;
+
+    f64_calls_instructions = bench_gpio_instructions(ptr_st_a_case->fun_ptr_loop, BENCH_GPIO_CALLS);
+    f64_empty_instructions = bench_gpio_instructions(ptr_st_a_case->fun_ptr_loop, 0);
+    ptr_st_a_case->f64_instructions = ((f64_calls_instructions < 0) || (f64_empty_instructions < 0)) ? -1 :
+                                      (f64_calls_instructions - f64_empty_instructions) / BENCH_GPIO_CALLS;
+
+    for(int s32_run = 0; s32_run < BENCH_GPIO_RUNS; s32_run++)
+    {
+        double f64_start = bench_gpio_now_ns();
+        double f64_ns;
+
+        ptr_st_a_case->fun_ptr_loop(BENCH_GPIO_CALLS);
+        f64_ns = (bench_gpio_now_ns() - f64_start) / BENCH_GPIO_CALLS;
+        if((0 == s32_run) || (f64_ns < f64_best_ns)) f64_best_ns = f64_ns;
+    }
+    ptr_st_a_case->f64_ns = f64_best_ns;
+}
+
+// the emulation cost of one DATA access, a bare call to the accessor
+static void bench_gpio_access(uint32_t_ u32_a_calls)
+{
+    for(uint32_t_ u32_call = 0; u32_call < u32_a_calls; u32_call++)
+    {
+        *gpio_host_data(BENCH_GPIO_PORT, BENCH_GPIO_PINS) = u32_call;
+    }
+}
+
+int main(void)
+{
+    st_bench_gpio_case_t arr_st_cases[] = {
+        {.name = "write  checked", .fun_ptr_loop = bench_gpio_checked_write},
+        {.name = "write  fast",    .fun_ptr_loop = bench_gpio_fast_write},
+        {.name = "toggle checked", .fun_ptr_loop = bench_gpio_checked_toggle},
+        {.name = "toggle fast",    .fun_ptr_loop = bench_gpio_fast_toggle},
+    };
+    st_bench_gpio_case_t st_access = {.name = "access", .fun_ptr_loop = bench_gpio_access};
+    uint8_t_ u8_case;
+
+    for(en_gpio_pin_t en_pin = GPIO_PIN_1; en_pin <= GPIO_PIN_3; en_pin++)
+    {
+        st_gpio_cfg_t st_cfg = {
+            .port = BENCH_GPIO_PORT, .pin = en_pin, .pin_cfg = OUTPUT, .current = PIN_CURRENT_8MA, .bus = GPIO_BUS_APB
+        };
+
+        TEST_CHECK(GPIO_OK == gpio_pin_init(&st_cfg));
+    }
+
+    bench_gpio_perf_open();
+    bench_gpio_measure(&st_access);
+
+    // the "w/o emulation" columns take the accessor cost out of every DATA access
+    printf("%-16s %9s %14s %14s %9s %14s\n", "path", "accesses", "instructions", "w/o emulation", "ns",
+           "w/o emulation");
+    for(u8_case = 0; u8_case < sizeof(arr_st_cases) / sizeof(arr_st_cases[0]); u8_case++)
+    {
+        st_bench_gpio_case_t* ptr_st_case = &arr_st_cases[u8_case];
+
+        bench_gpio_measure(ptr_st_case);
+
+        printf("%-16s %9.2f ", ptr_st_case->name, ptr_st_case->f64_accesses);
+        if(ptr_st_case->f64_instructions >= 0)
+        {
+            printf("%14.1f %14.1f ", ptr_st_case->f64_instructions,
+                   ptr_st_case->f64_instructions - ptr_st_case->f64_accesses * st_access.f64_instructions);
+        }
+        else
+        {
+            printf("%14s %14s ", "n/a", "n/a");
+        }
+        printf("%9.2f %14.2f\n", ptr_st_case->f64_ns,
+               ptr_st_case->f64_ns - ptr_st_case->f64_accesses * st_access.f64_ns);
+    }
+    printf("one emulated DATA access: %.1f instructions (-1: n/a), %.2f ns\n", st_access.f64_instructions,
+           st_access.f64_ns);
+
+    // the fast path is one masked store (or load/xor/store) per call, whatever the pin count
+    TEST_CHECK(1.0 == arr_st_cases[1].f64_accesses);
+    TEST_CHECK(1.0 == arr_st_cases[3].f64_accesses);
+    TEST_CHECK(arr_st_cases[0].f64_accesses >= arr_st_cases[1].f64_accesses);
+    TEST_CHECK(arr_st_cases[2].f64_accesses >= arr_st_cases[3].f64_accesses);
+
+    if(st_access.f64_instructions >= 0)
+    {
+        TEST_CHECK(arr_st_cases[0].f64_instructions > arr_st_cases[1].f64_instructions);
+        TEST_CHECK(arr_st_cases[2].f64_instructions > arr_st_cases[3].f64_instructions);
+    }
+    else
+    {
+        printf("perf_event not available, instruction counts skipped\n");
+    }
+
+    return TEST_REPORT();
+}
@@ -0,0 +1,28 @@
+/**
+ * @file    :   bench_gpio.h
+ * @brief   :   Call loops of the checked (GPIO_CHECKS=1) and fast (GPIO_CHECKS=0) GPIO paths
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef BENCH_GPIO_H
+#define BENCH_GPIO_H
+
+#include "std.h"
+
+// the LED pins of the launchpad
+#define BENCH_GPIO_PORT             GPIO_PORT_F
+#define BENCH_GPIO_PINS             0x0E
+
+#define BENCH_GPIO_FN_(PATH, NAME)  bench_gpio_##PATH##_##NAME
+#define BENCH_GPIO_FN(PATH, NAME)   BENCH_GPIO_FN_(PATH, NAME)
+
+typedef void (*fun_bench_gpio_loop_t)(uint32_t_ u32_a_calls);
+
+void bench_gpio_checked_write(uint32_t_ u32_a_calls);
+void bench_gpio_checked_toggle(uint32_t_ u32_a_calls);
+void bench_gpio_fast_write(uint32_t_ u32_a_calls);
+void bench_gpio_fast_toggle(uint32_t_ u32_a_calls);
+
+#endif //BENCH_GPIO_H
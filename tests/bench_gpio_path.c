@@ -0,0 +1,33 @@
+/**
+ * @file    :   bench_gpio_path.c
+ * @brief   :   GPIO fast path call loops, built once per GPIO_CHECKS setting (see bench_gpio.c)
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "gpio_fast.h"
+#include "bench_gpio.h"
+
+#if GPIO_CHECKS
+#define BENCH_GPIO_PATH     checked
+#else
+#define BENCH_GPIO_PATH     fast
+#endif
+
+// the calls inline into the loops, as they do in the LED and soft PWM HALs
+void BENCH_GPIO_FN(BENCH_GPIO_PATH, write)(uint32_t_ u32_a_calls)
+{
+    for(uint32_t_ u32_call = 0; u32_call < u32_a_calls; u32_call++)
+    {
+        (void) gpio_fast_writePins(BENCH_GPIO_PORT, BENCH_GPIO_PINS, (uint8_t_) u32_call);
+    }
+}
+
+void BENCH_GPIO_FN(BENCH_GPIO_PATH, toggle)(uint32_t_ u32_a_calls)
+{
+    for(uint32_t_ u32_call = 0; u32_call < u32_a_calls; u32_call++)
+    {
+        (void) gpio_fast_togglePins(BENCH_GPIO_PORT, BENCH_GPIO_PINS);
+    }
+}
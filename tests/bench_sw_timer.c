@@ -0,0 +1,321 @@
+/**
+ * @file    :   bench_sw_timer.c
+ * @brief   :   Software timer queue (built as heap or wheel) against a sorted list queue at 10, 100 and
+ *              1000 active timers: start, stop, restart and tick cost
+ * @version :   0.1
+ *
+ * @note    :   The sorted list takes the same critical sections as the driver, so the numbers only differ by
+ *              the queue work. Both run on the fake ms tick, callbacks are empty
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "sw_timer_interface.h"
+#include "fake_systick.h"
+
+// after the driver headers, the system headers take over the NULL of std.h
+#include <time.h>
+#include "host_test.h"
+#include "host_core.h"
+
+#define BENCH_SW_TIMER_OPS              100000UL
+#define BENCH_SW_TIMER_TICK_MS          20000UL
+#define BENCH_SW_TIMER_LIST_END         0xFFFF
+
+// long periods keep the timers queued during the start/stop runs, short ones expire during the tick run
+#define BENCH_SW_TIMER_LONG_MS(RAND)    (100000UL + ((RAND) % 1000000UL))
+#define BENCH_SW_TIMER_SHORT_MS(RAND)   (10UL + ((RAND) % 1000UL))
+
+#if SW_TIMER_QUEUE == SW_TIMER_QUEUE_HEAP
+#define BENCH_SW_TIMER_QUEUE_NAME       "heap"
+#else
+#define BENCH_SW_TIMER_QUEUE_NAME       "wheel"
+#endif
+
+typedef struct
+{
+    const char * name;
+    void (*fun_ptr_setup)(uint16_t_ u16_a_timers);
+    void (*fun_ptr_teardown)(uint16_t_ u16_a_timers);
+    void (*fun_ptr_start)(uint16_t_ u16_a_idx, uint32_t_ u32_a_period_ms);
+    void (*fun_ptr_stop)(uint16_t_ u16_a_idx);
+    void (*fun_ptr_tick)(void);
+} st_bench_sw_timer_queue_t;
+
+typedef struct
+{
+    double f64_churn_ns;            // stop then start of a queued timer
+    double f64_restart_ns;          // start of a queued timer
+    double f64_tick_ns;             // per ms, expiries and periodic re-arms included
+    uint32_t_ u32_expiries;
+} st_bench_sw_timer_result_t;
+
+// sorted list reference: doubly linked by deadline, O(n) start, O(1) stop and expiry
+typedef struct
+{
+    uint64_t_ u64_deadline_ms;
+    uint32_t_ u32_period_ms;
+    uint16_t_ u16_next;
+    uint16_t_ u16_prev;
+    boolean bool_queued;
+} st_bench_sw_timer_list_node_t;
+
+static st_bench_sw_timer_list_node_t gl_arr_st_bench_list[SW_TIMER_MAX_TIMERS];
+static uint16_t_ gl_u16_bench_list_head = BENCH_SW_TIMER_LIST_END;
+
+static uint16_t_ gl_arr_u16_bench_ids[SW_TIMER_MAX_TIMERS];
+static uint32_t_ gl_arr_u32_bench_rand[BENCH_SW_TIMER_OPS];
+static volatile uint32_t_ gl_u32_bench_expiries = 0;
+
+static double bench_sw_timer_now_ns(void)
+{
+    struct timespec st_now;
+
+    clock_gettime(CLOCK_MONOTONIC, &st_now);
+
+    return (double) st_now.tv_sec * 1e9 + (double) st_now.tv_nsec;
+}
+
+static void bench_sw_timer_cb(void * ptr_v_ctx)
+{
+    gl_u32_bench_expiries++;
+}
+
+static void bench_sw_timer_list_unlink(uint16_t_ u16_a_id)
+{
+    st_bench_sw_timer_list_node_t * ptr_st_node = &gl_arr_st_bench_list[u16_a_id];
+
+    if(BENCH_SW_TIMER_LIST_END != ptr_st_node->u16_prev) gl_arr_st_bench_list[ptr_st_node->u16_prev].u16_next = ptr_st_node->u16_next;
+    else gl_u16_bench_list_head = ptr_st_node->u16_next;
+
+    if(BENCH_SW_TIMER_LIST_END != ptr_st_node->u16_next) gl_arr_st_bench_list[ptr_st_node->u16_next].u16_prev = ptr_st_node->u16_prev;
+
+    ptr_st_node->bool_queued = FALSE;
+}
+
+// walks to the first later deadline, equal deadlines keep their start order
+static void bench_sw_timer_list_insert(uint16_t_ u16_a_id)
+{
+    st_bench_sw_timer_list_node_t * ptr_st_node = &gl_arr_st_bench_list[u16_a_id];
+    uint16_t_ u16_prev = BENCH_SW_TIMER_LIST_END;
+    uint16_t_ u16_next = gl_u16_bench_list_head;
+
+    while((BENCH_SW_TIMER_LIST_END != u16_next) &&
+          (gl_arr_st_bench_list[u16_next].u64_deadline_ms <= ptr_st_node->u64_deadline_ms))
+    {
+        u16_prev = u16_next;
+        u16_next = gl_arr_st_bench_list[u16_next].u16_next;
+    }
+
+    ptr_st_node->u16_prev = u16_prev;
+    ptr_st_node->u16_next = u16_next;
+    if(BENCH_SW_TIMER_LIST_END != u16_prev) gl_arr_st_bench_list[u16_prev].u16_next = u16_a_id;
+    else gl_u16_bench_list_head = u16_a_id;
+    if(BENCH_SW_TIMER_LIST_END != u16_next) gl_arr_st_bench_list[u16_next].u16_prev = u16_a_id;
+
+    ptr_st_node->bool_queued = TRUE;
+}
+
+static void bench_sw_timer_list_start(uint16_t_ u16_a_id, uint32_t_ u32_a_period_ms)
+{
+    uint32_t_ u32_primask = __get_PRIMASK();
+    __disable_irq();
+
+    if(TRUE == gl_arr_st_bench_list[u16_a_id].bool_queued) bench_sw_timer_list_unlink(u16_a_id);
+
+    gl_arr_st_bench_list[u16_a_id].u32_period_ms = u32_a_period_ms;
+    gl_arr_st_bench_list[u16_a_id].u64_deadline_ms = systick_now_ms() + u32_a_period_ms;
+    bench_sw_timer_list_insert(u16_a_id);
+
+    __set_PRIMASK(u32_primask);
+}
+
+static void bench_sw_timer_list_stop(uint16_t_ u16_a_id)
+{
+    uint32_t_ u32_primask = __get_PRIMASK();
+    __disable_irq();
+
+    if(TRUE == gl_arr_st_bench_list[u16_a_id].bool_queued) bench_sw_timer_list_unlink(u16_a_id);
+
+    __set_PRIMASK(u32_primask);
+}
+
+// periodic expiry: pop the head, re-insert it one period later
+static void bench_sw_timer_list_tick(void)
+{
+    uint64_t_ u64_now_ms = systick_now_ms();
+
+    while((BENCH_SW_TIMER_LIST_END != gl_u16_bench_list_head) &&
+          (gl_arr_st_bench_list[gl_u16_bench_list_head].u64_deadline_ms <= u64_now_ms))
+    {
+        uint16_t_ u16_id = gl_u16_bench_list_head;
+
+        bench_sw_timer_list_unlink(u16_id);
+        gl_arr_st_bench_list[u16_id].u64_deadline_ms += gl_arr_st_bench_list[u16_id].u32_period_ms;
+        bench_sw_timer_list_insert(u16_id);
+        bench_sw_timer_cb(NULL_PTR);
+    }
+}
+
+static void bench_sw_timer_list_setup(uint16_t_ u16_a_timers)
+{
+    gl_u16_bench_list_head = BENCH_SW_TIMER_LIST_END;
+
+    for(uint16_t_ u16_id = 0; u16_id < u16_a_timers; u16_id++)
+    {
+        gl_arr_st_bench_list[u16_id].bool_queued = FALSE;
+    }
+}
+
+static void bench_sw_timer_list_teardown(uint16_t_ u16_a_timers)
+{
+    bench_sw_timer_list_setup(u16_a_timers);
+}
+
+// the driver's own tick is subscribed too, with no timer queued it is a few compares per ms
+static void bench_sw_timer_list_advance(void)
+{
+    fake_systick_advance(1);
+    bench_sw_timer_list_tick();
+}
+
+static void bench_sw_timer_driver_setup(uint16_t_ u16_a_timers)
+{
+    for(uint16_t_ u16_idx = 0; u16_idx < u16_a_timers; u16_idx++)
+    {
+        TEST_CHECK(SW_TIMER_OK == sw_timer_create(SW_TIMER_PERIODIC, bench_sw_timer_cb, NULL_PTR,
+                                                  &gl_arr_u16_bench_ids[u16_idx]));
+    }
+}
+
+static void bench_sw_timer_driver_teardown(uint16_t_ u16_a_timers)
+{
+    for(uint16_t_ u16_idx = 0; u16_idx < u16_a_timers; u16_idx++)
+    {
+        TEST_CHECK(SW_TIMER_OK == sw_timer_delete(gl_arr_u16_bench_ids[u16_idx]));
+    }
+}
+
+static void bench_sw_timer_driver_start(uint16_t_ u16_a_idx, uint32_t_ u32_a_period_ms)
+{
+    (void) sw_timer_start(gl_arr_u16_bench_ids[u16_a_idx], u32_a_period_ms);
+}
+
+static void bench_sw_timer_driver_stop(uint16_t_ u16_a_idx)
+{
+    (void) sw_timer_stop(gl_arr_u16_bench_ids[u16_a_idx]);
+}
+
+static void bench_sw_timer_driver_advance(void)
+{
+    fake_systick_advance(1);
+}
+
+// one critical section as the driver and the list take it, the simulated core's share of every call
+static double bench_sw_timer_masking_ns(void)
+{
+    double f64_start = bench_sw_timer_now_ns();
+
+    for(uint32_t_ u32_op = 0; u32_op < BENCH_SW_TIMER_OPS; u32_op++)
+    {
+        uint32_t_ u32_primask = __get_PRIMASK();
+        __disable_irq();
+        __set_PRIMASK(u32_primask);
+    }
+
+    return (bench_sw_timer_now_ns() - f64_start) / BENCH_SW_TIMER_OPS;
+}
+
+static void bench_sw_timer_run(const st_bench_sw_timer_queue_t * ptr_st_a_queue, uint16_t_ u16_a_timers,
+                               st_bench_sw_timer_result_t * ptr_st_a_result)
+{
+    double f64_start;
+
+    ptr_st_a_queue->fun_ptr_setup(u16_a_timers);
+
+    for(uint16_t_ u16_idx = 0; u16_idx < u16_a_timers; u16_idx++)
+    {
+        ptr_st_a_queue->fun_ptr_start(u16_idx, BENCH_SW_TIMER_LONG_MS(gl_arr_u32_bench_rand[u16_idx]));
+    }
+
+    f64_start = bench_sw_timer_now_ns();
+    for(uint32_t_ u32_op = 0; u32_op < BENCH_SW_TIMER_OPS; u32_op++)
+    {
+        ptr_st_a_queue->fun_ptr_stop(u32_op % u16_a_timers);
+        ptr_st_a_queue->fun_ptr_start(u32_op % u16_a_timers, BENCH_SW_TIMER_LONG_MS(gl_arr_u32_bench_rand[u32_op]));
+    }
+    ptr_st_a_result->f64_churn_ns = (bench_sw_timer_now_ns() - f64_start) / BENCH_SW_TIMER_OPS;
+
+    f64_start = bench_sw_timer_now_ns();
+    for(uint32_t_ u32_op = 0; u32_op < BENCH_SW_TIMER_OPS; u32_op++)
+    {
+        ptr_st_a_queue->fun_ptr_start(u32_op % u16_a_timers, BENCH_SW_TIMER_LONG_MS(gl_arr_u32_bench_rand[u32_op]));
+    }
+    ptr_st_a_result->f64_restart_ns = (bench_sw_timer_now_ns() - f64_start) / BENCH_SW_TIMER_OPS;
+
+    // short periodic timers, the same deadlines for both queues
+    for(uint16_t_ u16_idx = 0; u16_idx < u16_a_timers; u16_idx++)
+    {
+        ptr_st_a_queue->fun_ptr_start(u16_idx, BENCH_SW_TIMER_SHORT_MS(gl_arr_u32_bench_rand[u16_idx]));
+    }
+
+    gl_u32_bench_expiries = 0;
+    f64_start = bench_sw_timer_now_ns();
+    for(uint32_t_ u32_ms = 0; u32_ms < BENCH_SW_TIMER_TICK_MS; u32_ms++)
+    {
+        ptr_st_a_queue->fun_ptr_tick();
+    }
+    ptr_st_a_result->f64_tick_ns = (bench_sw_timer_now_ns() - f64_start) / BENCH_SW_TIMER_TICK_MS;
+    ptr_st_a_result->u32_expiries = gl_u32_bench_expiries;
+
+    ptr_st_a_queue->fun_ptr_teardown(u16_a_timers);
+}
+
+int main(void)
+{
+    const st_bench_sw_timer_queue_t arr_st_queues[] = {
+        {"sorted list", bench_sw_timer_list_setup, bench_sw_timer_list_teardown, bench_sw_timer_list_start,
+         bench_sw_timer_list_stop, bench_sw_timer_list_advance},
+        {BENCH_SW_TIMER_QUEUE_NAME, bench_sw_timer_driver_setup, bench_sw_timer_driver_teardown,
+         bench_sw_timer_driver_start, bench_sw_timer_driver_stop, bench_sw_timer_driver_advance},
+    };
+    const uint16_t_ arr_u16_timers[] = {10, 100, 1000};
+    st_bench_sw_timer_result_t arr_st_results[2];
+    uint32_t_ u32_seed = 12345;
+
+    host_core_reset(16000000UL, 0);
+    fake_systick_reset(0, TRUE);
+    TEST_CHECK(SW_TIMER_OK == sw_timer_init());
+
+    for(uint32_t_ u32_op = 0; u32_op < BENCH_SW_TIMER_OPS; u32_op++)
+    {
+        u32_seed = (u32_seed * 1103515245UL) + 12345UL;
+        gl_arr_u32_bench_rand[u32_op] = u32_seed >> 8;
+    }
+
+    printf("%-12s %7s %14s %12s %12s %12s\n", "queue", "timers", "stop+start ns", "restart ns", "tick ns/ms",
+           "expiries/ms");
+    for(uint8_t_ u8_count = 0; u8_count < sizeof(arr_u16_timers) / sizeof(arr_u16_timers[0]); u8_count++)
+    {
+        for(uint8_t_ u8_queue = 0; u8_queue < 2; u8_queue++)
+        {
+            st_bench_sw_timer_result_t * ptr_st_result = &arr_st_results[u8_queue];
+
+            bench_sw_timer_run(&arr_st_queues[u8_queue], arr_u16_timers[u8_count], ptr_st_result);
+            printf("%-12s %7u %14.1f %12.1f %12.1f %12.2f\n", arr_st_queues[u8_queue].name, arr_u16_timers[u8_count],
+                   ptr_st_result->f64_churn_ns, ptr_st_result->f64_restart_ns, ptr_st_result->f64_tick_ns,
+                   (double) ptr_st_result->u32_expiries / BENCH_SW_TIMER_TICK_MS);
+        }
+
+        // same deadlines, same expiries
+        TEST_CHECK(arr_st_results[0].u32_expiries == arr_st_results[1].u32_expiries);
+    }
+
+    printf("one critical section (simulated PRIMASK) costs %.1f ns of each stop/start\n", bench_sw_timer_masking_ns());
+
+    // the list walk dominates at 1000 timers
+    TEST_CHECK(arr_st_results[1].f64_churn_ns < arr_st_results[0].f64_churn_ns);
+    TEST_CHECK(arr_st_results[1].f64_restart_ns < arr_st_results[0].f64_restart_ns);
+
+    return TEST_REPORT();
+}
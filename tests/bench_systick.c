@@ -0,0 +1,350 @@
+/**
+ * @file    :   bench_systick.c
+ * @brief   :   SysTick accuracy and jitter benchmark on the simulated core, the core cycle counter (system clock) is
+ *              the reference. Runs once per clock source and core clock, each in its own process (systick is
+ *              initialized once per reset)
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "systick_interface.h"
+#include "systick_linking_config.h"
+#include "bit_math.h"
+#include "TM4C123.h"
+
+// after the driver headers, the system headers take over the NULL of std.h
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "host_test.h"
+#include "host_core.h"
+
+#define TEST_BENCH_DELAY_REPEAT         8       // runs per swept delay
+#define TEST_BENCH_LATENCY_SAMPLES      1000    // periodic callbacks sampled for the latency histogram
+#define TEST_BENCH_LATENCY_PERIOD_US    1000
+#define TEST_BENCH_DRIFT_MS             10000   // must stay below one cycle counter wrap (2^32 cycles)
+
+// regression thresholds, per delay class. Delays on the systick clock are compared after taking out the
+// measured drift of that clock (PIOSC), busy-wait ones run on the cycle counter itself
+#define TEST_BENCH_MAX_EARLY_US         1       // any delay returning earlier than this fails
+#define TEST_BENCH_BUSY_MAX_ERR_US      1       // busy-wait us delays (<= SYSTICK_US_BUSY_WAIT_MAX)
+#define TEST_BENCH_BUSY_MAX_BIAS_US     1       // mean error of busy-wait us delays (rounding bias)
+#define TEST_BENCH_MAX_LATENCY_US       16      // reload to periodic callback
+// interrupt timed delays end on the split period at the deadline (or busy-poll a short remainder):
+// late by the wake-up latency, plus 1 us for the tick/cycle rounding
+#define TEST_BENCH_WAKE_MAX_ERR_US      (TEST_BENCH_MAX_LATENCY_US + 1)
+// PIOSC is a separate oscillator (+-1% trimmed), the system clock source shares the reference clock
+#define TEST_BENCH_MAX_DRIFT_PPM(CLK)   ((CLK_SRC_PIOSC == (CLK)) ? 10000 : 1)
+
+// gl_u32_test_bench_failures bits
+#define TEST_BENCH_FAIL_DELAY_ERR       0
+#define TEST_BENCH_FAIL_DELAY_BIAS      1
+#define TEST_BENCH_FAIL_LATENCY         2
+#define TEST_BENCH_FAIL_OVERRUN         3
+#define TEST_BENCH_FAIL_DRIFT           4
+
+#define TEST_BENCH_LATENCY_BINS         6       // < 1, 2, 4, 8, 16 us and above
+
+typedef struct{
+    uint32_t_ u32_delay_us;
+    boolean bool_ms_api;            // TRUE: systick_ms_delay, FALSE: systick_us_delay
+    sint32_t_ s32_min_err_cycles;   // measured - requested
+    sint32_t_ s32_max_err_cycles;
+    sint32_t_ s32_mean_err_cycles;  // rounding bias
+}st_test_delay_result_t;
+
+static st_test_delay_result_t gl_arr_st_test_delay_results[] = {
+        {1,      FALSE, 0, 0, 0}, {5,      FALSE, 0, 0, 0}, {10,     FALSE, 0, 0, 0},
+        {50,     FALSE, 0, 0, 0}, {100,    FALSE, 0, 0, 0}, {101,    FALSE, 0, 0, 0},
+        {250,    FALSE, 0, 0, 0}, {999,    FALSE, 0, 0, 0}, {1000,   FALSE, 0, 0, 0},
+        {4999,   FALSE, 0, 0, 0}, {20000,  FALSE, 0, 0, 0}, {1000,   TRUE,  0, 0, 0},
+        {2000,   TRUE,  0, 0, 0}, {10000,  TRUE,  0, 0, 0}, {100000, TRUE,  0, 0, 0},
+};
+
+#define TEST_BENCH_DELAY_COUNT  (sizeof(gl_arr_st_test_delay_results) / sizeof(gl_arr_st_test_delay_results[0]))
+
+static volatile uint32_t_ gl_arr_u32_test_latency_hist[TEST_BENCH_LATENCY_BINS] = {0};
+static volatile uint32_t_ gl_u32_test_latency_max_us = 0;
+static volatile uint32_t_ gl_u32_test_latency_samples = 0;
+static volatile st_systick_periodic_stats_t gl_st_test_periodic_stats = {0};
+static volatile sint32_t_ gl_s32_test_drift_ppm = 0;
+static volatile uint32_t_ gl_u32_test_bench_failures = 0;
+
+// clock of the run, set by test_systick_bench_run after systick_init
+static en_systick_clk_src_t gl_en_test_bench_clk_src = CLK_SRC_PIOSC;
+static uint32_t_ gl_u32_test_cycles_per_us = SYS_CLOCK_MHZ;
+static uint32_t_ gl_u32_test_ticks_per_us = PIOSC_MHZ / 4;
+
+static void test_bench_latency_cb(void * ptr_v_ctx)
+{
+    // ticks since the reload that fired this call
+    uint32_t_ u32_latency_us = (SysTick->LOAD - SysTick->VAL) / gl_u32_test_ticks_per_us;
+    uint8_t_ u8_bin = 0;
+
+    if(gl_u32_test_latency_samples < TEST_BENCH_LATENCY_SAMPLES)
+    {
+        while(
+                (u8_bin < (TEST_BENCH_LATENCY_BINS - 1)) &&
+                (u32_latency_us >= (1UL << u8_bin))
+                )
+        {
+            u8_bin++;
+        }
+
+        gl_arr_u32_test_latency_hist[u8_bin]++;
+        gl_u32_test_latency_max_us = (u32_latency_us > gl_u32_test_latency_max_us) ?
+                                     u32_latency_us : gl_u32_test_latency_max_us;
+        gl_u32_test_latency_samples++;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+static void test_bench_delays(void)
+{
+    for(uint32_t_ u32_idx = 0; u32_idx < TEST_BENCH_DELAY_COUNT; u32_idx++)
+    {
+        st_test_delay_result_t * ptr_st_result = &gl_arr_st_test_delay_results[u32_idx];
+        boolean bool_busy = ((FALSE == ptr_st_result->bool_ms_api) &&
+                             (ptr_st_result->u32_delay_us <= SYSTICK_US_BUSY_WAIT_MAX)) ? TRUE : FALSE;
+        sint32_t_ s32_max_err_cycles;
+        sint64_t_ s64_sum_err_cycles = 0;
+        sint32_t_ s32_expected_cycles;
+
+        // systick clock delays last the requested time on that clock, measured against the core clock
+        s32_expected_cycles = (TRUE == bool_busy) ?
+                (sint32_t_) (ptr_st_result->u32_delay_us * gl_u32_test_cycles_per_us) :
+                (sint32_t_) (((sint64_t_) ptr_st_result->u32_delay_us * gl_u32_test_cycles_per_us * 1000000) /
+                             (1000000 + gl_s32_test_drift_ppm));
+
+        ptr_st_result->s32_min_err_cycles = 0x7FFFFFFF;
+        ptr_st_result->s32_max_err_cycles = -0x7FFFFFFF;
+
+        for(uint8_t_ u8_run = 0; u8_run < TEST_BENCH_DELAY_REPEAT; u8_run++)
+        {
+            uint32_t_ u32_start_cycles = DWT->CYCCNT;
+            sint32_t_ s32_err_cycles;
+
+            if(TRUE == ptr_st_result->bool_ms_api)
+            {
+                systick_ms_delay(ptr_st_result->u32_delay_us / 1000);
+            }
+            else
+            {
+                systick_us_delay(ptr_st_result->u32_delay_us);
+            }
+
+            s32_err_cycles = (sint32_t_) (DWT->CYCCNT - u32_start_cycles) - s32_expected_cycles;
+
+            ptr_st_result->s32_min_err_cycles = (s32_err_cycles < ptr_st_result->s32_min_err_cycles) ?
+                                                s32_err_cycles : ptr_st_result->s32_min_err_cycles;
+            ptr_st_result->s32_max_err_cycles = (s32_err_cycles > ptr_st_result->s32_max_err_cycles) ?
+                                                s32_err_cycles : ptr_st_result->s32_max_err_cycles;
+            s64_sum_err_cycles += s32_err_cycles;
+        }
+
+        ptr_st_result->s32_mean_err_cycles = (sint32_t_) (s64_sum_err_cycles / TEST_BENCH_DELAY_REPEAT);
+
+        // busy-wait delays are cycle exact, longer ones end at the deadline plus the wake-up
+        s32_max_err_cycles = (TRUE == bool_busy) ?
+                             (TEST_BENCH_BUSY_MAX_ERR_US * gl_u32_test_cycles_per_us) :
+                             (TEST_BENCH_WAKE_MAX_ERR_US * gl_u32_test_cycles_per_us);
+
+        if(
+                (ptr_st_result->s32_min_err_cycles < -(sint32_t_) (TEST_BENCH_MAX_EARLY_US * gl_u32_test_cycles_per_us)) ||
+                (ptr_st_result->s32_max_err_cycles > s32_max_err_cycles)
+                )
+        {
+            SET_BIT(gl_u32_test_bench_failures, TEST_BENCH_FAIL_DELAY_ERR);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        if(
+                (TRUE == bool_busy) &&
+                (
+                        (ptr_st_result->s32_mean_err_cycles >
+                         (sint32_t_) (TEST_BENCH_BUSY_MAX_BIAS_US * gl_u32_test_cycles_per_us)) ||
+                        (ptr_st_result->s32_mean_err_cycles <
+                         -(sint32_t_) (TEST_BENCH_BUSY_MAX_BIAS_US * gl_u32_test_cycles_per_us))
+                )
+                )
+        {
+            SET_BIT(gl_u32_test_bench_failures, TEST_BENCH_FAIL_DELAY_BIAS);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+}
+
+static void test_bench_latency(void)
+{
+    st_systick_periodic_stats_t st_stats = {0};
+
+    systick_start_periodic(TEST_BENCH_LATENCY_PERIOD_US, &test_bench_latency_cb, NULL_PTR);
+
+    while(gl_u32_test_latency_samples < TEST_BENCH_LATENCY_SAMPLES)
+    {
+        systick_ms_delay(1);
+    }
+
+    systick_stop_periodic();
+    systick_get_periodic_stats(&st_stats);
+    gl_st_test_periodic_stats.u32_overruns = st_stats.u32_overruns;
+    gl_st_test_periodic_stats.u32_missed_ticks = st_stats.u32_missed_ticks;
+
+    if(gl_u32_test_latency_max_us > TEST_BENCH_MAX_LATENCY_US)
+    {
+        SET_BIT(gl_u32_test_bench_failures, TEST_BENCH_FAIL_LATENCY);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    if(
+            (ZERO != st_stats.u32_overruns) ||
+            (ZERO != st_stats.u32_missed_ticks)
+            )
+    {
+        SET_BIT(gl_u32_test_bench_failures, TEST_BENCH_FAIL_OVERRUN);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+static void test_bench_drift(void)
+{
+    uint32_t_ u32_start_cycles = DWT->CYCCNT;
+    uint64_t_ u64_start_us = systick_now_us();
+    uint64_t_ u64_ref_us;
+    sint64_t_ s64_diff_us;
+
+    systick_ms_delay(TEST_BENCH_DRIFT_MS);
+
+    u64_ref_us = (DWT->CYCCNT - u32_start_cycles) / gl_u32_test_cycles_per_us;
+    s64_diff_us = (sint64_t_) (systick_now_us() - u64_start_us) - (sint64_t_) u64_ref_us;
+    gl_s32_test_drift_ppm = (sint32_t_) ((s64_diff_us * 1000000) / (sint64_t_) u64_ref_us);
+
+    if(
+            (gl_s32_test_drift_ppm > TEST_BENCH_MAX_DRIFT_PPM(gl_en_test_bench_clk_src)) ||
+            (gl_s32_test_drift_ppm < -TEST_BENCH_MAX_DRIFT_PPM(gl_en_test_bench_clk_src))
+            )
+    {
+        SET_BIT(gl_u32_test_bench_failures, TEST_BENCH_FAIL_DRIFT);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/*
+ * Runs the benchmark on one clock source, returns gl_u32_test_bench_failures (0: no regression).
+ * Systick is initialized once, so this runs once per reset (per process).
+ */
+static uint32_t_ test_systick_bench_run(en_systick_clk_src_t en_a_clk_src)
+{
+    gl_en_test_bench_clk_src = en_a_clk_src;
+    gl_st_systick_cfg_0.en_systick_clk_src = en_a_clk_src;
+    systick_init(&gl_st_systick_cfg_0); // enables the cycle counter
+
+    // reference clock as configured (SystemCoreClock is refreshed by systick_init)
+    gl_u32_test_cycles_per_us = SystemCoreClock / 1000000;
+    gl_u32_test_ticks_per_us = (CLK_SRC_PIOSC == en_a_clk_src) ? (PIOSC_MHZ / 4) : gl_u32_test_cycles_per_us;
+
+    // drift first, the delays of the systick clock are checked against its measured rate
+    test_bench_drift();
+    test_bench_delays();
+    test_bench_latency();
+
+    return gl_u32_test_bench_failures;
+}
+
+typedef struct
+{
+    const char * name;
+    en_systick_clk_src_t en_clk_src;
+    uint32_t_ u32_core_hz;
+    int32_t s32_piosc_ppm;
+} st_bench_systick_run_t;
+
+static void bench_systick_print(const st_bench_systick_run_t * ptr_st_a_run, uint32_t_ u32_a_failures)
+{
+    printf("== %s, core %lu Hz, PIOSC %+d ppm: failures 0x%02X\n", ptr_st_a_run->name,
+           (unsigned long) ptr_st_a_run->u32_core_hz, ptr_st_a_run->s32_piosc_ppm, u32_a_failures);
+    printf("drift %+d ppm (max %d)\n", gl_s32_test_drift_ppm, TEST_BENCH_MAX_DRIFT_PPM(ptr_st_a_run->en_clk_src));
+
+    printf("%10s %4s %14s %14s %14s %12s\n", "delay us", "api", "min err us", "max err us", "mean err us",
+           "max allowed");
+    for(uint32_t_ u32_idx = 0; u32_idx < TEST_BENCH_DELAY_COUNT; u32_idx++)
+    {
+        const st_test_delay_result_t * ptr_st_result = &gl_arr_st_test_delay_results[u32_idx];
+        boolean bool_busy = ((FALSE == ptr_st_result->bool_ms_api) &&
+                             (ptr_st_result->u32_delay_us <= SYSTICK_US_BUSY_WAIT_MAX)) ? TRUE : FALSE;
+
+        printf("%10u %4s %14.3f %14.3f %14.3f %12u\n", ptr_st_result->u32_delay_us,
+               (TRUE == ptr_st_result->bool_ms_api) ? "ms" : "us",
+               (double) ptr_st_result->s32_min_err_cycles / gl_u32_test_cycles_per_us,
+               (double) ptr_st_result->s32_max_err_cycles / gl_u32_test_cycles_per_us,
+               (double) ptr_st_result->s32_mean_err_cycles / gl_u32_test_cycles_per_us,
+               (TRUE == bool_busy) ? TEST_BENCH_BUSY_MAX_ERR_US : TEST_BENCH_WAKE_MAX_ERR_US);
+    }
+
+    printf("callback latency: max %u us, histogram (<1 <2 <4 <8 <16 >=16 us):", gl_u32_test_latency_max_us);
+    for(uint8_t_ u8_bin = 0; u8_bin < TEST_BENCH_LATENCY_BINS; u8_bin++)
+    {
+        printf(" %u", gl_arr_u32_test_latency_hist[u8_bin]);
+    }
+    printf(", overruns %u, missed ticks %u\n", gl_st_test_periodic_stats.u32_overruns,
+           gl_st_test_periodic_stats.u32_missed_ticks);
+    printf("%u wake-ups, %u systick interrupts\n", host_core_wakeups(), host_core_irq_count(SysTick_IRQn));
+}
+
+int main(void)
+{
+    // PIOSC off by a few thousand ppm, within its +-1% trim, so the drift compensation is exercised
+    const st_bench_systick_run_t arr_st_runs[] = {
+        {"PIOSC/4",    CLK_SRC_PIOSC,   16000000UL,  2500},
+        {"PIOSC/4",    CLK_SRC_PIOSC,   80000000UL, -4000},
+        {"system clock", CLK_SRC_SYS_CLK, 16000000UL,  0},
+        {"system clock", CLK_SRC_SYS_CLK, 80000000UL,  0},
+    };
+
+    for(uint8_t_ u8_run = 0; u8_run < sizeof(arr_st_runs) / sizeof(arr_st_runs[0]); u8_run++)
+    {
+        pid_t s32_pid;
+        int s32_status = 0;
+
+        fflush(stdout);
+        s32_pid = fork();
+
+        if(0 == s32_pid)
+        {
+            uint32_t_ u32_failures;
+
+            host_core_reset(arr_st_runs[u8_run].u32_core_hz, arr_st_runs[u8_run].s32_piosc_ppm);
+            u32_failures = test_systick_bench_run(arr_st_runs[u8_run].en_clk_src);
+            bench_systick_print(&arr_st_runs[u8_run], u32_failures);
+            fflush(stdout);
+            _exit((0 == u32_failures) ? 0 : 1);
+        }
+        else
+        {
+            TEST_CHECK(s32_pid > 0);
+            TEST_CHECK(s32_pid == waitpid(s32_pid, &s32_status, 0));
+            TEST_CHECK(WIFEXITED(s32_status) && (0 == WEXITSTATUS(s32_status)));
+        }
+    }
+
+    return TEST_REPORT();
+}
@@ -0,0 +1,139 @@
+/**
+ * @file    :   TM4C123.h
+ * @brief   :   Host build stand-in for the CMSIS device header, only the part the drivers use.
+ *              The core registers (SysTick, SCB, DWT) belong to the simulated core of host_core.c:
+ *              every access advances its clock, so busy loops make progress and pending systick
+ *              interrupts are taken at the access (see host_core.h)
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef TM4C123_H
+#define TM4C123_H
+
+#include <stdint.h>
+
+/*----------------------------------------------------------/
+/- INTERRUPT NUMBERS
+/----------------------------------------------------------*/
+typedef enum{
+    SysTick_IRQn    =   -1  ,
+    GPIOA_IRQn      =   0   ,
+    GPIOB_IRQn      =   1   ,
+    GPIOC_IRQn      =   2   ,
+    GPIOD_IRQn      =   3   ,
+    GPIOE_IRQn      =   4   ,
+    TIMER0A_IRQn    =   19  ,
+    TIMER0B_IRQn    =   20  ,
+    TIMER1A_IRQn    =   21  ,
+    TIMER1B_IRQn    =   22  ,
+    TIMER2A_IRQn    =   23  ,
+    TIMER2B_IRQn    =   24  ,
+    GPIOF_IRQn      =   30  ,
+    TIMER3A_IRQn    =   35  ,
+    TIMER3B_IRQn    =   36  ,
+    TIMER4A_IRQn    =   70  ,
+    TIMER4B_IRQn    =   71  ,
+    TIMER5A_IRQn    =   92  ,
+    TIMER5B_IRQn    =   93  ,
+    WTIMER0A_IRQn   =   94  ,
+    WTIMER0B_IRQn   =   95  ,
+    WTIMER1A_IRQn   =   96  ,
+    WTIMER1B_IRQn   =   97  ,
+    WTIMER2A_IRQn   =   98  ,
+    WTIMER2B_IRQn   =   99  ,
+    WTIMER3A_IRQn   =   100 ,
+    WTIMER3B_IRQn   =   101 ,
+    WTIMER4A_IRQn   =   102 ,
+    WTIMER4B_IRQn   =   103 ,
+    WTIMER5A_IRQn   =   104 ,
+    WTIMER5B_IRQn   =   105 ,
+    PWM1_2_IRQn     =   136 ,
+    PWM1_3_IRQn     =   137 ,
+}IRQn_Type;
+
+#define __NVIC_PRIO_BITS    3
+
+/*----------------------------------------------------------/
+/- CORE REGISTER BLOCKS
+/----------------------------------------------------------*/
+typedef struct{
+    volatile uint32_t CTRL;
+    volatile uint32_t LOAD;
+    volatile uint32_t VAL;
+    volatile uint32_t CALIB;
+}SysTick_Type;
+
+typedef struct{
+    volatile uint32_t CPUID;
+    volatile uint32_t ICSR;
+    volatile uint32_t VTOR;
+    volatile uint32_t AIRCR;
+    volatile uint32_t SCR;
+    volatile uint32_t CCR;
+    volatile uint32_t CPACR;
+}SCB_Type;
+
+typedef struct{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+}DWT_Type;
+
+typedef struct{
+    volatile uint32_t DHCSR;
+    volatile uint32_t DCRSR;
+    volatile uint32_t DCRDR;
+    volatile uint32_t DEMCR;
+}CoreDebug_Type;
+
+SysTick_Type * host_core_systick(void);
+SCB_Type * host_core_scb(void);
+DWT_Type * host_core_dwt(void);
+extern CoreDebug_Type gl_st_host_core_debug;
+
+#define SysTick     (host_core_systick())
+#define SCB         (host_core_scb())
+#define DWT         (host_core_dwt())
+#define CoreDebug   (&gl_st_host_core_debug)
+
+#define SysTick_CTRL_ENABLE_Msk         (1UL << 0)
+#define SysTick_CTRL_TICKINT_Msk        (1UL << 1)
+#define SysTick_CTRL_CLKSOURCE_Msk      (1UL << 2)
+#define SysTick_CTRL_COUNTFLAG_Msk      (1UL << 16)
+#define SCB_ICSR_PENDSTCLR_Msk          (1UL << 25)
+#define SCB_ICSR_PENDSTSET_Msk          (1UL << 26)
+#define SCB_SCR_SLEEPDEEP_Msk           (1UL << 2)
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk      (1UL << 24)
+
+/*----------------------------------------------------------/
+/- NVIC AND CORE INTRINSICS
+/----------------------------------------------------------*/
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority);
+uint32_t NVIC_GetPriority(IRQn_Type IRQn);
+void NVIC_EnableIRQ(IRQn_Type IRQn);
+void NVIC_DisableIRQ(IRQn_Type IRQn);
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn);
+
+void __enable_irq(void);
+void __disable_irq(void);
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t priMask);
+uint32_t __get_BASEPRI(void);
+void __set_BASEPRI(uint32_t basePri);
+
+void __WFI(void);
+void __DSB(void);
+void __ISB(void);
+void __DMB(void);
+void __NOP(void);
+uint8_t __CLZ(uint32_t value);
+
+/*----------------------------------------------------------/
+/- SYSTEM
+/----------------------------------------------------------*/
+extern uint32_t SystemCoreClock;
+void SystemCoreClockUpdate(void);
+
+#endif //TM4C123_H
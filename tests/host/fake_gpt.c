@@ -0,0 +1,117 @@
+/**
+ * @file    :   fake_gpt.c
+ * @brief   :   Stand-in for the GPT driver (see fake_gpt.h)
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "fake_gpt.h"
+#include "host_core.h"
+
+// the interval running now, the one latched on the coming time-out (TnILD) and the time-out it ends at
+static uint32_t_ gl_u32_fake_gpt_running_ticks = 0;
+static uint32_t_ gl_u32_fake_gpt_queued_ticks = 0;
+static uint64_t_ gl_u64_fake_gpt_timeout_at = 0;
+static fun_gpt_cb_t gl_fun_ptr_fake_gpt_cb = NULL_PTR;
+static void * gl_ptr_v_fake_gpt_ctx = NULL_PTR;
+
+void fake_gpt_reset(void)
+{
+    gl_u32_fake_gpt_running_ticks = 0;
+    gl_u32_fake_gpt_queued_ticks = 0;
+    gl_u64_fake_gpt_timeout_at = 0;
+    gl_fun_ptr_fake_gpt_cb = NULL_PTR;
+    gl_ptr_v_fake_gpt_ctx = NULL_PTR;
+}
+
+uint64_t_ fake_gpt_timeout_at(void)
+{
+    return gl_u64_fake_gpt_timeout_at;
+}
+
+void fake_gpt_timeout(void)
+{
+    uint64_t_ u64_now = host_core_cycles();
+
+    if(gl_u64_fake_gpt_timeout_at > u64_now)
+    {
+        host_core_spend(gl_u64_fake_gpt_timeout_at - u64_now);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    gl_u32_fake_gpt_running_ticks = gl_u32_fake_gpt_queued_ticks;
+    gl_u64_fake_gpt_timeout_at += gl_u32_fake_gpt_running_ticks;
+
+    if(NULL_PTR != gl_fun_ptr_fake_gpt_cb)
+    {
+        gl_fun_ptr_fake_gpt_cb(gl_ptr_v_fake_gpt_ctx);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+uint32_t_ fake_gpt_running_ticks(void)
+{
+    return gl_u32_fake_gpt_running_ticks;
+}
+
+uint32_t_ fake_gpt_queued_ticks(void)
+{
+    return gl_u32_fake_gpt_queued_ticks;
+}
+
+// the driver API used by the software PWM engine and the LED bit angle modulation
+en_gpt_error_t gpt_init(const st_gpt_cfg_t * ptr_st_a_gpt_cfg)
+{
+    return GPT_OK;
+}
+
+en_gpt_error_t gpt_set_callback(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel,
+                                fun_gpt_cb_t fun_ptr_a_cb, void * ptr_v_a_ctx)
+{
+    gl_fun_ptr_fake_gpt_cb = fun_ptr_a_cb;
+    gl_ptr_v_fake_gpt_ctx = ptr_v_a_ctx;
+    return GPT_OK;
+}
+
+en_gpt_error_t gpt_start(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel,
+                         uint32_t_ u32_a_time, en_gpt_time_unit_t en_a_unit)
+{
+    gl_u32_fake_gpt_running_ticks = u32_a_time * GPT_CLOCK_MHZ;
+    gl_u32_fake_gpt_queued_ticks = gl_u32_fake_gpt_running_ticks;
+    gl_u64_fake_gpt_timeout_at = host_core_cycles() + gl_u32_fake_gpt_running_ticks;
+    return GPT_OK;
+}
+
+en_gpt_error_t gpt_stop(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel)
+{
+    return GPT_OK;
+}
+
+en_gpt_error_t gpt_set_next_period(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel, uint32_t_ u32_a_ticks)
+{
+    gl_u32_fake_gpt_queued_ticks = u32_a_ticks;
+    return (ZERO == u32_a_ticks) ? GPT_INVALID_ARGS : GPT_OK;
+}
+
+en_gpt_error_t gpt_set_pwm_duty(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel,
+                                uint16_t_ u16_a_duty_permille)
+{
+    return GPT_OK;
+}
+
+en_gpt_error_t gpt_enable_interrupt(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel)
+{
+    return GPT_OK;
+}
+
+en_gpt_error_t gpt_disable_interrupt(en_gpt_timer_t en_a_timer, en_gpt_channel_t en_a_channel)
+{
+    return GPT_OK;
+}
@@ -0,0 +1,44 @@
+/**
+ * @file    :   fake_gpt.h
+ * @brief   :   Stand-in for the GPT driver: one periodic timer channel whose time-outs the test runs itself, the
+ *              callback is called as from the channel interrupt
+ * @version :   0.1
+ *
+ * @note    :   A timer tick is a core cycle of the simulated core, as on the target where the timers run on the
+ *              system clock (host_core_reset at GPT_CLOCK_MHZ). Every timer and channel maps to the same channel
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef FAKE_GPT_H
+#define FAKE_GPT_H
+
+#include "gpt_interface.h"
+
+/**
+ * @brief                       : Drops the callback and the running / queued intervals
+ */
+void fake_gpt_reset(void);
+
+/**
+ * @brief                       : Core cycle of the coming time-out (host_core_cycles time)
+ */
+uint64_t_ fake_gpt_timeout_at(void);
+
+/**
+ * @brief                       : Runs the core up to the coming time-out, loads the queued interval as the hardware
+ *                                does (TnILD), then calls the callback
+ */
+void fake_gpt_timeout(void);
+
+/**
+ * @brief                       : Interval loaded on the last time-out (gpt_start: the first one)
+ */
+uint32_t_ fake_gpt_running_ticks(void);
+
+/**
+ * @brief                       : Interval latched on the coming time-out (gpt_set_next_period)
+ */
+uint32_t_ fake_gpt_queued_ticks(void);
+
+#endif //FAKE_GPT_H
@@ -0,0 +1,74 @@
+/**
+ * @file    :   fake_systick.c
+ * @brief   :   Stand-in for the free running SysTick driver (see fake_systick.h)
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "fake_systick.h"
+
+static uint64_t_ gl_u64_fake_systick_now_ms = 0;
+static boolean gl_bool_fake_systick_running = FALSE;
+static fun_systick_subscriber_t gl_fun_ptr_fake_systick_tick_cb = NULL_PTR;
+static void * gl_ptr_v_fake_systick_tick_ctx = NULL_PTR;
+
+void fake_systick_reset(uint64_t_ u64_a_now_ms, boolean bool_a_running)
+{
+    gl_u64_fake_systick_now_ms = u64_a_now_ms;
+    gl_bool_fake_systick_running = bool_a_running;
+    gl_fun_ptr_fake_systick_tick_cb = NULL_PTR;
+    gl_ptr_v_fake_systick_tick_ctx = NULL_PTR;
+}
+
+static void fake_systick_tick(void)
+{
+    if(NULL_PTR != gl_fun_ptr_fake_systick_tick_cb)
+    {
+        gl_fun_ptr_fake_systick_tick_cb(gl_ptr_v_fake_systick_tick_ctx);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+void fake_systick_advance(uint64_t_ u64_a_ms)
+{
+    for(uint64_t_ u64_ms = 0; u64_ms < u64_a_ms; u64_ms++)
+    {
+        gl_u64_fake_systick_now_ms++;
+        fake_systick_tick();
+    }
+}
+
+void fake_systick_jump_to(uint64_t_ u64_a_now_ms)
+{
+    gl_u64_fake_systick_now_ms = u64_a_now_ms;
+    fake_systick_tick();
+}
+
+// the driver API used by the software timer
+en_systick_error_t systick_subscribe(en_systick_event_t en_a_event, fun_systick_subscriber_t fun_ptr_a_cb,
+                                     void * ptr_v_a_ctx)
+{
+    en_systick_error_t en_systick_error_retval = ST_OK;
+
+    if((FALSE == gl_bool_fake_systick_running) || (SYSTICK_EVENT_TICK != en_a_event) ||
+       (NULL_PTR != gl_fun_ptr_fake_systick_tick_cb))
+    {
+        en_systick_error_retval = ST_INVALID_CONFIG;
+    }
+    else
+    {
+        gl_fun_ptr_fake_systick_tick_cb = fun_ptr_a_cb;
+        gl_ptr_v_fake_systick_tick_ctx = ptr_v_a_ctx;
+    }
+
+    return en_systick_error_retval;
+}
+
+uint64_t_ systick_now_ms(void)
+{
+    return gl_u64_fake_systick_now_ms;
+}
@@ -0,0 +1,33 @@
+/**
+ * @file    :   fake_systick.h
+ * @brief   :   Stand-in for the free running SysTick driver: the test owns the ms uptime and runs the tick
+ *              subscriber itself
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef FAKE_SYSTICK_H
+#define FAKE_SYSTICK_H
+
+#include "systick_interface.h"
+
+/**
+ * @brief                       : Sets the uptime and whether systick_subscribe accepts (free running) or
+ *                                fails (not initialized), drops any subscriber
+ */
+void fake_systick_reset(uint64_t_ u64_a_now_ms, boolean bool_a_running);
+
+/**
+ * @brief                       : Moves the uptime forward one ms at a time with a tick on each, as the
+ *                                periodic tick does
+ */
+void fake_systick_advance(uint64_t_ u64_a_ms);
+
+/**
+ * @brief                       : Jumps the uptime to a later ms and ticks once, as the first tick after
+ *                                a tickless idle does
+ */
+void fake_systick_jump_to(uint64_t_ u64_a_now_ms);
+
+#endif //FAKE_SYSTICK_H
@@ -0,0 +1,121 @@
+/**
+ * @file    :   gpio_host.c
+ * @brief   :   RAM backed GPIO ports of the host build (GPIO_HOST_REGS): a register block per port and bus,
+ *              RCGCGPIO, GPIOHBCTL and the address masked DATA aliases
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "bit_math.h"
+#include "gpio_interface.h"
+#include "gpio_private.h"
+#include "gpio_host.h"
+#include "host_core.h"
+
+/* Register block of each port on each bus */
+st_gpio_regs_t gl_arr_st_gpio_host_regs[GPIO_BUS_TOTAL][GPIO_PORT_TOTAL];
+
+volatile uint32_t_ gl_u32_gpio_host_rcgcgpio  = 0;
+volatile uint32_t_ gl_u32_gpio_host_gpiohbctl = 0;
+
+volatile uint8_t_ gl_arr_u8_gpio_host_pins[GPIO_PORT_TOTAL] = {0};
+volatile uint32_t_ gl_u32_gpio_host_data_accesses = 0;
+
+/* Register block and alias of the last DATA access, per port */
+static st_gpio_regs_t* gl_arr_ptr_st_gpio_host_data_regs[GPIO_PORT_TOTAL] = {NULL_PTR};
+static uint8_t_ gl_arr_u8_gpio_host_data_mask[GPIO_PORT_TOTAL] = {0};
+
+/* Core cycle of the last DATA access, the pin levels are accounted up to a cycle, high cycles of each pin */
+static uint64_t_ gl_arr_u64_gpio_host_access_cycles[GPIO_PORT_TOTAL] = {0};
+static uint64_t_ gl_arr_u64_gpio_host_level_cycles[GPIO_PORT_TOTAL] = {0};
+static uint64_t_ gl_arr_u64_gpio_host_high_cycles[GPIO_PORT_TOTAL][GPIO_PIN_TOTAL];
+
+/**
+ * @brief                       : Adds the time since the last accounting to the high cycles of the high pins
+ */
+static void gpio_host_account(uint8_t_ u8_a_port, uint64_t_ u64_a_until)
+{
+    uint8_t_ u8_pin;
+
+    for(u8_pin = 0; u8_pin < GPIO_PIN_TOTAL; u8_pin++)
+    {
+        if(GET_BIT(gl_arr_u8_gpio_host_pins[u8_a_port], u8_pin))
+        {
+            gl_arr_u64_gpio_host_high_cycles[u8_a_port][u8_pin] += u64_a_until -
+                                                                   gl_arr_u64_gpio_host_level_cycles[u8_a_port];
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    gl_arr_u64_gpio_host_level_cycles[u8_a_port] = u64_a_until;
+}
+
+/**
+ * @brief                       : Accesses the masked DATA alias of a port
+ *
+ *                                On the target, address bits [9:2] of a GPIODATA access mask the pins it reads
+ *                                or writes. In RAM every alias is a separate word, and a store can only go
+ *                                through the word returned by the last access, so each access first folds that
+ *                                word into the output pins under its mask, then returns the new alias word
+ *                                loaded with the masked pin levels
+ *
+ * @param[in]   u8_a_port       : The port to access
+ * @param[in]   u8_a_mask       : The alias (pin mask) to access
+ *
+ * @return                      : Pointer to the alias word, valid until the next access
+ */
+volatile uint32_t_* gpio_host_data(uint8_t_ u8_a_port, uint8_t_ u8_a_mask)
+{
+    st_gpio_regs_t* ptr_st_regs = GPIO_REGS(u8_a_port);
+    st_gpio_regs_t* ptr_st_last_regs = gl_arr_ptr_st_gpio_host_data_regs[u8_a_port];
+    uint8_t_ u8_last_mask = gl_arr_u8_gpio_host_data_mask[u8_a_port];
+    uint8_t_ u8_written;
+
+    gl_u32_gpio_host_data_accesses++;
+
+    /* Fold from the block of the last access (the other bus' block right after a bus change) */
+    if(NULL_PTR != ptr_st_last_regs)
+    {
+        /* The levels held until the store, which went with the last access */
+        gpio_host_account(u8_a_port, gl_arr_u64_gpio_host_access_cycles[u8_a_port]);
+
+        /* Only output pins under the alias mask take the written value */
+        u8_written = u8_last_mask & (uint8_t_) ptr_st_last_regs->DIR;
+
+        gl_arr_u8_gpio_host_pins[u8_a_port] = (gl_arr_u8_gpio_host_pins[u8_a_port] & ~u8_written) |
+                                              ((uint8_t_) ptr_st_last_regs->DATA[u8_last_mask] & u8_written);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    gl_arr_ptr_st_gpio_host_data_regs[u8_a_port] = ptr_st_regs;
+    gl_arr_u8_gpio_host_data_mask[u8_a_port] = u8_a_mask;
+    gl_arr_u64_gpio_host_access_cycles[u8_a_port] = host_core_cycles();
+
+    ptr_st_regs->DATA[u8_a_mask] = gl_arr_u8_gpio_host_pins[u8_a_port] & u8_a_mask;
+
+    return &ptr_st_regs->DATA[u8_a_mask];
+}
+
+/**
+ * @brief                       : Core cycles a pin was driven high (host_core time)
+ *
+ * @param[in]   u8_a_port       : The port of the pin
+ * @param[in]   u8_a_pin        : The pin
+ *
+ * @return                      : High cycles since start, up to now
+ */
+uint64_t_ gpio_host_high_cycles(uint8_t_ u8_a_port, uint8_t_ u8_a_pin)
+{
+    /* Take the last store, then the levels up to now */
+    (void) gpio_host_data(u8_a_port, 0);
+    gpio_host_account(u8_a_port, host_core_cycles());
+
+    return gl_arr_u64_gpio_host_high_cycles[u8_a_port][u8_a_pin];
+}
@@ -0,0 +1,25 @@
+/**
+ * @file    :   gpio_host.h
+ * @brief   :   RAM backed GPIO ports of the host build (GPIO_HOST_REGS): pin levels, their high time and the DATA
+ *              access count
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef GPIO_HOST_H
+#define GPIO_HOST_H
+
+#include "std.h"
+#include "gpio_interface.h"
+
+/* Pin levels of each port, shared by both bus apertures, inputs are driven by writing them */
+extern volatile uint8_t_ gl_arr_u8_gpio_host_pins[GPIO_PORT_TOTAL];
+
+/* DATA register accesses since start, the benchmarks count them per call */
+extern volatile uint32_t_ gl_u32_gpio_host_data_accesses;
+
+/* Core cycles a pin was driven high since start (host_core time), a DATA store takes effect at its access */
+uint64_t_ gpio_host_high_cycles(uint8_t_ u8_a_port, uint8_t_ u8_a_pin);
+
+#endif
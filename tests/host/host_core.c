@@ -0,0 +1,558 @@
+/**
+ * @file    :   host_core.c
+ * @brief   :   Simulated Cortex-M4 core for the host tests (see host_core.h)
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_core.h"
+
+#define HOST_CORE_IRQ_OFFSET        16      // NVIC table index of IRQn 0 (core exceptions below)
+#define HOST_CORE_IRQ_TOTAL         (HOST_CORE_IRQ_OFFSET + 160)
+#define HOST_CORE_THREAD_PRIO       (1UL << __NVIC_PRIO_BITS)     // below every interrupt priority
+#define HOST_CORE_NO_EVENT          UINT64_MAX
+
+#define HOST_CORE_STLOAD_MASK       0x00FFFFFFUL
+
+// systick handler of the driver, missing from tests that do not link it
+void SysTick_Handler(void) __attribute__((weak));
+
+typedef struct{
+    uint64_t    u64_cycles;
+    uint32_t    u32_core_hz;
+    int32_t     s32_piosc_ppm;
+
+    // systick counter, registers as last exposed to the code (a difference is a write)
+    uint32_t    u32_current;
+    uint32_t    u32_exposed_val;
+    uint32_t    u32_exposed_cyccnt;
+    uint32_t    u32_cyccnt_offset;
+    uint8_t     u8_pendst;
+
+    // interrupt masking and the priority of the running context
+    uint32_t    u32_primask;
+    uint32_t    u32_basepri;
+    uint32_t    u32_active_prio;
+
+    // NVIC
+    uint8_t     arr_u8_prio[HOST_CORE_IRQ_TOTAL];
+    uint8_t     arr_u8_enabled[HOST_CORE_IRQ_TOTAL];
+    uint32_t    arr_u32_irq_count[HOST_CORE_IRQ_TOTAL];
+
+    // one external interrupt source
+    IRQn_Type           en_ext_irq;
+    fun_host_core_isr_t fun_ptr_ext_isr;
+    uint64_t            u64_ext_at_cycles;
+    uint8_t             u8_ext_pending;
+
+    uint32_t    u32_wakeups;
+}st_host_core_t;
+
+static st_host_core_t gl_st_host_core;
+
+static SysTick_Type gl_st_host_systick;
+static SCB_Type gl_st_host_scb;
+static DWT_Type gl_st_host_dwt;
+CoreDebug_Type gl_st_host_core_debug;
+
+uint32_t SystemCoreClock = 16000000UL;
+
+/*---------------------------------------------------------/
+/- CLOCKS
+/---------------------------------------------------------*/
+/**
+ * @brief                       : Systick clock edges from reset to a core cycle, for the selected source
+ */
+static uint64_t host_core_systick_edges(uint64_t u64_a_cycles)
+{
+    uint64_t u64_edges = u64_a_cycles;
+
+    if(0 == (gl_st_host_systick.CTRL & SysTick_CTRL_CLKSOURCE_Msk))
+    {
+        // PIOSC / 4
+        unsigned __int128 u128_num = (unsigned __int128) (HOST_CORE_PIOSC_HZ / 4) *
+                                     (uint64_t) (1000000LL + gl_st_host_core.s32_piosc_ppm);
+        unsigned __int128 u128_den = (unsigned __int128) gl_st_host_core.u32_core_hz * 1000000ULL;
+
+        u64_edges = (uint64_t) (((unsigned __int128) u64_a_cycles * u128_num) / u128_den);
+    }
+
+    return u64_edges;
+}
+
+/**
+ * @brief                       : First core cycle at which a number of systick clock edges have elapsed
+ */
+static uint64_t host_core_edges_to_cycles(uint64_t u64_a_edges)
+{
+    uint64_t u64_cycles = u64_a_edges;
+
+    if(0 == (gl_st_host_systick.CTRL & SysTick_CTRL_CLKSOURCE_Msk))
+    {
+        unsigned __int128 u128_num = (unsigned __int128) (HOST_CORE_PIOSC_HZ / 4) *
+                                     (uint64_t) (1000000LL + gl_st_host_core.s32_piosc_ppm);
+        unsigned __int128 u128_den = (unsigned __int128) gl_st_host_core.u32_core_hz * 1000000ULL;
+
+        u64_cycles = (uint64_t) ((((unsigned __int128) u64_a_edges * u128_den) + u128_num - 1) / u128_num);
+    }
+
+    return u64_cycles;
+}
+
+/**
+ * @brief                       : Counts systick clock edges: reaching 0 pends the interrupt, the next edge reloads
+ */
+static void host_core_systick_count(uint64_t u64_a_edges)
+{
+    while(u64_a_edges > 0)
+    {
+        if(0 == gl_st_host_core.u32_current)
+        {
+            gl_st_host_core.u32_current = gl_st_host_systick.LOAD & HOST_CORE_STLOAD_MASK;
+            u64_a_edges--;
+
+            if(0 == gl_st_host_core.u32_current)
+            {
+                // a reload value of 0 stops the counter
+                u64_a_edges = 0;
+            }
+        }
+        else if(u64_a_edges >= gl_st_host_core.u32_current)
+        {
+            u64_a_edges -= gl_st_host_core.u32_current;
+            gl_st_host_core.u32_current = 0;
+            gl_st_host_systick.CTRL |= SysTick_CTRL_COUNTFLAG_Msk;
+
+            if(gl_st_host_systick.CTRL & SysTick_CTRL_TICKINT_Msk)
+            {
+                gl_st_host_core.u8_pendst = 1;
+            }
+        }
+        else
+        {
+            gl_st_host_core.u32_current -= (uint32_t) u64_a_edges;
+            u64_a_edges = 0;
+        }
+    }
+}
+
+/**
+ * @brief                       : Moves the core clock forward, systick counts if enabled
+ */
+static void host_core_advance(uint64_t u64_a_cycles)
+{
+    uint64_t u64_from = gl_st_host_core.u64_cycles;
+
+    gl_st_host_core.u64_cycles += u64_a_cycles;
+
+    if(gl_st_host_systick.CTRL & SysTick_CTRL_ENABLE_Msk)
+    {
+        host_core_systick_count(host_core_systick_edges(gl_st_host_core.u64_cycles) -
+                                host_core_systick_edges(u64_from));
+    }
+
+    if(
+            (NULL != gl_st_host_core.fun_ptr_ext_isr) &&
+            (gl_st_host_core.u64_cycles >= gl_st_host_core.u64_ext_at_cycles)
+            )
+    {
+        gl_st_host_core.u8_ext_pending = 1;
+        gl_st_host_core.u64_ext_at_cycles = HOST_CORE_NO_EVENT;
+    }
+}
+
+/**
+ * @brief                       : Core cycle of the next interrupt event (systick reaching 0, external line)
+ */
+static uint64_t host_core_next_event(void)
+{
+    uint64_t u64_next = gl_st_host_core.u64_ext_at_cycles;
+    uint32_t u32_ctrl = gl_st_host_systick.CTRL;
+
+    if(
+            (u32_ctrl & SysTick_CTRL_ENABLE_Msk) &&
+            (u32_ctrl & SysTick_CTRL_TICKINT_Msk)
+            )
+    {
+        uint32_t u32_load = gl_st_host_systick.LOAD & HOST_CORE_STLOAD_MASK;
+        uint64_t u64_edges = (0 != gl_st_host_core.u32_current) ? gl_st_host_core.u32_current :
+                             ((0 != u32_load) ? (1ULL + u32_load) : 0);
+
+        if(0 != u64_edges)
+        {
+            uint64_t u64_at = host_core_edges_to_cycles(host_core_systick_edges(gl_st_host_core.u64_cycles) + u64_edges);
+
+            u64_next = (u64_at < u64_next) ? u64_at : u64_next;
+        }
+    }
+
+    return u64_next;
+}
+
+/*---------------------------------------------------------/
+/- REGISTERS
+/---------------------------------------------------------*/
+/**
+ * @brief                       : Applies the register writes made since the last access
+ */
+static void host_core_apply_writes(void)
+{
+    if(gl_st_host_systick.VAL != gl_st_host_core.u32_exposed_val)
+    {
+        // any write clears the counter and the count flag
+        gl_st_host_core.u32_current = 0;
+        gl_st_host_systick.CTRL &= ~SysTick_CTRL_COUNTFLAG_Msk;
+    }
+
+    if(gl_st_host_scb.ICSR & SCB_ICSR_PENDSTCLR_Msk)
+    {
+        gl_st_host_core.u8_pendst = 0;
+    }
+    else if(
+            (gl_st_host_scb.ICSR & SCB_ICSR_PENDSTSET_Msk) &&
+            (0 == gl_st_host_core.u8_pendst)
+            )
+    {
+        gl_st_host_core.u8_pendst = 1;
+    }
+
+    if(gl_st_host_dwt.CYCCNT != gl_st_host_core.u32_exposed_cyccnt)
+    {
+        gl_st_host_core.u32_cyccnt_offset = gl_st_host_dwt.CYCCNT - (uint32_t) gl_st_host_core.u64_cycles;
+    }
+}
+
+/**
+ * @brief                       : Publishes the live register values
+ */
+static void host_core_expose(void)
+{
+    gl_st_host_systick.VAL = gl_st_host_core.u32_current;
+    gl_st_host_core.u32_exposed_val = gl_st_host_core.u32_current;
+
+    gl_st_host_scb.ICSR = (0 != gl_st_host_core.u8_pendst) ? SCB_ICSR_PENDSTSET_Msk : 0;
+
+    gl_st_host_dwt.CYCCNT = (uint32_t) gl_st_host_core.u64_cycles + gl_st_host_core.u32_cyccnt_offset;
+    gl_st_host_core.u32_exposed_cyccnt = gl_st_host_dwt.CYCCNT;
+}
+
+/*---------------------------------------------------------/
+/- INTERRUPTS
+/---------------------------------------------------------*/
+/**
+ * @brief                       : TRUE if a pending line would preempt the running context (PRIMASK aside)
+ */
+static int host_core_can_preempt(IRQn_Type en_a_irq)
+{
+    uint32_t u32_prio = gl_st_host_core.arr_u8_prio[en_a_irq + HOST_CORE_IRQ_OFFSET];
+
+    return (u32_prio < gl_st_host_core.u32_active_prio) &&
+           (
+                   (0 == gl_st_host_core.u32_basepri) ||
+                   ((u32_prio << (8 - __NVIC_PRIO_BITS)) < gl_st_host_core.u32_basepri)
+           );
+}
+
+static int host_core_systick_wakes(void)
+{
+    return (0 != gl_st_host_core.u8_pendst) && host_core_can_preempt(SysTick_IRQn);
+}
+
+static int host_core_ext_wakes(void)
+{
+    return (0 != gl_st_host_core.u8_ext_pending) &&
+           (0 != gl_st_host_core.arr_u8_enabled[gl_st_host_core.en_ext_irq + HOST_CORE_IRQ_OFFSET]) &&
+           host_core_can_preempt(gl_st_host_core.en_ext_irq);
+}
+
+/**
+ * @brief                       : Runs a handler as an exception at its priority
+ */
+static void host_core_exception(IRQn_Type en_a_irq, fun_host_core_isr_t fun_ptr_a_isr)
+{
+    uint32_t u32_saved_prio = gl_st_host_core.u32_active_prio;
+
+    gl_st_host_core.u32_active_prio = gl_st_host_core.arr_u8_prio[en_a_irq + HOST_CORE_IRQ_OFFSET];
+    gl_st_host_core.arr_u32_irq_count[en_a_irq + HOST_CORE_IRQ_OFFSET]++;
+
+    host_core_advance(HOST_CORE_ENTRY_CYCLES);
+    host_core_expose();
+
+    if(NULL != fun_ptr_a_isr)
+    {
+        fun_ptr_a_isr();
+    }
+
+    host_core_apply_writes();
+    host_core_advance(HOST_CORE_EXIT_CYCLES);
+    host_core_expose();
+
+    gl_st_host_core.u32_active_prio = u32_saved_prio;
+}
+
+/**
+ * @brief                       : Takes every pending interrupt allowed to run, highest priority first
+ */
+static void host_core_take_irqs(void)
+{
+    int bool_taken = 1;
+
+    while(
+            (0 == gl_st_host_core.u32_primask) &&
+            (0 != bool_taken)
+            )
+    {
+        bool_taken = 0;
+
+        if(
+                host_core_systick_wakes() &&
+                (
+                        (0 == host_core_ext_wakes()) ||
+                        (gl_st_host_core.arr_u8_prio[SysTick_IRQn + HOST_CORE_IRQ_OFFSET] <=
+                         gl_st_host_core.arr_u8_prio[gl_st_host_core.en_ext_irq + HOST_CORE_IRQ_OFFSET])
+                )
+                )
+        {
+            // pending state is cleared on exception entry
+            gl_st_host_core.u8_pendst = 0;
+            host_core_exception(SysTick_IRQn, SysTick_Handler);
+            bool_taken = 1;
+        }
+        else if(host_core_ext_wakes())
+        {
+            gl_st_host_core.u8_ext_pending = 0;
+            host_core_exception(gl_st_host_core.en_ext_irq, gl_st_host_core.fun_ptr_ext_isr);
+            bool_taken = 1;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+}
+
+/**
+ * @brief                       : One register access or intrinsic: writes land, time moves, interrupts run
+ */
+static void host_core_sync(void)
+{
+    host_core_apply_writes();
+    host_core_advance(HOST_CORE_ACCESS_CYCLES);
+    host_core_expose();
+    host_core_take_irqs();
+}
+
+/*---------------------------------------------------------/
+/- API
+/---------------------------------------------------------*/
+void host_core_reset(uint32_t u32_a_core_hz, int32_t s32_a_piosc_ppm)
+{
+    memset(&gl_st_host_core, 0, sizeof(gl_st_host_core));
+    memset(&gl_st_host_systick, 0, sizeof(gl_st_host_systick));
+    memset(&gl_st_host_scb, 0, sizeof(gl_st_host_scb));
+    memset(&gl_st_host_dwt, 0, sizeof(gl_st_host_dwt));
+    memset(&gl_st_host_core_debug, 0, sizeof(gl_st_host_core_debug));
+
+    gl_st_host_core.u32_core_hz = u32_a_core_hz;
+    gl_st_host_core.s32_piosc_ppm = s32_a_piosc_ppm;
+    gl_st_host_core.u32_active_prio = HOST_CORE_THREAD_PRIO;
+    gl_st_host_core.u64_ext_at_cycles = HOST_CORE_NO_EVENT;
+
+    // STCTRL reset value: system clock source
+    gl_st_host_systick.CTRL = SysTick_CTRL_CLKSOURCE_Msk;
+
+    SystemCoreClock = u32_a_core_hz;
+    host_core_expose();
+}
+
+uint64_t host_core_cycles(void)
+{
+    return gl_st_host_core.u64_cycles;
+}
+
+void host_core_spend(uint64_t u64_a_cycles)
+{
+    uint64_t u64_end = gl_st_host_core.u64_cycles + u64_a_cycles;
+
+    host_core_apply_writes();
+
+    // stop at every interrupt event on the way, each one must be taken on time
+    while(gl_st_host_core.u64_cycles < u64_end)
+    {
+        uint64_t u64_next = host_core_next_event();
+        uint64_t u64_to = (u64_next < u64_end) ? u64_next : u64_end;
+
+        host_core_advance((u64_to > gl_st_host_core.u64_cycles) ? (u64_to - gl_st_host_core.u64_cycles) : 1);
+        host_core_expose();
+        host_core_take_irqs();
+    }
+}
+
+void host_core_raise_irq_at(IRQn_Type en_a_irq, fun_host_core_isr_t fun_ptr_a_isr, uint64_t u64_a_at_cycles)
+{
+    gl_st_host_core.en_ext_irq = en_a_irq;
+    gl_st_host_core.fun_ptr_ext_isr = fun_ptr_a_isr;
+    gl_st_host_core.u64_ext_at_cycles = u64_a_at_cycles;
+    gl_st_host_core.u8_ext_pending = 0;
+}
+
+uint32_t host_core_wakeups(void)
+{
+    return gl_st_host_core.u32_wakeups;
+}
+
+uint32_t host_core_irq_count(IRQn_Type en_a_irq)
+{
+    return gl_st_host_core.arr_u32_irq_count[en_a_irq + HOST_CORE_IRQ_OFFSET];
+}
+
+SysTick_Type * host_core_systick(void)
+{
+    host_core_sync();
+    return &gl_st_host_systick;
+}
+
+SCB_Type * host_core_scb(void)
+{
+    host_core_sync();
+    return &gl_st_host_scb;
+}
+
+DWT_Type * host_core_dwt(void)
+{
+    host_core_sync();
+    return &gl_st_host_dwt;
+}
+
+/*---------------------------------------------------------/
+/- CMSIS
+/---------------------------------------------------------*/
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority)
+{
+    gl_st_host_core.arr_u8_prio[IRQn + HOST_CORE_IRQ_OFFSET] = (uint8_t) (priority & (HOST_CORE_THREAD_PRIO - 1));
+    host_core_sync();
+}
+
+uint32_t NVIC_GetPriority(IRQn_Type IRQn)
+{
+    return gl_st_host_core.arr_u8_prio[IRQn + HOST_CORE_IRQ_OFFSET];
+}
+
+void NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+    gl_st_host_core.arr_u8_enabled[IRQn + HOST_CORE_IRQ_OFFSET] = 1;
+    host_core_sync();
+}
+
+void NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+    gl_st_host_core.arr_u8_enabled[IRQn + HOST_CORE_IRQ_OFFSET] = 0;
+    host_core_sync();
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn)
+{
+    if(IRQn == gl_st_host_core.en_ext_irq)
+    {
+        gl_st_host_core.u8_ext_pending = 0;
+    }
+    host_core_sync();
+}
+
+void __enable_irq(void)
+{
+    gl_st_host_core.u32_primask = 0;
+    host_core_sync();
+}
+
+void __disable_irq(void)
+{
+    host_core_sync();
+    gl_st_host_core.u32_primask = 1;
+}
+
+uint32_t __get_PRIMASK(void)
+{
+    host_core_sync();
+    return gl_st_host_core.u32_primask;
+}
+
+void __set_PRIMASK(uint32_t priMask)
+{
+    gl_st_host_core.u32_primask = priMask & 1;
+    host_core_sync();
+}
+
+uint32_t __get_BASEPRI(void)
+{
+    host_core_sync();
+    return gl_st_host_core.u32_basepri;
+}
+
+void __set_BASEPRI(uint32_t basePri)
+{
+    gl_st_host_core.u32_basepri = basePri & 0xFF;
+    host_core_sync();
+}
+
+void __WFI(void)
+{
+    host_core_sync();
+    gl_st_host_core.u32_wakeups++;
+
+    // sleep until an interrupt that could preempt is pending, PRIMASK does not keep the core asleep
+    while(
+            (0 == host_core_systick_wakes()) &&
+            (0 == host_core_ext_wakes())
+            )
+    {
+        uint64_t u64_next = host_core_next_event();
+
+        if(HOST_CORE_NO_EVENT == u64_next)
+        {
+            fprintf(stderr, "host_core: WFI with no wake-up source at cycle %llu\n",
+                    (unsigned long long) gl_st_host_core.u64_cycles);
+            abort();
+        }
+
+        host_core_advance((u64_next > gl_st_host_core.u64_cycles) ? (u64_next - gl_st_host_core.u64_cycles) : 1);
+        host_core_expose();
+    }
+
+    host_core_take_irqs();
+}
+
+void __DSB(void)
+{
+    host_core_sync();
+}
+
+void __ISB(void)
+{
+    host_core_sync();
+}
+
+void __DMB(void)
+{
+    host_core_sync();
+}
+
+void __NOP(void)
+{
+    host_core_sync();
+}
+
+uint8_t __CLZ(uint32_t value)
+{
+    return (0 == value) ? 32 : (uint8_t) __builtin_clz(value);
+}
+
+void SystemCoreClockUpdate(void)
+{
+    SystemCoreClock = gl_st_host_core.u32_core_hz;
+}
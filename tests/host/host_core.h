@@ -0,0 +1,70 @@
+/**
+ * @file    :   host_core.h
+ * @brief   :   Simulated Cortex-M4 core for the host tests: core clock, SysTick, DWT cycle counter,
+ *              PRIMASK/BASEPRI, NVIC priorities and WFI
+ * @version :   0.1
+ *
+ * @note    :   Time only moves on register accesses and intrinsics (HOST_CORE_ACCESS_CYCLES each), on
+ *              host_core_spend and in WFI, which jumps to the next interrupt. Register writes take effect
+ *              at the next access, interrupts are taken at accesses and when unmasked, with the M4 entry
+ *              and exit cost. The PIOSC runs off the core clock by a set ppm error, the system clock
+ *              source is the core clock itself (the DWT reference)
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef HOST_CORE_H
+#define HOST_CORE_H
+
+#include <stdint.h>
+#include "TM4C123.h"
+
+// core cycles per register access or intrinsic
+#define HOST_CORE_ACCESS_CYCLES     2
+// exception entry (stacking) and exit (unstacking) core cycles
+#define HOST_CORE_ENTRY_CYCLES      12
+#define HOST_CORE_EXIT_CYCLES       10
+
+#define HOST_CORE_PIOSC_HZ          16000000UL
+
+typedef void (*fun_host_core_isr_t)(void);
+
+/**
+ * @brief                       : Resets the simulated core, registers and NVIC
+ *
+ * @param u32_a_core_hz         : Core clock (SystemCoreClock, systick system clock source)
+ * @param s32_a_piosc_ppm       : PIOSC frequency error against the core clock
+ */
+void host_core_reset(uint32_t u32_a_core_hz, int32_t s32_a_piosc_ppm);
+
+/**
+ * @brief                       : Core cycles since reset, the reference time of the tests
+ */
+uint64_t host_core_cycles(void);
+
+/**
+ * @brief                       : Runs thread code that does not touch the registers, interrupts due in
+ *                                between are taken (unless masked)
+ */
+void host_core_spend(uint64_t u64_a_cycles);
+
+/**
+ * @brief                       : Raises an external interrupt once at a given core cycle (e.g. a GPIO edge)
+ *
+ * @param en_a_irq              : NVIC line, taken with its NVIC priority once enabled
+ * @param fun_ptr_a_isr         : Handler to run
+ * @param u64_a_at_cycles       : Core cycle the line is pended at
+ */
+void host_core_raise_irq_at(IRQn_Type en_a_irq, fun_host_core_isr_t fun_ptr_a_isr, uint64_t u64_a_at_cycles);
+
+/**
+ * @brief                       : WFI executions (each one ends with a wake-up)
+ */
+uint32_t host_core_wakeups(void);
+
+/**
+ * @brief                       : Handler runs of a line since reset (SysTick_IRQn included)
+ */
+uint32_t host_core_irq_count(IRQn_Type en_a_irq);
+
+#endif //HOST_CORE_H
@@ -0,0 +1,39 @@
+/**
+ * @file    :   host_test.h
+ * @brief   :   Minimal check/report helpers shared by the host tests (one test file per executable)
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+
+static unsigned int gl_u32_host_test_checks = 0;
+static unsigned int gl_u32_host_test_failures = 0;
+
+// records a failed condition and keeps going, so one run lists every regression
+#define TEST_CHECK(COND)                                                                    \
+    do {                                                                                    \
+        gl_u32_host_test_checks++;                                                          \
+        if(!(COND))                                                                         \
+        {                                                                                   \
+            gl_u32_host_test_failures++;                                                    \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #COND);        \
+        }                                                                                   \
+    } while(0)
+
+#define TEST_RUN(FN)                                                                        \
+    do {                                                                                    \
+        printf("-- %s\n", #FN);                                                             \
+        FN();                                                                               \
+    } while(0)
+
+// process exit code of the test executable
+#define TEST_REPORT()                                                                       \
+    (printf("%u checks, %u failed\n", gl_u32_host_test_checks, gl_u32_host_test_failures),  \
+     (0 == gl_u32_host_test_failures) ? 0 : 1)
+
+#endif //HOST_TEST_H
@@ -0,0 +1,172 @@
+/**
+ * @file    :   test_gpio.c
+ * @brief   :   Host tests of the GPIO driver on RAM backed register blocks (GPIO_HOST_REGS)
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "bit_math.h"
+#include "gpio_interface.h"
+#include "gpio_private.h"
+#include "gpio_host.h"
+
+// after the driver headers, the system headers take over the NULL of std.h
+#include "host_test.h"
+#include "host_core.h"
+
+// pin levels of a port, an access to alias 0 folds the previous store into them first
+static uint8_t_ test_gpio_pins(en_gpio_port_t en_a_port)
+{
+    (void) gpio_host_data(en_a_port, 0);
+
+    return gl_arr_u8_gpio_host_pins[en_a_port];
+}
+
+static st_gpio_cfg_t test_gpio_cfg(en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin, en_gpio_pin_cfg_t en_a_pin_cfg,
+                                   en_gpio_bus_t en_a_bus)
+{
+    st_gpio_cfg_t st_cfg = {
+        .port = en_a_port,
+        .pin = en_a_pin,
+        .pin_cfg = en_a_pin_cfg,
+        .current = PIN_CURRENT_8MA,
+        .bus = en_a_bus
+    };
+
+    return st_cfg;
+}
+
+// single pin writes go through the pin alias and leave the other pins alone
+static void test_gpio_pin_write(void)
+{
+    st_gpio_cfg_t st_cfg;
+
+    for(en_gpio_pin_t en_pin = GPIO_PIN_1; en_pin <= GPIO_PIN_3; en_pin++)
+    {
+        st_cfg = test_gpio_cfg(GPIO_PORT_F, en_pin, OUTPUT, GPIO_BUS_APB);
+        TEST_CHECK(GPIO_OK == gpio_pin_init(&st_cfg));
+    }
+
+    TEST_CHECK(GET_BIT(RCGCGPIO, GPIO_PORT_F));
+    TEST_CHECK(0x0E == (GPIODIR(GPIO_PORT_F) & 0x0E));
+    TEST_CHECK(0x0E == (GPIODEN(GPIO_PORT_F) & 0x0E));
+
+    TEST_CHECK(GPIO_OK == gpio_setPinVal(GPIO_PORT_F, GPIO_PIN_1, HIGH));
+    TEST_CHECK(0x02 == test_gpio_pins(GPIO_PORT_F));
+
+    TEST_CHECK(GPIO_OK == gpio_setPinVal(GPIO_PORT_F, GPIO_PIN_3, HIGH));
+    TEST_CHECK(0x0A == test_gpio_pins(GPIO_PORT_F));
+
+    TEST_CHECK(GPIO_OK == gpio_setPinVal(GPIO_PORT_F, GPIO_PIN_1, LOW));
+    TEST_CHECK(0x08 == test_gpio_pins(GPIO_PORT_F));
+
+    TEST_CHECK(GPIO_OK == gpio_togPinVal(GPIO_PORT_F, GPIO_PIN_2));
+    TEST_CHECK(0x0C == test_gpio_pins(GPIO_PORT_F));
+
+    TEST_CHECK(GPIO_OK == gpio_togPinVal(GPIO_PORT_F, GPIO_PIN_2));
+    TEST_CHECK(0x08 == test_gpio_pins(GPIO_PORT_F));
+}
+
+// masked writes only change the pins under the mask, reads return the masked levels
+static void test_gpio_masked_write(void)
+{
+    TEST_CHECK(GPIO_OK == gpio_setPinsMasked(GPIO_PORT_F, 0x06, PORT_SET));
+    TEST_CHECK(0x0E == test_gpio_pins(GPIO_PORT_F));
+
+    TEST_CHECK(GPIO_OK == gpio_setPinsMasked(GPIO_PORT_F, 0x0A, 0x02));
+    TEST_CHECK(0x06 == test_gpio_pins(GPIO_PORT_F));
+
+    TEST_CHECK(0x04 == GPIODATA_MASKED(GPIO_PORT_F, 0x0C));
+    TEST_CHECK(0x00 == GPIODATA_MASKED(GPIO_PORT_F, 0x08));
+
+    // bits outside the alias mask are ignored by the store
+    GPIODATA_MASKED(GPIO_PORT_F, 0x08) = PORT_SET;
+    TEST_CHECK(0x0E == test_gpio_pins(GPIO_PORT_F));
+}
+
+// inputs follow the pin level, writes do not drive them
+static void test_gpio_input(void)
+{
+    st_gpio_cfg_t st_cfg = test_gpio_cfg(GPIO_PORT_F, GPIO_PIN_4, INPUT_PULL_UP, GPIO_BUS_APB);
+    en_gpio_pin_level_t en_level = LOW;
+
+    TEST_CHECK(GPIO_OK == gpio_pin_init(&st_cfg));
+    TEST_CHECK(GET_BIT(GPIOPUR(GPIO_PORT_F), GPIO_PIN_4));
+
+    gl_arr_u8_gpio_host_pins[GPIO_PORT_F] |= (1 << GPIO_PIN_4);
+    TEST_CHECK(GPIO_OK == gpio_getPinVal(GPIO_PORT_F, GPIO_PIN_4, &en_level));
+    TEST_CHECK(HIGH == en_level);
+
+    // not all of port F is output, so clear it through the full alias
+    GPIODATA(GPIO_PORT_F) = PORT_CLR;
+    TEST_CHECK((1 << GPIO_PIN_4) == test_gpio_pins(GPIO_PORT_F));
+
+    gl_arr_u8_gpio_host_pins[GPIO_PORT_F] &= ~(1 << GPIO_PIN_4);
+    TEST_CHECK(GPIO_OK == gpio_getPinVal(GPIO_PORT_F, GPIO_PIN_4, &en_level));
+    TEST_CHECK(LOW == en_level);
+}
+
+// both apertures drive the same pins, the port is accessed through the last selected one
+static void test_gpio_bus_switch(void)
+{
+    st_gpio_cfg_t st_cfg = test_gpio_cfg(GPIO_PORT_F, GPIO_PIN_1, OUTPUT, GPIO_BUS_AHB);
+    st_gpio_regs_t* ptr_st_apb_regs = GPIO_REGS(GPIO_PORT_F);
+
+    TEST_CHECK(GPIO_OK == gpio_setPinVal(GPIO_PORT_F, GPIO_PIN_3, HIGH));
+    TEST_CHECK(GPIO_OK == gpio_pin_init(&st_cfg));
+
+    TEST_CHECK(GET_BIT(GPIOHBCTL, GPIO_PORT_F));
+    TEST_CHECK(ptr_st_apb_regs != GPIO_REGS(GPIO_PORT_F));
+    TEST_CHECK(0x08 == (test_gpio_pins(GPIO_PORT_F) & 0x0E));
+
+    // direction is configured again through the new block
+    for(en_gpio_pin_t en_pin = GPIO_PIN_2; en_pin <= GPIO_PIN_3; en_pin++)
+    {
+        st_cfg = test_gpio_cfg(GPIO_PORT_F, en_pin, OUTPUT, GPIO_BUS_AHB);
+        TEST_CHECK(GPIO_OK == gpio_pin_init(&st_cfg));
+    }
+
+    TEST_CHECK(GPIO_OK == gpio_setPinsMasked(GPIO_PORT_F, 0x0E, 0x06));
+    TEST_CHECK(0x06 == (test_gpio_pins(GPIO_PORT_F) & 0x0E));
+}
+
+// a port table reconfiguring pulled inputs as outputs drops the pulls
+static void test_gpio_port_init(void)
+{
+    const st_gpio_cfg_t arr_st_inputs[] = {
+        test_gpio_cfg(GPIO_PORT_B, GPIO_PIN_0, INPUT_PULL_UP, GPIO_BUS_APB),
+        test_gpio_cfg(GPIO_PORT_B, GPIO_PIN_1, INPUT_PULL_DOWN, GPIO_BUS_APB),
+    };
+    const st_gpio_cfg_t arr_st_outputs[] = {
+        test_gpio_cfg(GPIO_PORT_B, GPIO_PIN_0, OUTPUT, GPIO_BUS_APB),
+        test_gpio_cfg(GPIO_PORT_B, GPIO_PIN_1, OUTPUT, GPIO_BUS_APB),
+    };
+
+    TEST_CHECK(GPIO_OK == gpio_port_init(arr_st_inputs, GPIO_PORT_CFG_COUNT(arr_st_inputs)));
+    TEST_CHECK(0x01 == (GPIOPUR(GPIO_PORT_B) & 0x03));
+    TEST_CHECK(0x02 == (GPIOPDR(GPIO_PORT_B) & 0x03));
+
+    TEST_CHECK(GPIO_OK == gpio_port_init(arr_st_outputs, GPIO_PORT_CFG_COUNT(arr_st_outputs)));
+    TEST_CHECK(0x00 == (GPIOPUR(GPIO_PORT_B) & 0x03));
+    TEST_CHECK(0x00 == (GPIOPDR(GPIO_PORT_B) & 0x03));
+    TEST_CHECK(0x03 == (GPIODIR(GPIO_PORT_B) & 0x03));
+
+    // whole port writes need the whole port as output
+    TEST_CHECK(GPIO_ERROR == gpio_setPortVal(GPIO_PORT_B, 0x01));
+    TEST_CHECK(GPIO_OK == gpio_setPinsMasked(GPIO_PORT_B, 0x03, 0x01));
+    TEST_CHECK(0x01 == test_gpio_pins(GPIO_PORT_B));
+}
+
+int main(void)
+{
+    host_core_reset(16000000UL, 0);
+
+    TEST_RUN(test_gpio_pin_write);
+    TEST_RUN(test_gpio_masked_write);
+    TEST_RUN(test_gpio_input);
+    TEST_RUN(test_gpio_bus_switch);
+    TEST_RUN(test_gpio_port_init);
+
+    return TEST_REPORT();
+}
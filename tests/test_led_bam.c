@@ -0,0 +1,225 @@
+/**
+ * @file    :   test_led_bam.c
+ * @brief   :   Host tests of the LED bit angle modulation slots and set changes, on the fake timer channel
+ *              (host/fake_gpt.c) and RAM backed GPIO (GPIO_HOST_REGS), the test file includes led_program.c
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "led_program.c"
+#include "gpio_host.h"
+#include "fake_gpt.h"
+
+// after the driver, the system headers take over the NULL of std.h
+#include "host_test.h"
+#include "host_core.h"
+
+#define TEST_LED_BAM_PERIOD_TICKS   (LED_BAM_LEVEL_MAX * LED_BAM_LSB_TICKS)
+#define TEST_LED_BAM_SLOTS          (LED_BAM_BITS - LED_BAM_LOW_BITS + 1)
+
+// on time error per period: the stores land a few cycles after their time-out or timed wait on the simulated core
+#define TEST_LED_BAM_ERR_CYCLES     8
+
+/*---------------------------------------------------------/
+/- HELPERS
+/---------------------------------------------------------*/
+static void test_led_bam_led(en_led_port_t_ en_a_port, en_led_pin_t_ en_a_pin, uint8_t_ u8_a_level)
+{
+    TEST_CHECK(LED_OK == led_init(en_a_port, en_a_pin));
+    TEST_CHECK(LED_OK == led_bam_set_level(en_a_port, en_a_pin, u8_a_level));
+}
+
+// runs the core up to the coming time-out, returns the high cycles of a pin so far
+static uint64_t_ test_led_bam_high_at_timeout(en_led_port_t_ en_a_port, en_led_pin_t_ en_a_pin)
+{
+    // a level change right at a time-out may run past it by a few cycles
+    if(fake_gpt_timeout_at() > host_core_cycles())
+    {
+        host_core_spend(fake_gpt_timeout_at() - host_core_cycles());
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return gpio_host_high_cycles((uint8_t_) en_a_port, (uint8_t_) en_a_pin);
+}
+
+// runs a time-out, the slot loaded on it and the one queued behind it follow the bitplane order
+static void test_led_bam_timeout(void)
+{
+    uint8_t_ u8_bit = gl_u8_led_bam_bit;
+
+    fake_gpt_timeout();
+
+    TEST_CHECK(LED_BAM_SLOT_TICKS(u8_bit) == fake_gpt_running_ticks());
+    TEST_CHECK(LED_BAM_SLOT_TICKS(gl_u8_led_bam_bit) == fake_gpt_queued_ticks());
+}
+
+// runs one period from its first time-out up to the next one, returns the high cycles of a pin
+static uint32_t_ test_led_bam_run_period(en_led_port_t_ en_a_port, en_led_pin_t_ en_a_pin)
+{
+    uint64_t_ u64_high_start;
+    uint32_t_ u32_period_ticks = 0;
+    uint8_t_ u8_slots = 0;
+
+    TEST_CHECK(0 == gl_u8_led_bam_bit);
+    u64_high_start = test_led_bam_high_at_timeout(en_a_port, en_a_pin);
+
+    do
+    {
+        test_led_bam_timeout();
+        u32_period_ticks += fake_gpt_running_ticks();
+        u8_slots++;
+    } while(0 != gl_u8_led_bam_bit);
+
+    TEST_CHECK(TEST_LED_BAM_SLOTS == u8_slots);
+    TEST_CHECK(TEST_LED_BAM_PERIOD_TICKS == u32_period_ticks);
+
+    return (uint32_t_) (test_led_bam_high_at_timeout(en_a_port, en_a_pin) - u64_high_start);
+}
+
+// on time of a level within the store latency
+static boolean test_led_bam_on_time(uint32_t_ u32_a_high_cycles, uint8_t_ u8_a_level)
+{
+    uint32_t_ u32_target = (uint32_t_) u8_a_level * LED_BAM_LSB_TICKS;
+    uint32_t_ u32_err = (u32_a_high_cycles > u32_target) ? (u32_a_high_cycles - u32_target) :
+                                                           (u32_target - u32_a_high_cycles);
+
+    return (u32_err <= TEST_LED_BAM_ERR_CYCLES) ? TRUE : FALSE;
+}
+
+/*---------------------------------------------------------/
+/- TESTS
+/---------------------------------------------------------*/
+// the low bitplanes slot holds its interrupt, the period is a few hundred Hz in either GPIO_CHECKS build
+static void test_led_bam_lsb(void)
+{
+    TEST_CHECK((LED_BAM_LSB_TICKS << (LED_BAM_LOW_BITS - 1)) >= LED_BAM_ISR_MAX_CYCLES);
+    TEST_CHECK(((LED_BAM_LSB_TICKS - GPT_CLOCK_MHZ) << (LED_BAM_LOW_BITS - 1)) < LED_BAM_ISR_MAX_CYCLES);
+    TEST_CHECK(LED_BAM_LSB_TICKS > LED_BAM_PLANE_CYCLES);
+    TEST_CHECK((1000000UL / (LED_BAM_LEVEL_MAX * LED_BAM_LSB_US)) >= 300);
+}
+
+// every level gets level LSBs of on time per period, on two ports at once
+static void test_led_bam_levels(void)
+{
+    test_led_bam_led(LED_PORT_F, LED_PIN_1, 0);
+    test_led_bam_led(LED_PORT_F, LED_PIN_2, 100);
+    test_led_bam_led(LED_PORT_F, LED_PIN_3, LED_BAM_LEVEL_MAX);
+    test_led_bam_led(LED_PORT_B, LED_PIN_0, 37);
+    TEST_CHECK(2 == gl_arr_st_led_bam_frames[gl_u8_led_bam_active].u8_ports);
+
+    TEST_CHECK(LED_OK == led_bam_start());
+    TEST_CHECK(test_led_bam_on_time(test_led_bam_run_period(LED_PORT_F, LED_PIN_1), 0));
+    TEST_CHECK(test_led_bam_on_time(test_led_bam_run_period(LED_PORT_F, LED_PIN_2), 100));
+    TEST_CHECK(test_led_bam_on_time(test_led_bam_run_period(LED_PORT_F, LED_PIN_3), LED_BAM_LEVEL_MAX));
+    TEST_CHECK(test_led_bam_on_time(test_led_bam_run_period(LED_PORT_B, LED_PIN_0), 37));
+
+    // every level of the low bitplanes, one period each
+    for(uint8_t_ u8_level = 0; u8_level < (1 << LED_BAM_LOW_BITS); u8_level++)
+    {
+        TEST_CHECK(LED_OK == led_bam_set_level(LED_PORT_B, LED_PIN_0, u8_level));
+        (void) test_led_bam_run_period(LED_PORT_B, LED_PIN_0);
+        TEST_CHECK(test_led_bam_on_time(test_led_bam_run_period(LED_PORT_B, LED_PIN_0), u8_level));
+    }
+    TEST_CHECK(LED_OK == led_bam_set_level(LED_PORT_B, LED_PIN_0, 37));
+    (void) test_led_bam_run_period(LED_PORT_B, LED_PIN_0);
+}
+
+// a level change mid period is taken at the next period start, the running period is not torn
+static void test_led_bam_swap(void)
+{
+    uint64_t_ u64_high_start = test_led_bam_high_at_timeout(LED_PORT_F, LED_PIN_2);
+
+    // first half of the period, then the change
+    for(uint8_t_ u8_slot = 0; u8_slot < (TEST_LED_BAM_SLOTS / 2); u8_slot++)
+    {
+        test_led_bam_timeout();
+    }
+
+    TEST_CHECK(LED_OK == led_bam_set_level(LED_PORT_F, LED_PIN_2, 200));
+    TEST_CHECK(TRUE == gl_bool_led_bam_pending);
+
+    while(0 != gl_u8_led_bam_bit)
+    {
+        test_led_bam_timeout();
+    }
+    TEST_CHECK(FALSE == gl_bool_led_bam_pending);
+    TEST_CHECK(test_led_bam_on_time((uint32_t_) (test_led_bam_high_at_timeout(LED_PORT_F, LED_PIN_2) - u64_high_start),
+                                    100));
+
+    TEST_CHECK(test_led_bam_on_time(test_led_bam_run_period(LED_PORT_F, LED_PIN_2), 200));
+}
+
+// a dropped pin keeps its level and is left to led_on/led_off, the last pin of a port drops the port
+static void test_led_bam_remove(void)
+{
+    TEST_CHECK(LED_OK == led_bam_remove(LED_PORT_F, LED_PIN_3));
+    TEST_CHECK(LED_ERROR == led_bam_remove(LED_PORT_F, LED_PIN_3));
+    TEST_CHECK(LED_ERROR == led_bam_remove(LED_PORT_F, LED_PIN_4));
+    TEST_CHECK(LED_ERROR == led_bam_remove(LED_PORT_TOTAL, LED_PIN_0));
+
+    (void) test_led_bam_run_period(LED_PORT_F, LED_PIN_3);
+    TEST_CHECK(LED_OK == led_off(LED_PORT_F, LED_PIN_3));
+    TEST_CHECK(0 == test_led_bam_run_period(LED_PORT_F, LED_PIN_3));
+    TEST_CHECK(LED_OK == led_on(LED_PORT_F, LED_PIN_3));
+    TEST_CHECK(TEST_LED_BAM_PERIOD_TICKS == test_led_bam_run_period(LED_PORT_F, LED_PIN_3));
+
+    // port B goes, port F is left in its place
+    TEST_CHECK(LED_OK == led_bam_remove(LED_PORT_B, LED_PIN_0));
+    (void) test_led_bam_run_period(LED_PORT_B, LED_PIN_0);
+    TEST_CHECK(1 == gl_arr_st_led_bam_frames[gl_u8_led_bam_active].u8_ports);
+    TEST_CHECK(LED_PORT_F == gl_arr_st_led_bam_frames[gl_u8_led_bam_active].arr_u8_ports[0]);
+    TEST_CHECK(test_led_bam_on_time(test_led_bam_run_period(LED_PORT_F, LED_PIN_2), 200));
+
+    // and joins again at the end of the list
+    TEST_CHECK(LED_OK == led_bam_set_level(LED_PORT_B, LED_PIN_0, 5));
+    (void) test_led_bam_run_period(LED_PORT_B, LED_PIN_0);
+    TEST_CHECK(test_led_bam_on_time(test_led_bam_run_period(LED_PORT_B, LED_PIN_0), 5));
+    TEST_CHECK(2 == gl_arr_st_led_bam_frames[gl_u8_led_bam_active].u8_ports);
+}
+
+// a port beyond LED_BAM_MAX_PORTS would add a store to every bitplane
+static void test_led_bam_ports(void)
+{
+    TEST_CHECK(LED_ERROR == led_bam_set_level(LED_PORT_E, LED_PIN_1, 10));
+    TEST_CHECK(2 == gl_st_led_bam_latest.u8_ports);
+    TEST_CHECK(ZERO == gl_st_led_bam_latest.arr_u8_masks[LED_PORT_E]);
+
+    // more LEDs of a listed port cost no store
+    TEST_CHECK(LED_OK == led_bam_set_level(LED_PORT_B, LED_PIN_1, 10));
+    TEST_CHECK(2 == gl_st_led_bam_latest.u8_ports);
+}
+
+// the callback times its run, the wait of the low bitplanes left out, within the budget of this GPIO_CHECKS build
+static void test_led_bam_isr_cycles(void)
+{
+    uint32_t_ u32_cycles = 0;
+
+    TEST_CHECK(LED_OK == led_bam_get_isr_cycles(&u32_cycles));
+    TEST_CHECK((u32_cycles > 0) && (u32_cycles <= LED_BAM_CB_MAX_CYCLES));
+    TEST_CHECK(LED_ERROR == led_bam_get_isr_cycles(NULL_PTR));
+
+    TEST_CHECK(LED_OK == led_bam_stop());
+    TEST_CHECK(LED_OK == led_bam_start());
+    TEST_CHECK(LED_OK == led_bam_get_isr_cycles(&u32_cycles));
+    TEST_CHECK(0 == u32_cycles);
+    TEST_CHECK(LED_OK == led_bam_stop());
+}
+
+int main(void)
+{
+    host_core_reset(GPT_CLOCK_MHZ * 1000000UL, 0);
+    fake_gpt_reset();
+
+    TEST_RUN(test_led_bam_lsb);
+    TEST_RUN(test_led_bam_levels);
+    TEST_RUN(test_led_bam_swap);
+    TEST_RUN(test_led_bam_remove);
+    TEST_RUN(test_led_bam_ports);
+    TEST_RUN(test_led_bam_isr_cycles);
+
+    return TEST_REPORT();
+}
@@ -0,0 +1,335 @@
+/**
+ * @file    :   test_sw_pwm.c
+ * @brief   :   Host tests of the software PWM schedule (sw_pwm_build) and its interrupt, on the fake timer
+ *              channel (host/fake_gpt.c) and RAM backed GPIO (GPIO_HOST_REGS), the test file includes sw_pwm_program.c
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "sw_pwm_program.c"
+#include "gpio_host.h"
+#include "fake_gpt.h"
+
+// after the driver, the system headers take over the NULL of std.h
+#include <stdlib.h>
+#include <string.h>
+#include "host_test.h"
+#include "host_core.h"
+
+#define TEST_SW_PWM_PERIOD_US       1000
+#define TEST_SW_PWM_PERIOD_TICKS    (TEST_SW_PWM_PERIOD_US * GPT_CLOCK_MHZ)
+
+/*---------------------------------------------------------/
+/- HELPERS
+/---------------------------------------------------------*/
+static uint8_t_ test_sw_pwm_pins(en_gpio_port_t en_a_port)
+{
+    (void) gpio_host_data(en_a_port, 0);
+
+    return gl_arr_u8_gpio_host_pins[en_a_port];
+}
+
+// drops every channel and schedule, the engine has no delete
+static void test_sw_pwm_reset(void)
+{
+    memset(gl_arr_st_sw_pwm_channels, 0, sizeof(gl_arr_st_sw_pwm_channels));
+    memset(gl_arr_st_sw_pwm_schedules, 0, sizeof(gl_arr_st_sw_pwm_schedules));
+    gl_u8_sw_pwm_active = 0;
+    gl_bool_sw_pwm_pending = FALSE;
+    gl_u8_sw_pwm_edge = 0;
+
+    TEST_CHECK(SW_PWM_OK == sw_pwm_init(TEST_SW_PWM_PERIOD_US));
+}
+
+static uint8_t_ test_sw_pwm_channel(en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin, uint16_t_ u16_a_duty)
+{
+    st_gpio_cfg_t st_cfg = {
+        .port = en_a_port,
+        .pin = en_a_pin,
+        .pin_cfg = OUTPUT,
+        .current = PIN_CURRENT_8MA,
+        .bus = GPIO_BUS_APB
+    };
+    uint8_t_ u8_channel_id = SW_PWM_MAX_CHANNELS;
+
+    TEST_CHECK(GPIO_OK == gpio_pin_init(&st_cfg));
+    TEST_CHECK(SW_PWM_OK == sw_pwm_create(en_a_port, en_a_pin, &u8_channel_id));
+    TEST_CHECK(SW_PWM_OK == sw_pwm_set_duty(u8_channel_id, u16_a_duty));
+
+    return u8_channel_id;
+}
+
+// schedule invariants: intervals cover the period, none shorter than the interrupt budget, one store per port
+static void test_sw_pwm_check_schedule(const st_sw_pwm_schedule_t * ptr_st_a_schedule)
+{
+    uint32_t_ u32_total_ticks = 0;
+
+    TEST_CHECK((ptr_st_a_schedule->u8_edges > 0) && (ptr_st_a_schedule->u8_edges <= SW_PWM_MAX_EDGES));
+
+    for(uint8_t_ u8_edge = 0; u8_edge < ptr_st_a_schedule->u8_edges; u8_edge++)
+    {
+        const st_sw_pwm_edge_t * ptr_st_edge = &ptr_st_a_schedule->arr_st_edges[u8_edge];
+
+        TEST_CHECK(ptr_st_edge->u32_ticks_after >= SW_PWM_MIN_EDGE_TICKS);
+        TEST_CHECK(ptr_st_edge->u8_stores <= SW_PWM_MAX_PORTS);
+        u32_total_ticks += ptr_st_edge->u32_ticks_after;
+
+        for(uint8_t_ u8_store = 0; u8_store < ptr_st_edge->u8_stores; u8_store++)
+        {
+            for(uint8_t_ u8_other = u8_store + 1; u8_other < ptr_st_edge->u8_stores; u8_other++)
+            {
+                TEST_CHECK(ptr_st_a_schedule->arr_st_stores[ptr_st_edge->u8_first_store + u8_store].u8_port !=
+                           ptr_st_a_schedule->arr_st_stores[ptr_st_edge->u8_first_store + u8_other].u8_port);
+            }
+        }
+    }
+
+    TEST_CHECK(TEST_SW_PWM_PERIOD_TICKS == u32_total_ticks);
+}
+
+// runs one period from its start time-out up to the next one, returns the high ticks of a pin
+static uint32_t_ test_sw_pwm_run_period(en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin)
+{
+    uint32_t_ u32_high_ticks = 0;
+    uint32_t_ u32_period_ticks = 0;
+    uint8_t_ u8_edges;
+
+    TEST_CHECK(0 == gl_u8_sw_pwm_edge);
+
+    fake_gpt_timeout();
+    u8_edges = gl_arr_st_sw_pwm_schedules[gl_u8_sw_pwm_active].u8_edges;
+
+    for(uint8_t_ u8_edge = 0; u8_edge < u8_edges; u8_edge++)
+    {
+        if(0 != u8_edge)
+        {
+            fake_gpt_timeout();
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        u32_high_ticks += GET_BIT(test_sw_pwm_pins(en_a_port), en_a_pin) ? fake_gpt_running_ticks() : 0;
+        u32_period_ticks += fake_gpt_running_ticks();
+    }
+
+    TEST_CHECK(0 == gl_u8_sw_pwm_edge);
+    TEST_CHECK(TEST_SW_PWM_PERIOD_TICKS == u32_period_ticks);
+
+    return u32_high_ticks;
+}
+
+/*---------------------------------------------------------/
+/- TESTS
+/---------------------------------------------------------*/
+// distinct duties: one edge per duty plus the period start, the pins follow the duties exactly
+static void test_sw_pwm_distinct(void)
+{
+    const st_sw_pwm_schedule_t * ptr_st_schedule;
+    uint8_t_ u8_edges = 0;
+
+    test_sw_pwm_reset();
+    (void) test_sw_pwm_channel(GPIO_PORT_F, GPIO_PIN_1, 250);
+    (void) test_sw_pwm_channel(GPIO_PORT_F, GPIO_PIN_2, 500);
+    (void) test_sw_pwm_channel(GPIO_PORT_F, GPIO_PIN_3, 750);
+
+    ptr_st_schedule = &gl_arr_st_sw_pwm_schedules[gl_u8_sw_pwm_active];
+    test_sw_pwm_check_schedule(ptr_st_schedule);
+    TEST_CHECK(SW_PWM_OK == sw_pwm_get_edges(&u8_edges));
+    TEST_CHECK(4 == u8_edges);
+
+    // period start: the three pins of port F in one store
+    TEST_CHECK(1 == ptr_st_schedule->arr_st_edges[0].u8_stores);
+    TEST_CHECK(0x0E == ptr_st_schedule->arr_st_stores[0].u8_mask);
+    TEST_CHECK(0x0E == ptr_st_schedule->arr_st_stores[0].u8_value);
+
+    TEST_CHECK(SW_PWM_OK == sw_pwm_start());
+    TEST_CHECK((TEST_SW_PWM_PERIOD_TICKS / 4) == test_sw_pwm_run_period(GPIO_PORT_F, GPIO_PIN_1));
+    TEST_CHECK((TEST_SW_PWM_PERIOD_TICKS / 2) == test_sw_pwm_run_period(GPIO_PORT_F, GPIO_PIN_2));
+    TEST_CHECK(((TEST_SW_PWM_PERIOD_TICKS * 3) / 4) == test_sw_pwm_run_period(GPIO_PORT_F, GPIO_PIN_3));
+    TEST_CHECK(SW_PWM_OK == sw_pwm_stop());
+}
+
+// off times closer than the interrupt budget share the earlier edge, one store per port
+static void test_sw_pwm_merge(void)
+{
+    const st_sw_pwm_schedule_t * ptr_st_schedule;
+    // half the interrupt budget apart
+    uint16_t_ u16_close = 500 + (uint16_t_) ((SW_PWM_MIN_EDGE_TICKS * SW_PWM_DUTY_MAX) /
+                                             (2 * TEST_SW_PWM_PERIOD_TICKS));
+
+    test_sw_pwm_reset();
+    (void) test_sw_pwm_channel(GPIO_PORT_F, GPIO_PIN_1, 500);
+    (void) test_sw_pwm_channel(GPIO_PORT_F, GPIO_PIN_2, u16_close);
+    (void) test_sw_pwm_channel(GPIO_PORT_B, GPIO_PIN_0, u16_close);
+
+    ptr_st_schedule = &gl_arr_st_sw_pwm_schedules[gl_u8_sw_pwm_active];
+    test_sw_pwm_check_schedule(ptr_st_schedule);
+    TEST_CHECK(2 == ptr_st_schedule->u8_edges);
+    TEST_CHECK(2 == ptr_st_schedule->arr_st_edges[0].u8_stores);
+    TEST_CHECK(2 == ptr_st_schedule->arr_st_edges[1].u8_stores);
+
+    // the merged channels turn off with the first one
+    TEST_CHECK(SW_PWM_OK == sw_pwm_start());
+    TEST_CHECK((TEST_SW_PWM_PERIOD_TICKS / 2) == test_sw_pwm_run_period(GPIO_PORT_F, GPIO_PIN_2));
+    TEST_CHECK((TEST_SW_PWM_PERIOD_TICKS / 2) == test_sw_pwm_run_period(GPIO_PORT_B, GPIO_PIN_0));
+    TEST_CHECK(SW_PWM_OK == sw_pwm_stop());
+}
+
+// on times within the budget of either period end snap to 0 / 100 %
+static void test_sw_pwm_snap(void)
+{
+    const st_sw_pwm_schedule_t * ptr_st_schedule;
+    uint16_t_ u16_short = (uint16_t_) ((SW_PWM_MIN_EDGE_TICKS * SW_PWM_DUTY_MAX) / (2 * TEST_SW_PWM_PERIOD_TICKS));
+
+    test_sw_pwm_reset();
+    (void) test_sw_pwm_channel(GPIO_PORT_F, GPIO_PIN_1, u16_short);
+    (void) test_sw_pwm_channel(GPIO_PORT_F, GPIO_PIN_2, SW_PWM_DUTY_MAX - u16_short);
+    (void) test_sw_pwm_channel(GPIO_PORT_F, GPIO_PIN_3, 0);
+
+    ptr_st_schedule = &gl_arr_st_sw_pwm_schedules[gl_u8_sw_pwm_active];
+    test_sw_pwm_check_schedule(ptr_st_schedule);
+    TEST_CHECK(1 == ptr_st_schedule->u8_edges);
+    TEST_CHECK(0x0E == ptr_st_schedule->arr_st_stores[0].u8_mask);
+    TEST_CHECK(0x04 == ptr_st_schedule->arr_st_stores[0].u8_value);
+
+    TEST_CHECK(SW_PWM_OK == sw_pwm_start());
+    TEST_CHECK(0 == test_sw_pwm_run_period(GPIO_PORT_F, GPIO_PIN_1));
+    TEST_CHECK(TEST_SW_PWM_PERIOD_TICKS == test_sw_pwm_run_period(GPIO_PORT_F, GPIO_PIN_2));
+    TEST_CHECK(SW_PWM_OK == sw_pwm_stop());
+}
+
+// a duty change mid period is taken at the next period start, the running period is not torn
+static void test_sw_pwm_swap(void)
+{
+    uint8_t_ u8_channel_id;
+    uint32_t_ u32_high_ticks = 0;
+
+    test_sw_pwm_reset();
+    u8_channel_id = test_sw_pwm_channel(GPIO_PORT_F, GPIO_PIN_1, 250);
+    (void) test_sw_pwm_channel(GPIO_PORT_F, GPIO_PIN_2, 750);
+
+    TEST_CHECK(SW_PWM_OK == sw_pwm_start());
+
+    // period start, then the off edge of pin 1
+    fake_gpt_timeout();
+    TEST_CHECK(0 != GET_BIT(test_sw_pwm_pins(GPIO_PORT_F), GPIO_PIN_1));
+    fake_gpt_timeout();
+    TEST_CHECK(0 == GET_BIT(test_sw_pwm_pins(GPIO_PORT_F), GPIO_PIN_1));
+
+    TEST_CHECK(SW_PWM_OK == sw_pwm_set_duty(u8_channel_id, 900));
+    TEST_CHECK(TRUE == gl_bool_sw_pwm_pending);
+
+    // rest of the period on the old schedule, the swap is taken with its last edge
+    while(0 != gl_u8_sw_pwm_edge)
+    {
+        fake_gpt_timeout();
+        TEST_CHECK(0 == GET_BIT(test_sw_pwm_pins(GPIO_PORT_F), GPIO_PIN_1));
+    }
+    TEST_CHECK(FALSE == gl_bool_sw_pwm_pending);
+
+    u32_high_ticks = test_sw_pwm_run_period(GPIO_PORT_F, GPIO_PIN_1);
+    TEST_CHECK(((TEST_SW_PWM_PERIOD_TICKS * 9) / 10) == u32_high_ticks);
+    TEST_CHECK(SW_PWM_OK == sw_pwm_stop());
+}
+
+// random duties on every channel: the invariants hold and no channel is off by more than one merge
+static void test_sw_pwm_random(void)
+{
+    const en_gpio_port_t arr_en_ports[] = {GPIO_PORT_B, GPIO_PORT_E};
+
+    srand(7);
+
+    for(uint32_t_ u32_round = 0; u32_round < 200; u32_round++)
+    {
+        uint16_t_ arr_u16_duty[SW_PWM_MAX_CHANNELS];
+
+        test_sw_pwm_reset();
+
+        for(uint8_t_ u8_idx = 0; u8_idx < SW_PWM_MAX_CHANNELS; u8_idx++)
+        {
+            arr_u16_duty[u8_idx] = (uint16_t_) (rand() % (SW_PWM_DUTY_MAX + 1));
+            (void) test_sw_pwm_channel(arr_en_ports[u8_idx / 8], (en_gpio_pin_t) (u8_idx % 8), arr_u16_duty[u8_idx]);
+        }
+
+        test_sw_pwm_check_schedule(&gl_arr_st_sw_pwm_schedules[gl_u8_sw_pwm_active]);
+
+        TEST_CHECK(SW_PWM_OK == sw_pwm_start());
+        for(uint8_t_ u8_idx = 0; u8_idx < SW_PWM_MAX_CHANNELS; u8_idx += 5)
+        {
+            uint32_t_ u32_target = (TEST_SW_PWM_PERIOD_TICKS * arr_u16_duty[u8_idx]) / SW_PWM_DUTY_MAX;
+            uint32_t_ u32_high = test_sw_pwm_run_period(arr_en_ports[u8_idx / 8], (en_gpio_pin_t) (u8_idx % 8));
+            uint32_t_ u32_err = (u32_high > u32_target) ? (u32_high - u32_target) : (u32_target - u32_high);
+
+            TEST_CHECK(u32_err < SW_PWM_MIN_EDGE_TICKS);
+        }
+        TEST_CHECK(SW_PWM_OK == sw_pwm_stop());
+    }
+}
+
+// channels on a port beyond SW_PWM_MAX_PORTS would add a store to the interrupt budget
+static void test_sw_pwm_ports(void)
+{
+    uint8_t_ u8_channel_id = SW_PWM_MAX_CHANNELS;
+    st_gpio_cfg_t st_cfg = {
+        .port = GPIO_PORT_E,
+        .pin = GPIO_PIN_0,
+        .pin_cfg = OUTPUT,
+        .current = PIN_CURRENT_8MA,
+        .bus = GPIO_BUS_APB
+    };
+
+    test_sw_pwm_reset();
+    (void) test_sw_pwm_channel(GPIO_PORT_F, GPIO_PIN_1, 250);
+    (void) test_sw_pwm_channel(GPIO_PORT_B, GPIO_PIN_0, 500);
+
+    TEST_CHECK(GPIO_OK == gpio_pin_init(&st_cfg));
+    TEST_CHECK(SW_PWM_NO_FREE_CHANNEL == sw_pwm_create(GPIO_PORT_E, GPIO_PIN_0, &u8_channel_id));
+    TEST_CHECK(SW_PWM_MAX_CHANNELS == u8_channel_id);
+
+    // more pins of a used port cost no store
+    (void) test_sw_pwm_channel(GPIO_PORT_F, GPIO_PIN_2, 750);
+    test_sw_pwm_check_schedule(&gl_arr_st_sw_pwm_schedules[gl_u8_sw_pwm_active]);
+}
+
+// the callback times its run up to the reload store, within the budget derived for this GPIO_CHECKS build
+static void test_sw_pwm_isr_cycles(void)
+{
+    uint32_t_ u32_cycles = 0;
+
+    test_sw_pwm_reset();
+    (void) test_sw_pwm_channel(GPIO_PORT_F, GPIO_PIN_1, 250);
+    (void) test_sw_pwm_channel(GPIO_PORT_B, GPIO_PIN_0, 500);
+
+    TEST_CHECK(SW_PWM_OK == sw_pwm_start());
+    TEST_CHECK(SW_PWM_OK == sw_pwm_get_isr_cycles(&u32_cycles));
+    TEST_CHECK(0 == u32_cycles);
+
+    (void) test_sw_pwm_run_period(GPIO_PORT_F, GPIO_PIN_1);
+    TEST_CHECK(SW_PWM_OK == sw_pwm_get_isr_cycles(&u32_cycles));
+    TEST_CHECK((u32_cycles > 0) && (u32_cycles <= SW_PWM_CB_MAX_CYCLES));
+    TEST_CHECK(SW_PWM_INVALID_ARGS == sw_pwm_get_isr_cycles(NULL_PTR));
+    TEST_CHECK(SW_PWM_OK == sw_pwm_stop());
+
+    // the bare store build has the shorter budget
+    TEST_CHECK((GPIO_CHECKS ? 30 : 6) == GPIO_FAST_WRITE_CYCLES);
+    TEST_CHECK(SW_PWM_MIN_EDGE_TICKS == (SW_PWM_ISR_ENTRY_CYCLES + SW_PWM_CB_MAX_CYCLES));
+}
+
+int main(void)
+{
+    host_core_reset(GPT_CLOCK_MHZ * 1000000UL, 0);
+    fake_gpt_reset();
+
+    TEST_RUN(test_sw_pwm_distinct);
+    TEST_RUN(test_sw_pwm_merge);
+    TEST_RUN(test_sw_pwm_snap);
+    TEST_RUN(test_sw_pwm_swap);
+    TEST_RUN(test_sw_pwm_random);
+    TEST_RUN(test_sw_pwm_ports);
+    TEST_RUN(test_sw_pwm_isr_cycles);
+
+    return TEST_REPORT();
+}
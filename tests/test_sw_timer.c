@@ -0,0 +1,328 @@
+/**
+ * @file    :   test_sw_timer.c
+ * @brief   :   Host tests of the software timer on a fake ms tick, built once per queue (heap, wheel)
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "sw_timer_interface.h"
+#include "fake_systick.h"
+
+// after the driver headers, the system headers take over the NULL of std.h
+#include "host_test.h"
+#include "host_core.h"
+
+#define TEST_SW_TIMER_RANDOM_TIMERS     24
+#define TEST_SW_TIMER_RANDOM_MS         2000000UL
+
+typedef struct
+{
+    uint16_t_ u16_id;
+    uint32_t_ u32_count;
+    uint64_t_ u64_last_ms;
+    uint16_t_ u16_stop_id;              // timer stopped by the callback, SW_TIMER_MAX_TIMERS for none
+} st_test_sw_timer_rec_t;
+
+static uint32_t_ gl_u32_test_sw_timer_seed = 12345;
+
+static uint32_t_ test_sw_timer_rand(void)
+{
+    gl_u32_test_sw_timer_seed = (gl_u32_test_sw_timer_seed * 1103515245UL) + 12345UL;
+
+    return gl_u32_test_sw_timer_seed >> 8;
+}
+
+static void test_sw_timer_cb(void * ptr_v_ctx)
+{
+    st_test_sw_timer_rec_t * ptr_st_rec = (st_test_sw_timer_rec_t *) ptr_v_ctx;
+
+    ptr_st_rec->u32_count++;
+    ptr_st_rec->u64_last_ms = systick_now_ms();
+
+    if(ptr_st_rec->u16_stop_id < SW_TIMER_MAX_TIMERS) (void) sw_timer_stop(ptr_st_rec->u16_stop_id);
+}
+
+static void test_sw_timer_create(en_sw_timer_mode_t en_a_mode, st_test_sw_timer_rec_t * ptr_st_a_rec)
+{
+    ptr_st_a_rec->u32_count = 0;
+    ptr_st_a_rec->u64_last_ms = 0;
+    ptr_st_a_rec->u16_stop_id = SW_TIMER_MAX_TIMERS;
+    TEST_CHECK(SW_TIMER_OK == sw_timer_create(en_a_mode, test_sw_timer_cb, ptr_st_a_rec, &ptr_st_a_rec->u16_id));
+}
+
+// the service needs the free running tick
+static void test_sw_timer_init(void)
+{
+    uint64_t_ u64_deadline_ms = 0;
+    uint16_t_ u16_id;
+
+    fake_systick_reset(1000, FALSE);
+    TEST_CHECK(SW_TIMER_INVALID_CONFIG == sw_timer_init());
+    TEST_CHECK(SW_TIMER_INVALID_CONFIG == sw_timer_create(SW_TIMER_ONE_SHOT, test_sw_timer_cb, NULL_PTR, &u16_id));
+    TEST_CHECK(SW_TIMER_OK == sw_timer_get_next_deadline(&u64_deadline_ms));
+    TEST_CHECK(SW_TIMER_NO_DEADLINE == u64_deadline_ms);
+
+    fake_systick_reset(1000, TRUE);
+    TEST_CHECK(SW_TIMER_OK == sw_timer_init());
+    TEST_CHECK(SW_TIMER_OK == sw_timer_get_next_deadline(&u64_deadline_ms));
+    TEST_CHECK(SW_TIMER_NO_DEADLINE == u64_deadline_ms);
+}
+
+// one shots expire exactly once at start + period, across every wheel level boundary and past the wheel range
+static void test_sw_timer_one_shot(void)
+{
+    const uint32_t_ arr_u32_periods[] = {1, 2, 63, 64, 65, 4095, 4096, 4097, 262143, 262144, 262147,
+                                         (1UL << 24) - 1, (1UL << 24) + 5};
+    st_test_sw_timer_rec_t st_rec;
+
+    for(uint8_t_ u8_idx = 0; u8_idx < sizeof(arr_u32_periods) / sizeof(arr_u32_periods[0]); u8_idx++)
+    {
+        uint64_t_ u64_start_ms;
+
+        // odd phase against the wheel slots
+        fake_systick_advance(1 + (test_sw_timer_rand() % 100));
+        u64_start_ms = systick_now_ms();
+
+        test_sw_timer_create(SW_TIMER_ONE_SHOT, &st_rec);
+        TEST_CHECK(SW_TIMER_OK == sw_timer_start(st_rec.u16_id, arr_u32_periods[u8_idx]));
+
+        fake_systick_advance(arr_u32_periods[u8_idx] - 1);
+        TEST_CHECK(0 == st_rec.u32_count);
+        fake_systick_advance(1);
+        TEST_CHECK(1 == st_rec.u32_count);
+        TEST_CHECK(u64_start_ms + arr_u32_periods[u8_idx] == st_rec.u64_last_ms);
+        fake_systick_advance(100);
+        TEST_CHECK(1 == st_rec.u32_count);
+
+        TEST_CHECK(SW_TIMER_OK == sw_timer_delete(st_rec.u16_id));
+    }
+}
+
+// periodic timers re-arm from the old deadline, no drift
+static void test_sw_timer_periodic(void)
+{
+    st_test_sw_timer_rec_t st_rec;
+    uint64_t_ u64_start_ms = systick_now_ms();
+
+    test_sw_timer_create(SW_TIMER_PERIODIC, &st_rec);
+    TEST_CHECK(SW_TIMER_OK == sw_timer_start(st_rec.u16_id, 7));
+
+    fake_systick_advance(1000);
+    TEST_CHECK(142 == st_rec.u32_count);
+    TEST_CHECK(u64_start_ms + (142 * 7) == st_rec.u64_last_ms);
+
+    TEST_CHECK(SW_TIMER_OK == sw_timer_delete(st_rec.u16_id));
+}
+
+// a restart replaces the deadline, a stop cancels it
+static void test_sw_timer_stop_restart(void)
+{
+    st_test_sw_timer_rec_t st_restarted;
+    st_test_sw_timer_rec_t st_stopped;
+    uint64_t_ u64_start_ms = systick_now_ms();
+
+    test_sw_timer_create(SW_TIMER_ONE_SHOT, &st_restarted);
+    test_sw_timer_create(SW_TIMER_ONE_SHOT, &st_stopped);
+    TEST_CHECK(SW_TIMER_OK == sw_timer_start(st_restarted.u16_id, 50));
+    TEST_CHECK(SW_TIMER_OK == sw_timer_start(st_stopped.u16_id, 5000));
+
+    fake_systick_advance(20);
+    TEST_CHECK(SW_TIMER_OK == sw_timer_start(st_restarted.u16_id, 50));
+    TEST_CHECK(SW_TIMER_OK == sw_timer_stop(st_stopped.u16_id));
+    TEST_CHECK(SW_TIMER_OK == sw_timer_stop(st_stopped.u16_id));
+
+    fake_systick_advance(6000);
+    TEST_CHECK(1 == st_restarted.u32_count);
+    TEST_CHECK(u64_start_ms + 70 == st_restarted.u64_last_ms);
+    TEST_CHECK(0 == st_stopped.u32_count);
+
+    TEST_CHECK(SW_TIMER_OK == sw_timer_delete(st_restarted.u16_id));
+    TEST_CHECK(SW_TIMER_OK == sw_timer_delete(st_stopped.u16_id));
+    TEST_CHECK(SW_TIMER_INVALID_ARGS == sw_timer_start(st_stopped.u16_id, 10));
+    TEST_CHECK(SW_TIMER_INVALID_ARGS == sw_timer_stop(SW_TIMER_MAX_TIMERS));
+}
+
+// a callback can stop a timer expiring in the same ms, only one of the pair runs
+static void test_sw_timer_same_ms_stop(void)
+{
+    st_test_sw_timer_rec_t st_first;
+    st_test_sw_timer_rec_t st_second;
+
+    test_sw_timer_create(SW_TIMER_PERIODIC, &st_first);
+    test_sw_timer_create(SW_TIMER_PERIODIC, &st_second);
+    st_first.u16_stop_id = st_second.u16_id;
+    st_second.u16_stop_id = st_first.u16_id;
+    TEST_CHECK(SW_TIMER_OK == sw_timer_start(st_first.u16_id, 30));
+    TEST_CHECK(SW_TIMER_OK == sw_timer_start(st_second.u16_id, 30));
+
+    fake_systick_advance(30);
+    TEST_CHECK(1 == (st_first.u32_count + st_second.u32_count));
+
+    // the survivor keeps its period
+    fake_systick_advance(60);
+    TEST_CHECK(3 == (st_first.u32_count + st_second.u32_count));
+
+    TEST_CHECK(SW_TIMER_OK == sw_timer_delete(st_first.u16_id));
+    TEST_CHECK(SW_TIMER_OK == sw_timer_delete(st_second.u16_id));
+}
+
+// tickless idle: sleeping to the reported deadline never oversleeps an expiry, and wakes rarely
+static void test_sw_timer_next_deadline(void)
+{
+    const uint32_t_ arr_u32_periods[] = {5, 300, 70000, 1000000, 5000000};
+    st_test_sw_timer_rec_t arr_st_recs[sizeof(arr_u32_periods) / sizeof(arr_u32_periods[0])];
+    uint8_t_ u8_timers = sizeof(arr_u32_periods) / sizeof(arr_u32_periods[0]);
+    uint64_t_ u64_start_ms = systick_now_ms();
+    uint64_t_ u64_deadline_ms = 0;
+    uint32_t_ u32_wakes = 0;
+
+    for(uint8_t_ u8_idx = 0; u8_idx < u8_timers; u8_idx++)
+    {
+        test_sw_timer_create(SW_TIMER_ONE_SHOT, &arr_st_recs[u8_idx]);
+        TEST_CHECK(SW_TIMER_OK == sw_timer_start(arr_st_recs[u8_idx].u16_id, arr_u32_periods[u8_idx]));
+    }
+
+    TEST_CHECK(SW_TIMER_INVALID_ARGS == sw_timer_get_next_deadline(NULL_PTR));
+    TEST_CHECK(SW_TIMER_OK == sw_timer_get_next_deadline(&u64_deadline_ms));
+
+    while(SW_TIMER_NO_DEADLINE != u64_deadline_ms)
+    {
+        // never later than the earliest pending expiry
+        for(uint8_t_ u8_idx = 0; u8_idx < u8_timers; u8_idx++)
+        {
+            if(0 == arr_st_recs[u8_idx].u32_count) TEST_CHECK(u64_deadline_ms <= u64_start_ms + arr_u32_periods[u8_idx]);
+        }
+        TEST_CHECK(u64_deadline_ms > systick_now_ms());
+
+        fake_systick_jump_to(u64_deadline_ms);
+        u32_wakes++;
+        TEST_CHECK(SW_TIMER_OK == sw_timer_get_next_deadline(&u64_deadline_ms));
+    }
+
+    for(uint8_t_ u8_idx = 0; u8_idx < u8_timers; u8_idx++)
+    {
+        TEST_CHECK(1 == arr_st_recs[u8_idx].u32_count);
+        TEST_CHECK(u64_start_ms + arr_u32_periods[u8_idx] == arr_st_recs[u8_idx].u64_last_ms);
+        TEST_CHECK(SW_TIMER_OK == sw_timer_delete(arr_st_recs[u8_idx].u16_id));
+    }
+
+    // heap: one wake per expiry, wheel: plus at most one per level cascade of each timer
+    printf("%u timers expired in %u idle wake-ups\n", u8_timers, u32_wakes);
+#if SW_TIMER_QUEUE == SW_TIMER_QUEUE_HEAP
+    TEST_CHECK(u8_timers == u32_wakes);
+#else
+    TEST_CHECK(u32_wakes <= u8_timers * 4);
+#endif
+}
+
+// the pool is static, creation fails when it is used up
+static void test_sw_timer_pool(void)
+{
+    uint16_t_ arr_u16_ids[SW_TIMER_MAX_TIMERS];
+    uint16_t_ u16_id;
+
+    for(uint16_t_ u16_idx = 0; u16_idx < SW_TIMER_MAX_TIMERS; u16_idx++)
+    {
+        TEST_CHECK(SW_TIMER_OK == sw_timer_create(SW_TIMER_ONE_SHOT, test_sw_timer_cb, NULL_PTR, &arr_u16_ids[u16_idx]));
+    }
+    TEST_CHECK(SW_TIMER_NO_FREE_TIMER == sw_timer_create(SW_TIMER_ONE_SHOT, test_sw_timer_cb, NULL_PTR, &u16_id));
+    TEST_CHECK(SW_TIMER_INVALID_ARGS == sw_timer_create(SW_TIMER_MODE_TOTAL, test_sw_timer_cb, NULL_PTR, &u16_id));
+    TEST_CHECK(SW_TIMER_INVALID_ARGS == sw_timer_start(arr_u16_ids[0], 0));
+
+    for(uint16_t_ u16_idx = 0; u16_idx < SW_TIMER_MAX_TIMERS; u16_idx++)
+    {
+        TEST_CHECK(SW_TIMER_OK == sw_timer_delete(arr_u16_ids[u16_idx]));
+    }
+}
+
+// random starts, restarts and stops against a plain per-ms scan of the deadlines
+static void test_sw_timer_random(void)
+{
+    st_test_sw_timer_rec_t arr_st_recs[TEST_SW_TIMER_RANDOM_TIMERS];
+    uint64_t_ arr_u64_model_deadline[TEST_SW_TIMER_RANDOM_TIMERS] = {0};  // 0: stopped
+    uint32_t_ arr_u32_model_period[TEST_SW_TIMER_RANDOM_TIMERS] = {0};
+    uint32_t_ arr_u32_model_count[TEST_SW_TIMER_RANDOM_TIMERS] = {0};
+    uint32_t_ u32_mismatches = 0;
+    uint32_t_ u32_expiries = 0;
+
+    for(uint8_t_ u8_idx = 0; u8_idx < TEST_SW_TIMER_RANDOM_TIMERS; u8_idx++)
+    {
+        test_sw_timer_create((u8_idx & 1) ? SW_TIMER_PERIODIC : SW_TIMER_ONE_SHOT, &arr_st_recs[u8_idx]);
+    }
+
+    for(uint32_t_ u32_ms = 0; u32_ms < TEST_SW_TIMER_RANDOM_MS; u32_ms++)
+    {
+        uint64_t_ u64_now_ms;
+
+        // a start/restart or stop every few ms, periods spread over all levels
+        if(0 == (test_sw_timer_rand() % 4))
+        {
+            uint8_t_ u8_idx = test_sw_timer_rand() % TEST_SW_TIMER_RANDOM_TIMERS;
+            uint32_t_ u32_range = (const uint32_t_[]) {64, 4096, 262144, 1000000}[test_sw_timer_rand() % 4];
+
+            if(0 == (test_sw_timer_rand() % 3))
+            {
+                TEST_CHECK(SW_TIMER_OK == sw_timer_stop(arr_st_recs[u8_idx].u16_id));
+                arr_u64_model_deadline[u8_idx] = 0;
+            }
+            else
+            {
+                arr_u32_model_period[u8_idx] = 1 + (test_sw_timer_rand() % u32_range);
+                TEST_CHECK(SW_TIMER_OK == sw_timer_start(arr_st_recs[u8_idx].u16_id, arr_u32_model_period[u8_idx]));
+                arr_u64_model_deadline[u8_idx] = systick_now_ms() + arr_u32_model_period[u8_idx];
+            }
+        }
+
+        fake_systick_advance(1);
+        u64_now_ms = systick_now_ms();
+
+        for(uint8_t_ u8_idx = 0; u8_idx < TEST_SW_TIMER_RANDOM_TIMERS; u8_idx++)
+        {
+            if((0 != arr_u64_model_deadline[u8_idx]) && (arr_u64_model_deadline[u8_idx] == u64_now_ms))
+            {
+                arr_u32_model_count[u8_idx]++;
+                u32_expiries++;
+                arr_u64_model_deadline[u8_idx] = (u8_idx & 1) ? (u64_now_ms + arr_u32_model_period[u8_idx]) : 0;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            if(arr_u32_model_count[u8_idx] != arr_st_recs[u8_idx].u32_count)
+            {
+                u32_mismatches++;
+                arr_st_recs[u8_idx].u32_count = arr_u32_model_count[u8_idx];
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+    }
+
+    printf("%u expiries over %lu ms, %u mismatches\n", u32_expiries, TEST_SW_TIMER_RANDOM_MS, u32_mismatches);
+    TEST_CHECK(0 == u32_mismatches);
+
+    for(uint8_t_ u8_idx = 0; u8_idx < TEST_SW_TIMER_RANDOM_TIMERS; u8_idx++)
+    {
+        TEST_CHECK(SW_TIMER_OK == sw_timer_delete(arr_st_recs[u8_idx].u16_id));
+    }
+}
+
+int main(void)
+{
+    host_core_reset(16000000UL, 0);
+
+    TEST_RUN(test_sw_timer_init);
+    TEST_RUN(test_sw_timer_one_shot);
+    TEST_RUN(test_sw_timer_periodic);
+    TEST_RUN(test_sw_timer_stop_restart);
+    TEST_RUN(test_sw_timer_same_ms_stop);
+    TEST_RUN(test_sw_timer_next_deadline);
+    TEST_RUN(test_sw_timer_pool);
+    TEST_RUN(test_sw_timer_random);
+
+    return TEST_REPORT();
+}
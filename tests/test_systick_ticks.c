@@ -0,0 +1,169 @@
+/**
+ * @file    :   test_systick_ticks.c
+ * @brief   :   Integer tick math of the SysTick driver against the float conversion it replaced, over the
+ *              24-bit reload range and past it (chained periods), for both clock sources
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+// the conversion and the one shot chaining are static, the driver is built into this file
+#include "systick_program.c"
+
+// after the driver, the system headers take over the NULL of std.h
+#include <time.h>
+#include "host_test.h"
+#include "host_core.h"
+
+#define TEST_TICKS_TIMED_CALLS      1000000UL
+
+typedef struct
+{
+    const char* name;
+    en_systick_clk_src_t en_clk_src;
+    uint32_t_ u32_core_hz;
+    uint32_t_ u32_ticks_per_ms;         // exact, from the clock the counter runs on
+    float fl_mhz;                       // clock of the float conversion
+} st_test_ticks_clock_t;
+
+static st_systick_cfg_t gl_st_test_ticks_cfg = {
+    .en_systick_clk_src = CLK_SRC_PIOSC,
+    .en_systick_mode = SYSTICK_MODE_ONE_SHOT,
+    .en_systick_wait = SYSTICK_WAIT_BUSY
+};
+
+static volatile uint64_t_ gl_u64_test_ticks_sink;
+
+/**
+ * @brief                       : The conversion before the integer rework: a float ms per cycle, the result
+ *                                is the reload value, the counter then runs reload + 1 ticks
+ */
+static uint64_t_ test_ticks_float_baseline(uint32_t_ u32_a_ms, float fl_a_mhz)
+{
+    float fl_ms_per_cycle = 1000.0f / ((float) (fl_a_mhz * 1000000.0f));
+    uint32_t_ u32_reload = ((float) u32_a_ms / fl_ms_per_cycle) + 1;
+
+    return (uint64_t_) u32_reload + 1;
+}
+
+static void test_ticks_init(const st_test_ticks_clock_t* ptr_st_a_clock)
+{
+    host_core_reset(ptr_st_a_clock->u32_core_hz, 0);
+
+    gl_systick_initialized = FALSE;
+    gl_st_test_ticks_cfg.en_systick_clk_src = ptr_st_a_clock->en_clk_src;
+    TEST_CHECK(ST_OK == systick_init(&gl_st_test_ticks_cfg));
+}
+
+static double test_ticks_now_ns(void)
+{
+    struct timespec st_now;
+
+    clock_gettime(CLOCK_MONOTONIC, &st_now);
+
+    return (double) st_now.tv_sec * 1e9 + (double) st_now.tv_nsec;
+}
+
+// every ms delay that fits one reload period converts exactly, the float one is off by its rounding and +1s
+static void test_ticks_reload_range(const st_test_ticks_clock_t* ptr_st_a_clock)
+{
+    uint32_t_ u32_max_ms = (uint32_t_) (STLOAD_PERIOD_TICKS / ptr_st_a_clock->u32_ticks_per_ms);
+    uint32_t_ u32_mismatches = 0;
+    uint64_t_ u64_float_max_err = 0;
+    uint32_t_ u32_float_worst_ms = 0;
+
+    for(uint32_t_ u32_ms = 1; u32_ms <= u32_max_ms; u32_ms++)
+    {
+        uint64_t_ u64_exact = (uint64_t_) u32_ms * ptr_st_a_clock->u32_ticks_per_ms;
+        uint64_t_ u64_ticks = 0;
+        uint64_t_ u64_float = test_ticks_float_baseline(u32_ms, ptr_st_a_clock->fl_mhz);
+        uint64_t_ u64_float_err = (u64_float > u64_exact) ? (u64_float - u64_exact) : (u64_exact - u64_float);
+
+        if((ST_OK != systick_ms_to_ticks(u32_ms, &u64_ticks)) || (u64_exact != u64_ticks)) u32_mismatches++;
+        if(u64_float_err > u64_float_max_err)
+        {
+            u64_float_max_err = u64_float_err;
+            u32_float_worst_ms = u32_ms;
+        }
+    }
+
+    printf("%-12s 1..%u ms: integer mismatches %u, float max error %llu ticks (at %u ms)\n", ptr_st_a_clock->name,
+           u32_max_ms, u32_mismatches, (unsigned long long) u64_float_max_err, u32_float_worst_ms);
+
+    TEST_CHECK(0 == u32_mismatches);
+}
+
+// past 2^24 ticks the delay is chained: full periods first, the remainder last, the total is exact
+static void test_ticks_chained(const st_test_ticks_clock_t* ptr_st_a_clock)
+{
+    const uint32_t_ arr_u32_ms[] = {1, 2, 1000, 4194, 4195, 10000, 60000, 3600000, 0xFFFFFFFFUL};
+
+    for(uint8_t_ u8_idx = 0; u8_idx < sizeof(arr_u32_ms) / sizeof(arr_u32_ms[0]); u8_idx++)
+    {
+        uint64_t_ u64_ticks = 0;
+        uint64_t_ u64_programmed;
+
+        TEST_CHECK(ST_OK == systick_ms_to_ticks(arr_u32_ms[u8_idx], &u64_ticks));
+        TEST_CHECK((uint64_t_) arr_u32_ms[u8_idx] * ptr_st_a_clock->u32_ticks_per_ms == u64_ticks);
+
+        systick_oneshot_start(u64_ticks, TRUE);
+        CLR_BIT(STCTRL, STCTRL_ENABLE);
+        gl_bool_oneshot_busy = FALSE;
+
+        u64_programmed = (gl_u32_oneshot_segments - 1) * STLOAD_PERIOD_TICKS + gl_u32_oneshot_last_reload + 1;
+        TEST_CHECK(u64_ticks == u64_programmed);
+        TEST_CHECK(gl_u32_oneshot_last_reload <= STLOAD_MAX_VALUE);
+    }
+
+    {
+        uint64_t_ u64_ticks = 0;
+
+        TEST_CHECK(ST_INVALID_ARGS == systick_ms_to_ticks(0, &u64_ticks));
+    }
+}
+
+// a 64-bit multiply against a float divide, per conversion on the host
+static void test_ticks_timing(const st_test_ticks_clock_t* ptr_st_a_clock)
+{
+    double f64_start;
+    double f64_integer_ns;
+    double f64_float_ns;
+    uint64_t_ u64_ticks = 0;
+
+    f64_start = test_ticks_now_ns();
+    for(uint32_t_ u32_call = 1; u32_call <= TEST_TICKS_TIMED_CALLS; u32_call++)
+    {
+        (void) systick_ms_to_ticks(u32_call, &u64_ticks);
+        gl_u64_test_ticks_sink += u64_ticks;
+    }
+    f64_integer_ns = (test_ticks_now_ns() - f64_start) / TEST_TICKS_TIMED_CALLS;
+
+    f64_start = test_ticks_now_ns();
+    for(uint32_t_ u32_call = 1; u32_call <= TEST_TICKS_TIMED_CALLS; u32_call++)
+    {
+        gl_u64_test_ticks_sink += test_ticks_float_baseline(u32_call, ptr_st_a_clock->fl_mhz);
+    }
+    f64_float_ns = (test_ticks_now_ns() - f64_start) / TEST_TICKS_TIMED_CALLS;
+
+    printf("%-12s ns per conversion: integer %.2f, float %.2f\n", ptr_st_a_clock->name, f64_integer_ns, f64_float_ns);
+}
+
+int main(void)
+{
+    const st_test_ticks_clock_t arr_st_clocks[] = {
+        {"PIOSC/4",     CLK_SRC_PIOSC,   16000000UL,  (PIOSC_MHZ / 4) * 1000, PIOSC_MHZ / 4.0f},
+        {"SYSCLK 16M",  CLK_SRC_SYS_CLK, 16000000UL,  16000,                  16.0f},
+        {"SYSCLK 80M",  CLK_SRC_SYS_CLK, 80000000UL,  80000,                  80.0f},
+    };
+
+    for(uint8_t_ u8_clock = 0; u8_clock < sizeof(arr_st_clocks) / sizeof(arr_st_clocks[0]); u8_clock++)
+    {
+        test_ticks_init(&arr_st_clocks[u8_clock]);
+
+        test_ticks_reload_range(&arr_st_clocks[u8_clock]);
+        test_ticks_chained(&arr_st_clocks[u8_clock]);
+        test_ticks_timing(&arr_st_clocks[u8_clock]);
+    }
+
+    return TEST_REPORT();
+}
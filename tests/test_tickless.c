@@ -0,0 +1,287 @@
+/**
+ * @file    :   test_tickless.c
+ * @brief   :   Wake-ups per hour of the tickless idle main loop (app_start) on the simulated core, with
+ *              software timers and GPIO interrupts as wake-up sources, and the uptime they leave behind
+ * @version :   0.1
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "systick_interface.h"
+#include "systick_linking_config.h"
+#include "systick_private.h"
+#include "sw_timer_interface.h"
+#include "gpio_interface.h"
+
+// after the driver headers, the system headers take over the NULL of std.h
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "host_test.h"
+#include "host_core.h"
+
+#define TEST_TICKLESS_HOUR_US           3600000000ULL
+#define TEST_TICKLESS_TIMER_PERIOD_MS   1000        // app level timeout running the whole hour
+#define TEST_TICKLESS_GPIO_EDGES        100         // button presses spread over the hour
+// uptime read by the interrupts against the core cycle count, and a timer callback against its deadline
+#define TEST_TICKLESS_MAX_UPTIME_ERR_US 1
+#define TEST_TICKLESS_MAX_LATE_US       16
+// a GPIO wake-up ends the long period early: the interrupt, then the tick ending the cut back period
+#define TEST_TICKLESS_WAKEUPS_PER_EDGE  2
+// the wheel reports the cascade moving the 1 s timer to level 0 as a deadline, one more wake-up per run
+#if SW_TIMER_QUEUE == SW_TIMER_QUEUE_WHEEL
+    #define TEST_TICKLESS_CASCADE_WAKEUPS   1
+    #define TEST_TICKLESS_QUEUE_NAME        "wheel"
+#else
+    #define TEST_TICKLESS_CASCADE_WAKEUPS   0
+    #define TEST_TICKLESS_QUEUE_NAME        "heap"
+#endif
+
+typedef struct
+{
+    const char * name;
+    en_systick_clk_src_t en_clk_src;
+    uint32_t_ u32_core_hz;
+} st_test_tickless_run_t;
+
+static uint32_t_ gl_u32_test_cycles_per_us = 0;
+static uint64_t_ gl_u64_test_base_cycles = 0;
+static uint64_t_ gl_u64_test_base_us = 0;
+
+static volatile uint32_t_ gl_u32_test_timer_runs = 0;
+static volatile uint64_t_ gl_u64_test_timer_deadline_ms = 0;
+static volatile uint32_t_ gl_u32_test_timer_max_late_us = 0;
+static volatile boolean gl_bool_test_timer_early = FALSE;
+
+static volatile uint32_t_ gl_u32_test_gpio_runs = 0;
+static volatile uint32_t_ gl_u32_test_gpio_max_err_us = 0;
+static volatile boolean gl_bool_test_gpio_event = FALSE;
+// the simulated core holds one external event, each edge raises the next one
+static uint64_t_ gl_arr_u64_test_gpio_at_cycles[TEST_TICKLESS_GPIO_EDGES];
+
+// uptime expected from the core cycle count, the clocks share the reference in these runs
+static uint64_t_ test_tickless_truth_us(void)
+{
+    return gl_u64_test_base_us + ((host_core_cycles() - gl_u64_test_base_cycles) / gl_u32_test_cycles_per_us);
+}
+
+static uint32_t_ test_tickless_err_us(uint64_t_ u64_a_now_us)
+{
+    uint64_t_ u64_truth_us = test_tickless_truth_us();
+
+    return (uint32_t_) ((u64_a_now_us > u64_truth_us) ? (u64_a_now_us - u64_truth_us) :
+                                                        (u64_truth_us - u64_a_now_us));
+}
+
+static void test_tickless_timer_cb(void * ptr_v_a_ctx)
+{
+    uint64_t_ u64_now_us = systick_now_us();
+    uint64_t_ u64_deadline_us = gl_u64_test_timer_deadline_ms * 1000;
+
+    if(u64_now_us < u64_deadline_us)
+    {
+        gl_bool_test_timer_early = TRUE;
+    }
+    else if((u64_now_us - u64_deadline_us) > gl_u32_test_timer_max_late_us)
+    {
+        gl_u32_test_timer_max_late_us = (uint32_t_) (u64_now_us - u64_deadline_us);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    gl_u32_test_timer_runs++;
+    gl_u64_test_timer_deadline_ms += TEST_TICKLESS_TIMER_PERIOD_MS;
+}
+
+// button edge, reads the uptime as app_btn_cb does
+static void test_tickless_gpio_isr(void)
+{
+    uint32_t_ u32_err_us = test_tickless_err_us(systick_now_us());
+
+    gl_u32_test_gpio_max_err_us = (u32_err_us > gl_u32_test_gpio_max_err_us) ? u32_err_us :
+                                  gl_u32_test_gpio_max_err_us;
+    gl_u32_test_gpio_runs++;
+    gl_bool_test_gpio_event = TRUE;
+
+    if(gl_u32_test_gpio_runs < TEST_TICKLESS_GPIO_EDGES)
+    {
+        host_core_raise_irq_at(GPIOF_IRQn, &test_tickless_gpio_isr,
+                               gl_arr_u64_test_gpio_at_cycles[gl_u32_test_gpio_runs]);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+// the idle branch of app_start, run until the simulated core reaches u64_a_end_us
+static void test_tickless_main_loop(uint64_t_ u64_a_end_us)
+{
+    while(test_tickless_truth_us() < u64_a_end_us)
+    {
+        // event handled by the loop, the next pass sleeps again
+        gl_bool_test_gpio_event = FALSE;
+
+        __disable_irq();
+        if(FALSE == gl_bool_test_gpio_event)
+        {
+            uint64_t_ u64_wake_ms = SW_TIMER_NO_DEADLINE;
+
+            sw_timer_get_next_deadline(&u64_wake_ms);
+            systick_tickless_idle(u64_wake_ms);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        __enable_irq();
+    }
+}
+
+// longest sleep of one tickless period (a full 24-bit reload less the running tick), in us
+static uint64_t_ test_tickless_max_sleep_us(en_systick_clk_src_t en_a_clk_src)
+{
+    uint32_t_ u32_ticks_per_us = (CLK_SRC_PIOSC == en_a_clk_src) ? PIOSC_TICKS_PER_US : gl_u32_test_cycles_per_us;
+
+    return (STLOAD_PERIOD_TICKS - (SYSTICK_TICK_PERIOD_US * u32_ticks_per_us)) / u32_ticks_per_us;
+}
+
+static uint32_t_ test_tickless_run(const st_test_tickless_run_t * ptr_st_a_run)
+{
+    uint32_t_ u32_failures = 0;
+    uint64_t_ u64_max_sleep_us;
+    uint64_t_ u64_start_us;
+    uint32_t_ u32_wakeups;
+    uint32_t_ u32_max_wakeups;
+    uint32_t_ u32_uptime_err_us;
+    uint16_t_ u16_timer_id = 0;
+
+    host_core_reset(ptr_st_a_run->u32_core_hz, 0);
+    gl_st_systick_cfg_0.en_systick_clk_src = ptr_st_a_run->en_clk_src;
+    gl_st_systick_cfg_0.en_systick_mode = SYSTICK_MODE_FREE_RUNNING;
+    gl_st_systick_cfg_0.en_systick_wait = SYSTICK_WAIT_SLEEP;
+
+    if(
+            (ST_OK != systick_init(&gl_st_systick_cfg_0)) ||
+            (SW_TIMER_OK != sw_timer_init())
+            )
+    {
+        printf("init failed\n");
+        u32_failures++;
+    }
+    else
+    {
+        gl_u32_test_cycles_per_us = SystemCoreClock / 1000000UL;
+        gl_u64_test_base_cycles = host_core_cycles();
+        gl_u64_test_base_us = systick_now_us();
+        u64_max_sleep_us = test_tickless_max_sleep_us(ptr_st_a_run->en_clk_src);
+
+        printf("== %s, core %lu Hz, %s timer queue, longest sleep %llu us\n", ptr_st_a_run->name,
+               (unsigned long) ptr_st_a_run->u32_core_hz, TEST_TICKLESS_QUEUE_NAME, (unsigned long long) u64_max_sleep_us);
+
+        // nothing to do: only the 24-bit reload limit wakes the core
+        u64_start_us = test_tickless_truth_us();
+        u32_wakeups = host_core_wakeups();
+        test_tickless_main_loop(u64_start_us + TEST_TICKLESS_HOUR_US);
+        u32_wakeups = host_core_wakeups() - u32_wakeups;
+        u32_uptime_err_us = test_tickless_err_us(systick_now_us());
+        u32_max_wakeups = (uint32_t_) (TEST_TICKLESS_HOUR_US / u64_max_sleep_us) + 2;
+
+        printf("idle hour:   %7u wake-ups (max %u, 1 ms tick: %llu), uptime err %u us\n", u32_wakeups,
+               u32_max_wakeups, TEST_TICKLESS_HOUR_US / SYSTICK_TICK_PERIOD_US, u32_uptime_err_us);
+        u32_failures += (u32_wakeups > u32_max_wakeups) ? 1 : 0;
+        u32_failures += (u32_uptime_err_us > TEST_TICKLESS_MAX_UPTIME_ERR_US) ? 1 : 0;
+
+        // a periodic timer and button presses at irregular times
+        NVIC_SetPriority(GPIOF_IRQn, GPIO_IRQ_PRIORITY);
+        NVIC_EnableIRQ(GPIOF_IRQn);
+
+        u64_start_us = test_tickless_truth_us();
+        srand(1);
+        for(uint32_t_ u32_edge = 0; u32_edge < TEST_TICKLESS_GPIO_EDGES; u32_edge++)
+        {
+            uint64_t_ u64_at_us = ((TEST_TICKLESS_HOUR_US / TEST_TICKLESS_GPIO_EDGES) * u32_edge) +
+                                  ((uint64_t_) rand() % (TEST_TICKLESS_HOUR_US / TEST_TICKLESS_GPIO_EDGES));
+
+            gl_arr_u64_test_gpio_at_cycles[u32_edge] = host_core_cycles() + (u64_at_us * gl_u32_test_cycles_per_us);
+        }
+        host_core_raise_irq_at(GPIOF_IRQn, &test_tickless_gpio_isr, gl_arr_u64_test_gpio_at_cycles[0]);
+
+        if(
+                (SW_TIMER_OK != sw_timer_create(SW_TIMER_PERIODIC, &test_tickless_timer_cb, NULL_PTR,
+                                                &u16_timer_id)) ||
+                (SW_TIMER_OK != sw_timer_start(u16_timer_id, TEST_TICKLESS_TIMER_PERIOD_MS))
+                )
+        {
+            printf("timer start failed\n");
+            u32_failures++;
+        }
+        else
+        {
+            gl_u64_test_timer_deadline_ms = systick_now_ms() + TEST_TICKLESS_TIMER_PERIOD_MS;
+        }
+
+        u32_wakeups = host_core_wakeups();
+        test_tickless_main_loop(u64_start_us + TEST_TICKLESS_HOUR_US);
+        u32_wakeups = host_core_wakeups() - u32_wakeups;
+        u32_uptime_err_us = test_tickless_err_us(systick_now_us());
+        // every timer period is slept in as few reloads as fit in it
+        u32_max_wakeups = (uint32_t_) (TEST_TICKLESS_HOUR_US / (TEST_TICKLESS_TIMER_PERIOD_MS * 1000ULL)) *
+                          (uint32_t_) ((((TEST_TICKLESS_TIMER_PERIOD_MS * 1000ULL) + u64_max_sleep_us - 1) /
+                                        u64_max_sleep_us) + TEST_TICKLESS_CASCADE_WAKEUPS) +
+                          (TEST_TICKLESS_GPIO_EDGES * TEST_TICKLESS_WAKEUPS_PER_EDGE) + 2;
+
+        printf("busy hour:   %7u wake-ups (max %u), %u timer runs (max late %u us%s), %u GPIO interrupts "
+               "(max uptime err %u us), uptime err %u us\n", u32_wakeups, u32_max_wakeups,
+               gl_u32_test_timer_runs, gl_u32_test_timer_max_late_us,
+               (TRUE == gl_bool_test_timer_early) ? ", EARLY" : "", gl_u32_test_gpio_runs,
+               gl_u32_test_gpio_max_err_us, u32_uptime_err_us);
+        u32_failures += (u32_wakeups > u32_max_wakeups) ? 1 : 0;
+        u32_failures += (gl_u32_test_timer_runs <
+                         ((TEST_TICKLESS_HOUR_US / (TEST_TICKLESS_TIMER_PERIOD_MS * 1000ULL)) - 1)) ? 1 : 0;
+        u32_failures += (gl_u32_test_timer_max_late_us > TEST_TICKLESS_MAX_LATE_US) ? 1 : 0;
+        u32_failures += (TRUE == gl_bool_test_timer_early) ? 1 : 0;
+        u32_failures += (TEST_TICKLESS_GPIO_EDGES != gl_u32_test_gpio_runs) ? 1 : 0;
+        u32_failures += (gl_u32_test_gpio_max_err_us > TEST_TICKLESS_MAX_UPTIME_ERR_US) ? 1 : 0;
+        u32_failures += (u32_uptime_err_us > TEST_TICKLESS_MAX_UPTIME_ERR_US) ? 1 : 0;
+    }
+
+    return u32_failures;
+}
+
+int main(void)
+{
+    const st_test_tickless_run_t arr_st_runs[] = {
+        {"PIOSC/4",      CLK_SRC_PIOSC,   16000000UL},
+        {"system clock", CLK_SRC_SYS_CLK, 16000000UL},
+        {"system clock", CLK_SRC_SYS_CLK, 80000000UL},
+    };
+
+    // systick is initialized once per reset, each run gets its own process
+    for(uint8_t_ u8_run = 0; u8_run < sizeof(arr_st_runs) / sizeof(arr_st_runs[0]); u8_run++)
+    {
+        pid_t s32_pid;
+        int s32_status = 0;
+
+        fflush(stdout);
+        s32_pid = fork();
+
+        if(0 == s32_pid)
+        {
+            uint32_t_ u32_failures = test_tickless_run(&arr_st_runs[u8_run]);
+
+            fflush(stdout);
+            _exit((0 == u32_failures) ? 0 : 1);
+        }
+        else
+        {
+            TEST_CHECK(s32_pid > 0);
+            TEST_CHECK(s32_pid == waitpid(s32_pid, &s32_status, 0));
+            TEST_CHECK(WIFEXITED(s32_status) && (0 == WEXITSTATUS(s32_status)));
+        }
+    }
+
+    return TEST_REPORT();
+}